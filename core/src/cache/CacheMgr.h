@@ -45,13 +45,13 @@ class CacheMgr {
     virtual void
     ClearCache();
 
-    int64_t
+    virtual int64_t
     CacheUsage() const;
 
-    int64_t
+    virtual int64_t
     CacheCapacity() const;
 
-    void
+    virtual void
     SetCapacity(int64_t capacity);
 
  protected:
@@ -10,10 +10,13 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "cache/CpuCacheMgr.h"
+#include "metrics/SystemInfo.h"
 #include "server/Config.h"
 #include "utils/Log.h"
 
 #include <fiu-local.h>
+#include <algorithm>
+#include <functional>
 #include <utility>
 
 namespace milvus {
@@ -21,20 +24,40 @@ namespace cache {
 
 namespace {
 constexpr int64_t unit = 1024 * 1024 * 1024;
+
+uint64_t
+ConfiguredNodeCount() {
+    bool numa_aware = false;
+    server::Config::GetInstance().GetCacheConfigCpuCacheNumaAware(numa_aware);
+    return numa_aware ? server::SystemInfo::GetInstance().NumaTopology().size() : 1;
+}
+
+}  // namespace
+
+CpuCacheMgr::CpuCacheMgr() : CpuCacheMgr(ConfiguredNodeCount()) {
 }
 
-CpuCacheMgr::CpuCacheMgr() {
+CpuCacheMgr::CpuCacheMgr(uint64_t node_count) {
     // All config values have been checked in Config::ValidateConfig()
     server::Config& config = server::Config::GetInstance();
 
     int64_t cpu_cache_cap;
     config.GetCacheConfigCpuCacheCapacity(cpu_cache_cap);
     int64_t cap = cpu_cache_cap * unit;
-    cache_ = std::make_shared<Cache<DataObjPtr>>(cap, 1UL << 32);
 
     float cpu_cache_threshold;
     config.GetCacheConfigCpuCacheThreshold(cpu_cache_threshold);
-    cache_->set_freemem_percent(cpu_cache_threshold);
+
+    node_count = std::max<uint64_t>(node_count, 1);
+    for (uint64_t node = 0; node < node_count; ++node) {
+        auto partition = std::make_shared<Cache<DataObjPtr>>(cap / node_count, 1UL << 32);
+        partition->set_freemem_percent(cpu_cache_threshold);
+        partitions_.push_back(partition);
+    }
+    cache_ = partitions_[0];
+    if (node_count > 1) {
+        SERVER_LOG_INFO << "Cpu cache is split into " << node_count << " numa partitions";
+    }
 }
 
 CpuCacheMgr*
@@ -49,5 +72,97 @@ CpuCacheMgr::GetIndex(const std::string& key) {
     return obj;
 }
 
+uint64_t
+CpuCacheMgr::NodeOf(const std::string& key) const {
+    if (partitions_.size() <= 1) {
+        return 0;
+    }
+    // cached items of a file are keyed by its location plus a suffix, the directory is the segment
+    auto pos = key.rfind('/');
+    std::string segment_dir = pos == std::string::npos ? key : key.substr(0, pos);
+    return std::hash<std::string>()(segment_dir) % partitions_.size();
+}
+
+int64_t
+CpuCacheMgr::CacheUsage(uint64_t node) const {
+    return node < partitions_.size() ? partitions_[node]->usage() : 0;
+}
+
+int64_t
+CpuCacheMgr::CacheCapacity(uint64_t node) const {
+    return node < partitions_.size() ? partitions_[node]->capacity() : 0;
+}
+
+uint64_t
+CpuCacheMgr::ItemCount() const {
+    uint64_t count = 0;
+    for (auto& partition : partitions_) {
+        count += partition->size();
+    }
+    return count;
+}
+
+bool
+CpuCacheMgr::ItemExists(const std::string& key) {
+    return partitions_[NodeOf(key)]->exists(key);
+}
+
+DataObjPtr
+CpuCacheMgr::GetItem(const std::string& key) {
+    server::Metrics::GetInstance().CacheAccessTotalIncrement();
+    return partitions_[NodeOf(key)]->get(key);
+}
+
+void
+CpuCacheMgr::InsertItem(const std::string& key, const DataObjPtr& data) {
+    partitions_[NodeOf(key)]->insert(key, data);
+    server::Metrics::GetInstance().CacheAccessTotalIncrement();
+}
+
+void
+CpuCacheMgr::EraseItem(const std::string& key) {
+    partitions_[NodeOf(key)]->erase(key);
+    server::Metrics::GetInstance().CacheAccessTotalIncrement();
+}
+
+void
+CpuCacheMgr::PrintInfo() {
+    for (auto& partition : partitions_) {
+        partition->print();
+    }
+}
+
+void
+CpuCacheMgr::ClearCache() {
+    for (auto& partition : partitions_) {
+        partition->clear();
+    }
+}
+
+int64_t
+CpuCacheMgr::CacheUsage() const {
+    int64_t usage = 0;
+    for (auto& partition : partitions_) {
+        usage += partition->usage();
+    }
+    return usage;
+}
+
+int64_t
+CpuCacheMgr::CacheCapacity() const {
+    int64_t capacity = 0;
+    for (auto& partition : partitions_) {
+        capacity += partition->capacity();
+    }
+    return capacity;
+}
+
+void
+CpuCacheMgr::SetCapacity(int64_t capacity) {
+    for (auto& partition : partitions_) {
+        partition->set_capacity(capacity / partitions_.size());
+    }
+}
+
 }  // namespace cache
 }  // namespace milvus
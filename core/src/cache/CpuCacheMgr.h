@@ -16,14 +16,25 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace milvus {
 namespace cache {
 
+/*
+ * With cache_config.cpu_cache_numa_aware the capacity is split evenly into one partition per numa node.
+ * Every segment is assigned to a node by its directory, so all items of a segment (index, raw blocks, uids,
+ * attributes) live in the same partition, and the segment is loaded and searched by the cpu resource pinned
+ * to that node, which places its memory on the node by first touch.
+ */
 class CpuCacheMgr : public CacheMgr<DataObjPtr> {
  private:
     CpuCacheMgr();
 
+ protected:
+    // the configured capacity split into node_count partitions
+    explicit CpuCacheMgr(uint64_t node_count);
+
  public:
     // TODO(myh): use smart pointer instead
     static CpuCacheMgr*
@@ -31,6 +42,56 @@ class CpuCacheMgr : public CacheMgr<DataObjPtr> {
 
     DataObjPtr
     GetIndex(const std::string& key);
+
+    uint64_t
+    NodeCount() const {
+        return partitions_.size();
+    }
+
+    // numa node of the segment which the key or file location belongs to
+    uint64_t
+    NodeOf(const std::string& key) const;
+
+    int64_t
+    CacheUsage(uint64_t node) const;
+
+    int64_t
+    CacheCapacity(uint64_t node) const;
+
+ public:
+    uint64_t
+    ItemCount() const override;
+
+    bool
+    ItemExists(const std::string& key) override;
+
+    DataObjPtr
+    GetItem(const std::string& key) override;
+
+    void
+    InsertItem(const std::string& key, const DataObjPtr& data) override;
+
+    void
+    EraseItem(const std::string& key) override;
+
+    void
+    PrintInfo() override;
+
+    void
+    ClearCache() override;
+
+    int64_t
+    CacheUsage() const override;
+
+    int64_t
+    CacheCapacity() const override;
+
+    // capacity of all nodes, split evenly
+    void
+    SetCapacity(int64_t capacity) override;
+
+ private:
+    std::vector<CachePtr> partitions_;
 };
 
 }  // namespace cache
@@ -17,17 +17,24 @@
 
 #pragma once
 
+#include <memory>
+
+#include "segment/Attrs.h"
+#include "store/Directory.h"
+
 namespace milvus {
 namespace codec {
 
 class AttrsFormat {
-    // public:
-    //    virtual Attrs
-    //    read() = 0;
-    //
-    //    virtual void
-    //    write(Attrs attrs) = 0;
+ public:
+    virtual void
+    read(const store::DirectoryPtr& directory_ptr, segment::AttrsPtr& attrs_read) = 0;
+
+    virtual void
+    write(const store::DirectoryPtr& directory_ptr, const segment::AttrsPtr& attrs) = 0;
 };
 
+using AttrsFormatPtr = std::shared_ptr<AttrsFormat>;
+
 }  // namespace codec
 }  // namespace milvus
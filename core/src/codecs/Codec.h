@@ -22,6 +22,7 @@
 #include "DeletedDocsFormat.h"
 #include "IdBloomFilterFormat.h"
 #include "IdIndexFormat.h"
+#include "SummaryFormat.h"
 #include "VectorsFormat.h"
 #include "VectorsIndexFormat.h"
 
@@ -39,11 +40,14 @@ class Codec {
     virtual IdBloomFilterFormatPtr
     GetIdBloomFilterFormat() = 0;
 
-    // TODO(zhiru)
-    /*
-    virtual AttrsFormat
+    virtual AttrsFormatPtr
     GetAttrsFormat() = 0;
 
+    virtual SummaryFormatPtr
+    GetSummaryFormat() = 0;
+
+    // TODO(zhiru)
+    /*
     virtual VectorsIndexFormat
     GetVectorsIndexFormat() = 0;
 
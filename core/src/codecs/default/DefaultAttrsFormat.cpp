@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "codecs/default/DefaultAttrsFormat.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/Exception.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace codec {
+
+namespace {
+
+void
+ReadFully(int fd, void* data, size_t size, const std::string& file_path) {
+    auto ptr = static_cast<uint8_t*>(data);
+    while (size > 0) {
+        ssize_t n = ::read(fd, ptr, size);
+        if (n <= 0) {
+            std::string err_msg = "Failed to read from file: " + file_path + ", error: " +
+                                  (n == 0 ? std::string("unexpected end of file") : std::strerror(errno));
+            ENGINE_LOG_ERROR << err_msg;
+            ::close(fd);
+            throw Exception(SERVER_WRITE_ERROR, err_msg);
+        }
+        ptr += n;
+        size -= n;
+    }
+}
+
+void
+WriteFully(int fd, const void* data, size_t size, const std::string& file_path) {
+    auto ptr = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t n = ::write(fd, ptr, size);
+        if (n == -1) {
+            std::string err_msg = "Failed to write to file: " + file_path + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            ::close(fd);
+            throw Exception(SERVER_WRITE_ERROR, err_msg);
+        }
+        ptr += n;
+        size -= n;
+    }
+}
+
+}  // namespace
+
+void
+DefaultAttrsFormat::read(const store::DirectoryPtr& directory_ptr, segment::AttrsPtr& attrs_read) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    std::string dir_path = directory_ptr->GetDirPath();
+    if (!boost::filesystem::is_directory(dir_path)) {
+        std::string err_msg = "Directory: " + dir_path + "does not exist";
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_INVALID_ARGUMENT, err_msg);
+    }
+
+    if (attrs_read == nullptr) {
+        attrs_read = std::make_shared<segment::Attrs>();
+    }
+
+    // segments written before attributes existed have no attr file, their attributes are empty
+    boost::filesystem::directory_iterator it_end;
+    for (boost::filesystem::directory_iterator it(dir_path); it != it_end; ++it) {
+        const auto& path = it->path();
+        if (path.extension().string() != attr_extension_) {
+            continue;
+        }
+
+        int attr_fd = open(path.c_str(), O_RDONLY, 00664);
+        if (attr_fd == -1) {
+            std::string err_msg = "Failed to open file: " + path.string() + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+        }
+
+        int32_t type = 0;
+        size_t num_bytes = 0;
+        ReadFully(attr_fd, &type, sizeof(type), path.string());
+        ReadFully(attr_fd, &num_bytes, sizeof(num_bytes), path.string());
+        std::vector<uint8_t> data(num_bytes);
+        ReadFully(attr_fd, data.data(), num_bytes, path.string());
+        ::close(attr_fd);
+
+        auto name = path.stem().string();
+        attrs_read->attrs[name] = std::make_shared<segment::Attr>(std::move(data), name, (segment::AttrType)type);
+    }
+}
+
+void
+DefaultAttrsFormat::write(const store::DirectoryPtr& directory_ptr, const segment::AttrsPtr& attrs) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    std::string dir_path = directory_ptr->GetDirPath();
+    for (auto& pair : attrs->attrs) {
+        auto& attr = pair.second;
+        const std::string attr_file_path = dir_path + "/" + pair.first + attr_extension_;
+
+        int attr_fd = open(attr_file_path.c_str(), O_WRONLY | O_TRUNC | O_CREAT, 00664);
+        if (attr_fd == -1) {
+            std::string err_msg = "Failed to open file: " + attr_file_path + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+        }
+
+        auto type = (int32_t)attr->GetType();
+        size_t num_bytes = attr->GetData().size();
+        WriteFully(attr_fd, &type, sizeof(type), attr_file_path);
+        WriteFully(attr_fd, &num_bytes, sizeof(num_bytes), attr_file_path);
+        WriteFully(attr_fd, attr->GetData().data(), num_bytes, attr_file_path);
+
+        if (::close(attr_fd) == -1) {
+            std::string err_msg = "Failed to close file: " + attr_file_path + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            throw Exception(SERVER_WRITE_ERROR, err_msg);
+        }
+    }
+}
+
+}  // namespace codec
+}  // namespace milvus
@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <mutex>
+#include <string>
+
+#include "codecs/AttrsFormat.h"
+#include "segment/Attrs.h"
+
+namespace milvus {
+namespace codec {
+
+// one "<attr name>.attr" file per attribute: | type (int32) | num bytes (size_t) | values |
+class DefaultAttrsFormat : public AttrsFormat {
+ public:
+    DefaultAttrsFormat() = default;
+
+    void
+    read(const store::DirectoryPtr& directory_ptr, segment::AttrsPtr& attrs_read) override;
+
+    void
+    write(const store::DirectoryPtr& directory_ptr, const segment::AttrsPtr& attrs) override;
+
+    // No copy and move
+    DefaultAttrsFormat(const DefaultAttrsFormat&) = delete;
+    DefaultAttrsFormat(DefaultAttrsFormat&&) = delete;
+
+    DefaultAttrsFormat&
+    operator=(const DefaultAttrsFormat&) = delete;
+    DefaultAttrsFormat&
+    operator=(DefaultAttrsFormat&&) = delete;
+
+ private:
+    std::mutex mutex_;
+
+    const std::string attr_extension_ = ".attr";
+};
+
+}  // namespace codec
+}  // namespace milvus
@@ -19,8 +19,10 @@
 
 #include <memory>
 
+#include "DefaultAttrsFormat.h"
 #include "DefaultDeletedDocsFormat.h"
 #include "DefaultIdBloomFilterFormat.h"
+#include "DefaultSummaryFormat.h"
 #include "DefaultVectorsFormat.h"
 
 namespace milvus {
@@ -30,6 +32,8 @@ DefaultCodec::DefaultCodec() {
     vectors_format_ptr_ = std::make_shared<DefaultVectorsFormat>();
     deleted_docs_format_ptr_ = std::make_shared<DefaultDeletedDocsFormat>();
     id_bloom_filter_format_ptr_ = std::make_shared<DefaultIdBloomFilterFormat>();
+    attrs_format_ptr_ = std::make_shared<DefaultAttrsFormat>();
+    summary_format_ptr_ = std::make_shared<DefaultSummaryFormat>();
 }
 
 VectorsFormatPtr
@@ -47,5 +51,15 @@ DefaultCodec::GetIdBloomFilterFormat() {
     return id_bloom_filter_format_ptr_;
 }
 
+AttrsFormatPtr
+DefaultCodec::GetAttrsFormat() {
+    return attrs_format_ptr_;
+}
+
+SummaryFormatPtr
+DefaultCodec::GetSummaryFormat() {
+    return summary_format_ptr_;
+}
+
 }  // namespace codec
 }  // namespace milvus
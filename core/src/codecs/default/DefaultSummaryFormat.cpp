@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "codecs/default/DefaultSummaryFormat.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/Exception.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace codec {
+
+namespace {
+
+void
+Transfer(int fd, void* data, size_t size, bool reading, const std::string& file_path) {
+    auto ptr = static_cast<uint8_t*>(data);
+    while (size > 0) {
+        ssize_t n = reading ? ::read(fd, ptr, size) : ::write(fd, ptr, size);
+        if (n <= 0) {
+            std::string err_msg = std::string(reading ? "Failed to read from file: " : "Failed to write to file: ") +
+                                  file_path + ", error: " +
+                                  (n == 0 ? std::string("unexpected end of file") : std::strerror(errno));
+            ENGINE_LOG_ERROR << err_msg;
+            ::close(fd);
+            throw Exception(SERVER_WRITE_ERROR, err_msg);
+        }
+        ptr += n;
+        size -= n;
+    }
+}
+
+}  // namespace
+
+void
+DefaultSummaryFormat::read(const store::DirectoryPtr& directory_ptr, segment::SummaryPtr& summary) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    summary = nullptr;
+    const std::string summary_file_path = directory_ptr->GetDirPath() + "/" + summary_filename_;
+    if (!boost::filesystem::exists(summary_file_path)) {
+        return;
+    }
+
+    int summary_fd = open(summary_file_path.c_str(), O_RDONLY, 00664);
+    if (summary_fd == -1) {
+        std::string err_msg = "Failed to open file: " + summary_file_path + ", error: " + std::strerror(errno);
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+    }
+
+    int64_t dimension = 0, count = 0;
+    Transfer(summary_fd, &dimension, sizeof(dimension), true, summary_file_path);
+    Transfer(summary_fd, &count, sizeof(count), true, summary_file_path);
+    // the floats left in the file must be exactly (dimension + 1) * count
+    auto floats = (boost::filesystem::file_size(summary_file_path) - sizeof(dimension) - sizeof(count)) / sizeof(float);
+    if (dimension <= 0 || count <= 0 || floats % count != 0 || floats / count != (uint64_t)dimension + 1) {
+        ::close(summary_fd);
+        std::string err_msg = "Invalid summary file: " + summary_file_path;
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+    }
+    std::vector<float> centroids(dimension * count), radius(count);
+    Transfer(summary_fd, centroids.data(), centroids.size() * sizeof(float), true, summary_file_path);
+    Transfer(summary_fd, radius.data(), radius.size() * sizeof(float), true, summary_file_path);
+    ::close(summary_fd);
+
+    summary = std::make_shared<segment::Summary>(dimension, std::move(centroids), std::move(radius));
+}
+
+void
+DefaultSummaryFormat::write(const store::DirectoryPtr& directory_ptr, const segment::SummaryPtr& summary) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    const std::string summary_file_path = directory_ptr->GetDirPath() + "/" + summary_filename_;
+    int summary_fd = open(summary_file_path.c_str(), O_WRONLY | O_TRUNC | O_CREAT, 00664);
+    if (summary_fd == -1) {
+        std::string err_msg = "Failed to open file: " + summary_file_path + ", error: " + std::strerror(errno);
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+    }
+
+    int64_t dimension = summary->GetDimension();
+    int64_t count = summary->GetCount();
+    auto centroids = summary->GetCentroids();
+    auto radius = summary->GetRadius();
+    Transfer(summary_fd, &dimension, sizeof(dimension), false, summary_file_path);
+    Transfer(summary_fd, &count, sizeof(count), false, summary_file_path);
+    Transfer(summary_fd, centroids.data(), centroids.size() * sizeof(float), false, summary_file_path);
+    Transfer(summary_fd, radius.data(), radius.size() * sizeof(float), false, summary_file_path);
+
+    if (::close(summary_fd) == -1) {
+        std::string err_msg = "Failed to close file: " + summary_file_path + ", error: " + std::strerror(errno);
+        ENGINE_LOG_ERROR << err_msg;
+        throw Exception(SERVER_WRITE_ERROR, err_msg);
+    }
+}
+
+}  // namespace codec
+}  // namespace milvus
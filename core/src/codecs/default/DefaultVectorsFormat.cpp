@@ -22,6 +22,9 @@
 
 #include <boost/filesystem.hpp>
 
+#include "storage/file/DirectIOReader.h"
+#include "storage/file/DirectIOUtil.h"
+#include "storage/file/DirectIOWriter.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
 
@@ -46,7 +49,18 @@ DefaultVectorsFormat::read(const store::DirectoryPtr& directory_ptr, segment::Ve
     //    for (auto& it : boost::filesystem::directory_iterator(dir_path)) {
     for (; it != it_end; ++it) {
         const auto& path = it->path();
-        if (path.extension().string() == raw_vector_extension_) {
+        if (path.extension().string() == raw_vector_extension_ && storage::DirectIOEnabled()) {
+            storage::DirectIOReader rv_reader(path.string());
+            size_t num_bytes = 0;
+            rv_reader.read(&num_bytes, sizeof(size_t));
+
+            std::vector<uint8_t> vector_list;
+            vector_list.resize(num_bytes);
+            rv_reader.read(vector_list.data(), num_bytes);
+
+            vectors_read->AddData(vector_list);
+            vectors_read->SetName(path.stem().string());
+        } else if (path.extension().string() == raw_vector_extension_) {
             int rv_fd = open(path.c_str(), O_RDONLY, 00664);
             if (rv_fd == -1) {
                 std::string err_msg = "Failed to open file: " + path.string() + ", error: " + std::strerror(errno);
@@ -145,12 +159,6 @@ DefaultVectorsFormat::write(const store::DirectoryPtr& directory_ptr, const segm
     fclose(rv_file);
     */
 
-    int rv_fd = open(rv_file_path.c_str(), O_WRONLY | O_TRUNC | O_CREAT, 00664);
-    if (rv_fd == -1) {
-        std::string err_msg = "Failed to open file: " + rv_file_path + ", error: " + std::strerror(errno);
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
-    }
     int uid_fd = open(uid_file_path.c_str(), O_WRONLY | O_TRUNC | O_CREAT, 00664);
     if (uid_fd == -1) {
         std::string err_msg = "Failed to open file: " + uid_file_path + ", error: " + std::strerror(errno);
@@ -161,20 +169,33 @@ DefaultVectorsFormat::write(const store::DirectoryPtr& directory_ptr, const segm
     auto start = std::chrono::high_resolution_clock::now();
 
     size_t rv_num_bytes = vectors->GetData().size() * sizeof(uint8_t);
-    if (::write(rv_fd, &rv_num_bytes, sizeof(size_t)) == -1) {
-        std::string err_msg = "Failed to write to file: " + rv_file_path + ", error: " + std::strerror(errno);
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_WRITE_ERROR, err_msg);
-    }
-    if (::write(rv_fd, vectors->GetData().data(), rv_num_bytes) == -1) {
-        std::string err_msg = "Failed to write to file: " + rv_file_path + ", error: " + std::strerror(errno);
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_WRITE_ERROR, err_msg);
-    }
-    if (::close(rv_fd) == -1) {
-        std::string err_msg = "Failed to close file: " + rv_file_path + ", error: " + std::strerror(errno);
-        ENGINE_LOG_ERROR << err_msg;
-        throw Exception(SERVER_WRITE_ERROR, err_msg);
+    if (storage::DirectIOEnabled()) {
+        // raw vectors are written once and read back block by block, keep them out of page cache
+        storage::DirectIOWriter rv_writer(rv_file_path);
+        rv_writer.write(&rv_num_bytes, sizeof(size_t));
+        rv_writer.write((void*)vectors->GetData().data(), rv_num_bytes);
+    } else {
+        int rv_fd = open(rv_file_path.c_str(), O_WRONLY | O_TRUNC | O_CREAT, 00664);
+        if (rv_fd == -1) {
+            std::string err_msg = "Failed to open file: " + rv_file_path + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+        }
+        if (::write(rv_fd, &rv_num_bytes, sizeof(size_t)) == -1) {
+            std::string err_msg = "Failed to write to file: " + rv_file_path + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            throw Exception(SERVER_WRITE_ERROR, err_msg);
+        }
+        if (::write(rv_fd, vectors->GetData().data(), rv_num_bytes) == -1) {
+            std::string err_msg = "Failed to write to file: " + rv_file_path + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            throw Exception(SERVER_WRITE_ERROR, err_msg);
+        }
+        if (::close(rv_fd) == -1) {
+            std::string err_msg = "Failed to close file: " + rv_file_path + ", error: " + std::strerror(errno);
+            ENGINE_LOG_ERROR << err_msg;
+            throw Exception(SERVER_WRITE_ERROR, err_msg);
+        }
     }
 
     auto end = std::chrono::high_resolution_clock::now();
@@ -270,7 +291,12 @@ DefaultVectorsFormat::read_vectors(const store::DirectoryPtr& directory_ptr, off
     //    for (auto& it : boost::filesystem::directory_iterator(dir_path)) {
     for (; it != it_end; ++it) {
         const auto& path = it->path();
-        if (path.extension().string() == raw_vector_extension_) {
+        if (path.extension().string() == raw_vector_extension_ && storage::DirectIOEnabled()) {
+            storage::DirectIOReader rv_reader(path.string());
+            rv_reader.seekg(offset + sizeof(size_t));  // Beginning of file is num_bytes
+            raw_vectors.resize(num_bytes);
+            rv_reader.read(raw_vectors.data(), num_bytes);
+        } else if (path.extension().string() == raw_vector_extension_) {
             int rv_fd = open(path.c_str(), O_RDONLY, 00664);
             if (rv_fd == -1) {
                 std::string err_msg = "Failed to open file: " + path.string() + ", error: " + std::strerror(errno);
@@ -279,7 +305,7 @@ DefaultVectorsFormat::read_vectors(const store::DirectoryPtr& directory_ptr, off
             }
 
             offset += sizeof(size_t);  // Beginning of file is num_bytes
-            int off = lseek(rv_fd, offset, SEEK_SET);
+            off_t off = lseek(rv_fd, offset, SEEK_SET);
             if (off == -1) {
                 std::string err_msg = "Failed to seek file: " + path.string() + ", error: " + std::strerror(errno);
                 ENGINE_LOG_ERROR << err_msg;
@@ -0,0 +1,48 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#include "db/BuildIndexProgress.h"
+
+namespace milvus {
+namespace engine {
+
+BuildIndexProgress&
+BuildIndexProgress::GetInstance() {
+    static BuildIndexProgress instance;
+    return instance;
+}
+
+void
+BuildIndexProgress::Update(const std::string& location, const BuildIndexState& state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    states_[location] = state;
+}
+
+void
+BuildIndexProgress::Remove(const std::string& location) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    states_.erase(location);
+}
+
+bool
+BuildIndexProgress::Get(const std::string& location, BuildIndexState& state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = states_.find(location);
+    if (iter == states_.end()) {
+        return false;
+    }
+    state = iter->second;
+    return true;
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,57 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace milvus {
+namespace engine {
+
+static const char* BUILD_STAGE_WAITING = "waiting";
+static const char* BUILD_STAGE_TRAINING = "training";
+static const char* BUILD_STAGE_ADDING = "adding";
+
+struct BuildIndexState {
+    std::string stage_;
+    int64_t total_rows_ = 0;
+    int64_t built_rows_ = 0;
+    bool resumed_ = false;  // started from a build checkpoint
+};
+
+/*
+ * Progress of the index builds running in this process, keyed by the location of the raw file being indexed.
+ */
+class BuildIndexProgress {
+ public:
+    static BuildIndexProgress&
+    GetInstance();
+
+    void
+    Update(const std::string& location, const BuildIndexState& state);
+
+    void
+    Remove(const std::string& location);
+
+    // false if no build of the file is running
+    bool
+    Get(const std::string& location, BuildIndexState& state);
+
+ private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, BuildIndexState> states_;
+};
+
+}  // namespace engine
+}  // namespace milvus
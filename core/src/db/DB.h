@@ -120,6 +120,13 @@ class DB {
           const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
           const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) = 0;
 
+    // search the same vectors in several tables with one search job, results are given per table
+    virtual Status
+    QueryTables(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& table_ids,
+                const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
+                const VectorsData& vectors, std::vector<ResultIds>& result_ids,
+                std::vector<ResultDistances>& result_distances) = 0;
+
     virtual Status
     QueryByFileID(const std::shared_ptr<server::Context>& context, const std::string& table_id,
                   const std::vector<std::string>& file_ids, uint64_t k, const milvus::json& extra_params,
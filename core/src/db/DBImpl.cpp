@@ -28,8 +28,10 @@
 #include "Utils.h"
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
+#include "db/BuildIndexProgress.h"
 #include "db/IDGenerator.h"
 #include "engine/EngineFactory.h"
+#include "engine/SegmentPruner.h"
 #include "insert/MemMenagerFactory.h"
 #include "meta/MetaConsts.h"
 #include "meta/MetaFactory.h"
@@ -64,6 +66,11 @@ static const Status SHUTDOWN_ERROR = Status(DB_ERROR, "Milvus server is shutdown
 DBImpl::DBImpl(const DBOptions& options)
     : options_(options), initialized_(false), merge_thread_pool_(1, 1), index_thread_pool_(1, 1) {
     meta_ptr_ = MetaFactory::Build(options.meta_, options.mode_);
+    if (options_.mode_ != DBOptions::MODE::CLUSTER_READONLY) {
+        // readonly node never sees meta changes made by writable node, so it must query meta every time
+        meta_snapshot_ = std::make_shared<meta::SnapshotMetaImpl>(meta_ptr_, options_.meta_);
+        meta_ptr_ = meta_snapshot_;
+    }
     mem_mgr_ = MemManagerFactory::Build(meta_ptr_, options_);
 
     if (options_.wal_enable_) {
@@ -314,6 +321,15 @@ DBImpl::GetTableInfo(const std::string& table_id, TableInfo& table_info) {
             seg_stat.row_count_ = (int64_t)file.row_count_;
             seg_stat.index_name_ = index_type_name[file.engine_type_];
             seg_stat.data_size_ = (int64_t)file.file_size_;
+            if (file.file_type_ == meta::TableFileSchema::FILE_TYPE::TO_INDEX) {
+                BuildIndexState state;
+                if (BuildIndexProgress::GetInstance().Get(file.location_, state)) {
+                    seg_stat.build_stage_ = state.stage_;
+                    seg_stat.built_rows_ = state.built_rows_;
+                } else {
+                    seg_stat.build_stage_ = BUILD_STAGE_WAITING;
+                }
+            }
             segments_stat.emplace_back(seg_stat);
         }
 
@@ -506,9 +522,9 @@ DBImpl::InsertVectors(const std::string& table_id, const std::string& partition_
         }
 
         if (!vectors.float_data_.empty()) {
-            wal_mgr_->Insert(table_id, partition_tag, vectors.id_array_, vectors.float_data_);
+            wal_mgr_->Insert(table_id, partition_tag, vectors.id_array_, vectors.float_data_, vectors.attrs_);
         } else if (!vectors.binary_data_.empty()) {
-            wal_mgr_->Insert(table_id, partition_tag, vectors.id_array_, vectors.binary_data_);
+            wal_mgr_->Insert(table_id, partition_tag, vectors.id_array_, vectors.binary_data_, vectors.attrs_);
         }
         bg_task_swn_.Notify();
 
@@ -531,6 +547,13 @@ DBImpl::InsertVectors(const std::string& table_id, const std::string& partition_
             record.data_size = vectors.binary_data_.size() * sizeof(uint8_t);
         }
 
+        std::vector<uint8_t> attrs_blob;
+        if (!vectors.attrs_.attrs.empty()) {
+            segment::SerializeAttrs(vectors.attrs_, 0, vectors.vector_count_, attrs_blob);
+            record.attrs_size = attrs_blob.size();
+            record.attrs = attrs_blob.data();
+        }
+
         status = ExecWalRecord(record);
     }
 
@@ -789,6 +812,9 @@ DBImpl::CompactFile(const std::string& table_id, const meta::TableFileSchema& fi
     std::string new_segment_dir;
     utils::GetParentPath(compacted_file.location_, new_segment_dir);
     auto segment_writer_ptr = std::make_shared<segment::SegmentWriter>(new_segment_dir);
+    if (!utils::IsBinaryMetricType(compacted_file.metric_type_)) {
+        segment_writer_ptr->EnableSummary(compacted_file.dimension_);
+    }
 
     std::string segment_dir_to_merge;
     utils::GetParentPath(file.location_, segment_dir_to_merge);
@@ -987,17 +1013,38 @@ DBImpl::GetVectorByIdHelper(const std::string& table_id, IDNumber vector_id, Vec
     ENGINE_LOG_DEBUG << "Getting vector by id in " << files.size() << " files";
 
     for (auto& file : files) {
-        // Load bloom filter
-        std::string segment_dir;
-        engine::utils::GetParentPath(file.location_, segment_dir);
-        segment::SegmentReader segment_reader(segment_dir);
-        segment::IdBloomFilterPtr id_bloom_filter_ptr;
-        segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
+        bool is_binary = utils::IsBinaryMetricType(file.metric_type_);
+        size_t single_vector_bytes = is_binary ? file.dimension_ / 8 : file.dimension_ * sizeof(float);
+        std::vector<uint8_t> raw_vector;
+
+        // Try the cached index first, it answers without any disk io
+        bool cached = false;
+        EngineType engine_type = (EngineType)file.engine_type_;
+        if (file.file_type_ == meta::TableFileSchema::FILE_TYPE::RAW ||
+            file.file_type_ == meta::TableFileSchema::FILE_TYPE::TO_INDEX ||
+            file.file_type_ == meta::TableFileSchema::FILE_TYPE::BACKUP) {
+            engine_type = is_binary ? EngineType::FAISS_BIN_IDMAP : EngineType::FAISS_IDMAP;
+        }
+        auto engine = EngineFactory::Build(file.dimension_, file.location_, engine_type, (MetricType)file.metric_type_,
+                                           milvus::json::parse(file.index_params_));
+        if (engine != nullptr) {
+            engine->GetVectorByIdFromCache(vector_id, raw_vector, cached);
+        }
+
+        if (!cached) {
+            // Load bloom filter
+            std::string segment_dir;
+            engine::utils::GetParentPath(file.location_, segment_dir);
+            segment::SegmentReader segment_reader(segment_dir);
+            segment::IdBloomFilterPtr id_bloom_filter_ptr;
+            segment_reader.LoadBloomFilter(id_bloom_filter_ptr);
+
+            // Check if the id is present in bloom filter.
+            if (!id_bloom_filter_ptr->Check(vector_id)) {
+                continue;
+            }
 
-        // Check if the id is present in bloom filter.
-        if (id_bloom_filter_ptr->Check(vector_id)) {
             // Load uids and check if the id is indeed present. If yes, find its offset.
-            std::vector<int64_t> offsets;
             std::vector<segment::doc_id_t> uids;
             auto status = segment_reader.LoadUids(uids);
             if (!status.ok()) {
@@ -1005,43 +1052,45 @@ DBImpl::GetVectorByIdHelper(const std::string& table_id, IDNumber vector_id, Vec
             }
 
             auto found = std::find(uids.begin(), uids.end(), vector_id);
-            if (found != uids.end()) {
-                auto offset = std::distance(uids.begin(), found);
+            if (found == uids.end()) {
+                continue;
+            }
+            auto offset = std::distance(uids.begin(), found);
 
-                // Check whether the id has been deleted
-                segment::DeletedDocsPtr deleted_docs_ptr;
-                status = segment_reader.LoadDeletedDocs(deleted_docs_ptr);
-                if (!status.ok()) {
-                    return status;
-                }
-                auto& deleted_docs = deleted_docs_ptr->GetDeletedDocs();
-
-                auto deleted = std::find(deleted_docs.begin(), deleted_docs.end(), offset);
-                if (deleted == deleted_docs.end()) {
-                    // Load raw vector
-                    bool is_binary = utils::IsBinaryMetricType(file.metric_type_);
-                    size_t single_vector_bytes = is_binary ? file.dimension_ / 8 : file.dimension_ * sizeof(float);
-                    std::vector<uint8_t> raw_vector;
-                    status = segment_reader.LoadVectors(offset * single_vector_bytes, single_vector_bytes, raw_vector);
-                    if (!status.ok()) {
-                        return status;
-                    }
+            // Check whether the id has been deleted
+            segment::DeletedDocsPtr deleted_docs_ptr;
+            status = segment_reader.LoadDeletedDocs(deleted_docs_ptr);
+            if (!status.ok()) {
+                return status;
+            }
+            auto& deleted_docs = deleted_docs_ptr->GetDeletedDocs();
 
-                    vector.vector_count_ = 1;
-                    if (is_binary) {
-                        vector.binary_data_ = std::move(raw_vector);
-                    } else {
-                        std::vector<float> float_vector;
-                        float_vector.resize(file.dimension_);
-                        memcpy(float_vector.data(), raw_vector.data(), single_vector_bytes);
-                        vector.float_data_ = std::move(float_vector);
-                    }
-                    return Status::OK();
-                }
+            auto deleted = std::find(deleted_docs.begin(), deleted_docs.end(), offset);
+            if (deleted != deleted_docs.end()) {
+                continue;
             }
-        } else {
+
+            // Load raw vector
+            status = segment_reader.LoadVectors(offset * single_vector_bytes, single_vector_bytes, raw_vector);
+            if (!status.ok()) {
+                return status;
+            }
+        }
+
+        if (raw_vector.empty()) {
             continue;
         }
+
+        vector.vector_count_ = 1;
+        if (is_binary) {
+            vector.binary_data_ = std::move(raw_vector);
+        } else {
+            std::vector<float> float_vector;
+            float_vector.resize(file.dimension_);
+            memcpy(float_vector.data(), raw_vector.data(), single_vector_bytes);
+            vector.float_data_ = std::move(float_vector);
+        }
+        return Status::OK();
     }
 
     return Status::OK();
@@ -1114,16 +1163,57 @@ Status
 DBImpl::QueryByID(const std::shared_ptr<server::Context>& context, const std::string& table_id,
                   const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
                   IDNumber vector_id, ResultIds& result_ids, ResultDistances& result_distances) {
+    auto query_ctx = context->Child("Query by id");
+
     if (!initialized_.load(std::memory_order_acquire)) {
         return SHUTDOWN_ERROR;
     }
 
-    VectorsData vectors_data = VectorsData();
-    vectors_data.id_array_.emplace_back(vector_id);
-    vectors_data.vector_count_ = 1;
-    Status result =
-        Query(context, table_id, partition_tags, k, extra_params, vectors_data, result_ids, result_distances);
-    return result;
+    TimeRecorder rc("");
+    meta::TableFilesSchema files_array;
+    auto status = CollectFilesToSearch(table_id, partition_tags, files_array);
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (context->GetProfile() != nullptr) {
+        context->GetProfile()->RecordStage(server::QUERY_STAGE_META, rc.RecordSection("Collect files to search"));
+    }
+
+    if (files_array.empty()) {
+        return Status::OK();
+    }
+
+    // resolve the id to its vector (from cached index when possible), then search it as a normal query
+    VectorsData vectors_data;
+    OngoingFileChecker::GetInstance().MarkOngoingFiles(files_array);
+    status = GetVectorByIdHelper(table_id, vector_id, vectors_data, files_array);
+    OngoingFileChecker::GetInstance().UnmarkOngoingFiles(files_array);
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (context->GetProfile() != nullptr) {
+        context->GetProfile()->RecordStage(server::QUERY_STAGE_FETCH_VECTOR, rc.RecordSection("Fetch vector by id"));
+    }
+
+    if (vectors_data.vector_count_ == 0) {
+        // absent or deleted id, return empty result like a search that hits nothing
+        ENGINE_LOG_DEBUG << "Vector id " << vector_id << " not found in table " << table_id;
+        result_ids.assign(k, -1);
+        result_distances.assign(k, std::numeric_limits<float>::max());
+        return Status::OK();
+    }
+
+    SegmentPruner::Prune(extra_params, vectors_data, files_array);
+
+    cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
+    status = QueryAsync(query_ctx, table_id, files_array, k, extra_params, vectors_data, result_ids, result_distances);
+    cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
+
+    query_ctx->GetTraceContext()->GetSpan()->Finish();
+
+    return status;
 }
 
 Status
@@ -1136,43 +1226,59 @@ DBImpl::Query(const std::shared_ptr<server::Context>& context, const std::string
         return SHUTDOWN_ERROR;
     }
 
-    Status status;
-    std::vector<size_t> ids;
+    TimeRecorder rc("");
     meta::TableFilesSchema files_array;
+    auto status = CollectFilesToSearch(table_id, partition_tags, files_array);
+    if (!status.ok()) {
+        return status;
+    }
 
-    if (partition_tags.empty()) {
-        // no partition tag specified, means search in whole table
-        // get all table files from parent table
-        status = GetFilesToSearch(table_id, ids, files_array);
-        if (!status.ok()) {
-            return status;
-        }
+    if (context->GetProfile() != nullptr) {
+        context->GetProfile()->RecordStage(server::QUERY_STAGE_META, rc.ElapseFromBegin("Collect files to search"));
+    }
 
-        std::vector<meta::TableSchema> partition_array;
-        status = meta_ptr_->ShowPartitions(table_id, partition_array);
-        for (auto& schema : partition_array) {
-            status = GetFilesToSearch(schema.table_id_, ids, files_array);
-        }
+    if (files_array.empty()) {
+        return Status::OK();
+    }
 
-        if (files_array.empty()) {
-            return Status::OK();
-        }
-    } else {
-        // get files from specified partitions
-        std::set<std::string> partition_name_array;
-        GetPartitionsByTags(table_id, partition_tags, partition_name_array);
+    SegmentPruner::Prune(extra_params, vectors, files_array);
 
-        for (auto& partition_name : partition_name_array) {
-            status = GetFilesToSearch(partition_name, ids, files_array);
-        }
+    cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
+    status = QueryAsync(query_ctx, table_id, files_array, k, extra_params, vectors, result_ids, result_distances);
+    cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
+
+    query_ctx->GetTraceContext()->GetSpan()->Finish();
+
+    return status;
+}
 
-        if (files_array.empty()) {
-            return Status::OK();
+Status
+DBImpl::QueryTables(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& table_ids,
+                    const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
+                    const VectorsData& vectors, std::vector<ResultIds>& result_ids,
+                    std::vector<ResultDistances>& result_distances) {
+    auto query_ctx = context->Child("Query tables");
+
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    TimeRecorder rc("");
+    std::vector<meta::TableFilesSchema> files(table_ids.size());
+    for (size_t i = 0; i < table_ids.size(); ++i) {
+        auto status = CollectFilesToSearch(table_ids[i], partition_tags, files[i]);
+        if (!status.ok()) {
+            return status;
         }
+        SegmentPruner::Prune(extra_params, vectors, files[i]);
+    }
+
+    if (context->GetProfile() != nullptr) {
+        context->GetProfile()->RecordStage(server::QUERY_STAGE_META, rc.ElapseFromBegin("Collect files to search"));
     }
 
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(query_ctx, table_id, files_array, k, extra_params, vectors, result_ids, result_distances);
+    auto status = QueryAsync(query_ctx, table_ids, files, k, extra_params, vectors, result_ids, result_distances);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
 
     query_ctx->GetTraceContext()->GetSpan()->Finish();
@@ -1200,11 +1306,16 @@ DBImpl::QueryByFileID(const std::shared_ptr<server::Context>& context, const std
     }
 
     meta::TableFilesSchema files_array;
+    TimeRecorder rc("");
     auto status = GetFilesToSearch(table_id, ids, files_array);
     if (!status.ok()) {
         return status;
     }
 
+    if (context->GetProfile() != nullptr) {
+        context->GetProfile()->RecordStage(server::QUERY_STAGE_META, rc.ElapseFromBegin("Collect files to search"));
+    }
+
     fiu_do_on("DBImpl.QueryByFileID.empty_files_array", files_array.clear());
     if (files_array.empty()) {
         return Status(DB_ERROR, "Invalid file id");
@@ -1235,35 +1346,69 @@ Status
 DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, const std::string& table_id,
                    const meta::TableFilesSchema& files, uint64_t k, const milvus::json& extra_params,
                    const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) {
+    std::vector<ResultIds> tables_result_ids;
+    std::vector<ResultDistances> tables_result_distances;
+    auto status =
+        QueryAsync(context, {table_id}, {files}, k, extra_params, vectors, tables_result_ids, tables_result_distances);
+    if (!status.ok()) {
+        return status;
+    }
+
+    result_ids.swap(tables_result_ids[0]);
+    result_distances.swap(tables_result_distances[0]);
+    return Status::OK();
+}
+
+Status
+DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& table_ids,
+                   const std::vector<meta::TableFilesSchema>& files, uint64_t k, const milvus::json& extra_params,
+                   const VectorsData& vectors, std::vector<ResultIds>& result_ids,
+                   std::vector<ResultDistances>& result_distances) {
     auto query_async_ctx = context->Child("Query Async");
 
     server::CollectQueryMetrics metrics(vectors.vector_count_);
 
     TimeRecorder rc("");
 
-    // step 1: construct search job
-    auto status = OngoingFileChecker::GetInstance().MarkOngoingFiles(files);
+    // step 1: construct search job, one group of files for each table
+    meta::TableFilesSchema all_files;
+    for (auto& table_files : files) {
+        all_files.insert(all_files.end(), table_files.begin(), table_files.end());
+    }
+    auto status = OngoingFileChecker::GetInstance().MarkOngoingFiles(all_files);
 
-    ENGINE_LOG_DEBUG << "Engine query begin, index file count: " << files.size();
+    ENGINE_LOG_DEBUG << "Engine query begin, table count: " << table_ids.size()
+                     << ", index file count: " << all_files.size();
     scheduler::SearchJobPtr job = std::make_shared<scheduler::SearchJob>(query_async_ctx, k, extra_params, vectors);
-    for (auto& file : files) {
-        scheduler::TableFileSchemaPtr file_ptr = std::make_shared<meta::TableFileSchema>(file);
-        job->AddIndexFile(file_ptr);
+    for (size_t i = 0; i < table_ids.size(); ++i) {
+        for (auto& file : files[i]) {
+            scheduler::TableFileSchemaPtr file_ptr = std::make_shared<meta::TableFileSchema>(file);
+            job->AddIndexFile(file_ptr, table_ids[i]);
+        }
     }
 
     // step 2: put search job to scheduler and wait result
-    scheduler::JobMgrInst::GetInstance()->Put(job);
-    job->WaitResult();
+    if (!all_files.empty()) {
+        scheduler::JobMgrInst::GetInstance()->Put(job);
+        job->WaitResult();
+    }
 
-    status = OngoingFileChecker::GetInstance().UnmarkOngoingFiles(files);
+    status = OngoingFileChecker::GetInstance().UnmarkOngoingFiles(all_files);
     if (!job->GetStatus().ok()) {
         return job->GetStatus();
     }
 
-    // step 3: construct results
-    result_ids = job->GetResultIds();
-    result_distances = job->GetResultDistances();
-    rc.ElapseFromBegin("Engine query totally cost");
+    // step 3: construct results, empty for tables without files
+    result_ids.clear();
+    result_distances.clear();
+    for (auto& table_id : table_ids) {
+        result_ids.emplace_back(std::move(job->GetResultIds(table_id)));
+        result_distances.emplace_back(std::move(job->GetResultDistances(table_id)));
+    }
+    double job_cost = rc.ElapseFromBegin("Engine query totally cost");
+    if (context->GetProfile() != nullptr) {
+        context->GetProfile()->RecordStage(server::QUERY_STAGE_JOB, job_cost);
+    }
 
     query_async_ctx->GetTraceContext()->GetSpan()->Finish();
 
@@ -1334,6 +1479,13 @@ DBImpl::StartMetricTask() {
         server::Metrics::GetInstance().CpuCacheUsageGaugeSet(0);
     }
 
+    auto cpu_cache = cache::CpuCacheMgr::GetInstance();
+    for (uint64_t node = 0; node < cpu_cache->NodeCount(); ++node) {
+        int64_t node_total = cpu_cache->CacheCapacity(node);
+        double node_usage = node_total > 0 ? cpu_cache->CacheUsage(node) * 100.0 / node_total : 0;
+        server::Metrics::GetInstance().CpuCacheNodeUsageGaugeSet(node, node_usage);
+    }
+
     server::Metrics::GetInstance().GpuCacheUsageGaugeSet();
     uint64_t size;
     Size(size);
@@ -1427,6 +1579,9 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::TableFilesSchema& fi
     std::string new_segment_dir;
     utils::GetParentPath(table_file.location_, new_segment_dir);
     auto segment_writer_ptr = std::make_shared<segment::SegmentWriter>(new_segment_dir);
+    if (!utils::IsBinaryMetricType(table_file.metric_type_)) {
+        segment_writer_ptr->EnableSummary(table_file.dimension_);
+    }
 
     for (auto& file : files) {
         server::CollectMergeFilesMetrics metrics;
@@ -1596,11 +1751,14 @@ DBImpl::BackgroundBuildIndex() {
             job2file_map.push_back(std::make_pair(job, file_ptr));
         }
 
-        // step 3: wait build index finished and mark failed files
+        // step 3: wait build index finished and mark failed files, the jobs are built concurrently by the scheduler
+        size_t pending = job2file_map.size();
+        server::Metrics::GetInstance().BuildIndexQueueDepthGaugeSet(pending);
         for (auto iter = job2file_map.begin(); iter != job2file_map.end(); ++iter) {
             scheduler::BuildIndexJobPtr job = iter->first;
             meta::TableFileSchema& file_schema = *(iter->second.get());
             job->WaitBuildIndexFinish();
+            server::Metrics::GetInstance().BuildIndexQueueDepthGaugeSet(--pending);
             if (!job->GetStatus().ok()) {
                 Status status = job->GetStatus();
                 ENGINE_LOG_ERROR << "Building index job " << job->id() << " failed: " << status.ToString();
@@ -1608,6 +1766,7 @@ DBImpl::BackgroundBuildIndex() {
                 index_failed_checker_.MarkFailedIndexFile(file_schema, status.message());
             } else {
                 ENGINE_LOG_DEBUG << "Building index job " << job->id() << " succeed.";
+                server::Metrics::GetInstance().BuildIndexRowsTotalIncrement(file_schema.row_count_);
 
                 index_failed_checker_.MarkSucceedIndexFile(file_schema);
             }
@@ -1654,6 +1813,61 @@ DBImpl::GetFilesToSearch(const std::string& table_id, const std::vector<size_t>&
     return Status::OK();
 }
 
+Status
+DBImpl::CollectFilesToSearch(const std::string& table_id, const std::vector<std::string>& partition_tags,
+                             meta::TableFilesSchema& files) {
+    if (partition_tags.empty()) {
+        // no partition tag specified, means search in whole table
+        // get all table files from parent table
+        auto status = GetSnapshotFilesToSearch(table_id, files);
+        if (!status.ok()) {
+            return status;
+        }
+
+        std::vector<meta::TableSchema> partition_array;
+        status = GetSnapshotPartitions(table_id, partition_array);
+        for (auto& schema : partition_array) {
+            status = GetSnapshotFilesToSearch(schema.table_id_, files);
+        }
+    } else {
+        // get files from specified partitions
+        std::set<std::string> partition_name_array;
+        GetPartitionsByTags(table_id, partition_tags, partition_name_array);
+
+        for (auto& partition_name : partition_name_array) {
+            GetSnapshotFilesToSearch(partition_name, files);
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+DBImpl::GetSnapshotFilesToSearch(const std::string& table_id, meta::TableFilesSchema& files) {
+    if (meta_snapshot_ == nullptr) {
+        std::vector<size_t> ids;
+        return GetFilesToSearch(table_id, ids, files);
+    }
+
+    meta::TableFilesSchema search_files;
+    auto status = meta_snapshot_->SnapshotFilesToSearch(table_id, search_files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    files.insert(files.end(), search_files.begin(), search_files.end());
+    return Status::OK();
+}
+
+Status
+DBImpl::GetSnapshotPartitions(const std::string& table_id, std::vector<meta::TableSchema>& partition_array) {
+    if (meta_snapshot_ == nullptr) {
+        return meta_ptr_->ShowPartitions(table_id, partition_array);
+    }
+
+    return meta_snapshot_->SnapshotPartitions(table_id, partition_array);
+}
+
 Status
 DBImpl::GetPartitionByTag(const std::string& table_id, const std::string& partition_tag, std::string& partition_name) {
     Status status;
@@ -1685,7 +1899,7 @@ Status
 DBImpl::GetPartitionsByTags(const std::string& table_id, const std::vector<std::string>& partition_tags,
                             std::set<std::string>& partition_name_array) {
     std::vector<meta::TableSchema> partition_array;
-    auto status = meta_ptr_->ShowPartitions(table_id, partition_array);
+    auto status = GetSnapshotPartitions(table_id, partition_array);
 
     for (auto& tag : partition_tags) {
         // trim side-blank of tag, only compare valid characters
@@ -1906,6 +2120,14 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
 
     Status status;
 
+    segment::Attrs attrs;
+    if (record.attrs != nullptr && record.attrs_size > 0) {
+        if (!segment::DeserializeAttrs((const uint8_t*)record.attrs, record.attrs_size, record.length, attrs)) {
+            ENGINE_LOG_ERROR << "Malformed attributes in wal record " << record.lsn;
+            return Status(DB_ERROR, "Malformed attributes in wal record");
+        }
+    }
+
     switch (record.type) {
         case wal::MXLogType::InsertBinary: {
             std::string target_table_name;
@@ -1917,7 +2139,8 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
             std::set<std::string> flushed_tables;
             status = mem_mgr_->InsertVectors(target_table_name, record.length, record.ids,
                                              (record.data_size / record.length / sizeof(uint8_t)),
-                                             (const u_int8_t*)record.data, record.lsn, flushed_tables);
+                                             (const u_int8_t*)record.data, attrs, record.lsn,
+                                             flushed_tables);
             // even though !status.ok, run
             tables_flushed(flushed_tables);
 
@@ -1936,7 +2159,8 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
             std::set<std::string> flushed_tables;
             status = mem_mgr_->InsertVectors(target_table_name, record.length, record.ids,
                                              (record.data_size / record.length / sizeof(float)),
-                                             (const float*)record.data, record.lsn, flushed_tables);
+                                             (const float*)record.data, attrs, record.lsn,
+                                             flushed_tables);
             // even though !status.ok, run
             tables_flushed(flushed_tables);
 
@@ -28,6 +28,7 @@
 #include "db/OngoingFileChecker.h"
 #include "db/Types.h"
 #include "db/insert/MemManager.h"
+#include "db/meta/SnapshotMetaImpl.h"
 #include "utils/ThreadPool.h"
 #include "wal/WalManager.h"
 
@@ -139,6 +140,12 @@ class DBImpl : public DB, public server::CacheConfigHandler {
           const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
           const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) override;
 
+    Status
+    QueryTables(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& table_ids,
+                const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
+                const VectorsData& vectors, std::vector<ResultIds>& result_ids,
+                std::vector<ResultDistances>& result_distances) override;
+
     Status
     QueryByFileID(const std::shared_ptr<server::Context>& context, const std::string& table_id,
                   const std::vector<std::string>& file_ids, uint64_t k, const milvus::json& extra_params,
@@ -157,10 +164,22 @@ class DBImpl : public DB, public server::CacheConfigHandler {
                const meta::TableFilesSchema& files, uint64_t k, const milvus::json& extra_params,
                const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances);
 
+    // files[i] are searched for table_ids[i] and reduced into result_ids[i]
+    Status
+    QueryAsync(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& table_ids,
+               const std::vector<meta::TableFilesSchema>& files, uint64_t k, const milvus::json& extra_params,
+               const VectorsData& vectors, std::vector<ResultIds>& result_ids,
+               std::vector<ResultDistances>& result_distances);
+
     Status
     GetVectorByIdHelper(const std::string& table_id, IDNumber vector_id, VectorsData& vector,
                         const meta::TableFilesSchema& files);
 
+    // files of table and its partitions, or of the partitions matching tags
+    Status
+    CollectFilesToSearch(const std::string& table_id, const std::vector<std::string>& partition_tags,
+                         meta::TableFilesSchema& files);
+
     void
     BackgroundTimerTask();
     void
@@ -202,6 +221,13 @@ class DBImpl : public DB, public server::CacheConfigHandler {
     Status
     GetFilesToSearch(const std::string& table_id, const std::vector<size_t>& file_ids, meta::TableFilesSchema& files);
 
+    // read from meta snapshot if available, used by query
+    Status
+    GetSnapshotFilesToSearch(const std::string& table_id, meta::TableFilesSchema& files);
+
+    Status
+    GetSnapshotPartitions(const std::string& table_id, std::vector<meta::TableSchema>& partition_array);
+
     Status
     GetPartitionByTag(const std::string& table_id, const std::string& partition_tag, std::string& partition_name);
 
@@ -238,6 +264,7 @@ class DBImpl : public DB, public server::CacheConfigHandler {
     std::thread bg_timer_thread_;
 
     meta::MetaPtr meta_ptr_;
+    meta::SnapshotMetaImplPtr meta_snapshot_;  // same object as meta_ptr_, null on cluster readonly node
     MemManagerPtr mem_mgr_;
 
     std::shared_ptr<wal::WalManager> wal_mgr_;
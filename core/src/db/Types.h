@@ -45,6 +45,7 @@ struct VectorsData {
     std::vector<float> float_data_;
     std::vector<uint8_t> binary_data_;
     IDNumbers id_array_;
+    segment::Attrs attrs_;  // optional, one value per vector for each attribute
 };
 
 using File2ErrArray = std::map<std::string, std::vector<std::string>>;
@@ -57,6 +58,8 @@ struct SegmentStat {
     int64_t row_count_ = 0;
     std::string index_name_;
     int64_t data_size_ = 0;
+    std::string build_stage_;  // empty unless the segment is waiting for or under index building
+    int64_t built_rows_ = 0;
 };
 
 struct PartitionStat {
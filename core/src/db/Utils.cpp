@@ -18,6 +18,7 @@
 #include <regex>
 #include <vector>
 
+#include "db/engine/BuildCheckpoint.h"
 #include "server/Config.h"
 #include "storage/s3/S3ClientWrapper.h"
 #include "utils/CommonUtil.h"
@@ -190,6 +191,7 @@ Status
 DeleteTableFilePath(const DBMetaOptions& options, meta::TableFileSchema& table_file) {
     utils::GetTableFilePath(options, table_file);
     boost::filesystem::remove(table_file.location_);
+    engine::BuildCheckpoint::Remove(table_file.location_);
     return Status::OK();
 }
 
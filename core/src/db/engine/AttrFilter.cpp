@@ -0,0 +1,357 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/engine/AttrFilter.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <utility>
+
+#include "utils/Error.h"
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+enum class TokenType { NAME, NUMBER, SYMBOL, END };
+
+struct Token {
+    TokenType type;
+    std::string text;
+};
+
+Status
+Tokenize(const std::string& expr, std::vector<Token>& tokens) {
+    static const std::vector<std::string> symbols = {"&&", "||", "==", "!=", "<=", ">=", "<", ">",
+                                                     "!",  "(",  ")",  "[",  "]",  ","};
+    size_t pos = 0;
+    while (pos < expr.size()) {
+        auto c = static_cast<unsigned char>(expr[pos]);
+        if (std::isspace(c)) {
+            ++pos;
+        } else if (c == '_' || std::isalpha(c)) {
+            size_t begin = pos;
+            while (pos < expr.size() && (expr[pos] == '_' || std::isalnum(static_cast<unsigned char>(expr[pos])))) {
+                ++pos;
+            }
+            tokens.push_back({TokenType::NAME, expr.substr(begin, pos - begin)});
+        } else if (std::isdigit(c) || c == '.' || c == '-' || c == '+') {
+            const char* begin = expr.c_str() + pos;
+            char* end = nullptr;
+            strtod(begin, &end);
+            if (end == begin) {
+                return Status(DB_ERROR, "Invalid number at position " + std::to_string(pos));
+            }
+            tokens.push_back({TokenType::NUMBER, std::string(begin, end - begin)});
+            pos += end - begin;
+        } else {
+            auto found = std::find_if(symbols.begin(), symbols.end(), [&](const std::string& symbol) {
+                return expr.compare(pos, symbol.size(), symbol) == 0;
+            });
+            if (found == symbols.end()) {
+                std::string msg = "Unexpected character '" + std::string(1, expr[pos]) + "'";
+                return Status(DB_ERROR, msg + " at position " + std::to_string(pos));
+            }
+            tokens.push_back({TokenType::SYMBOL, *found});
+            pos += found->size();
+        }
+    }
+    tokens.push_back({TokenType::END, ""});
+    return Status::OK();
+}
+
+// or   := and (("||" | "or") and)*
+// and  := not (("&&" | "and") not)*
+// not  := ("!" | "not") not | "(" or ")" | name op number | name "in" "[" number ("," number)* "]"
+class Parser {
+ public:
+    explicit Parser(std::vector<Token> tokens) : tokens_(std::move(tokens)) {
+    }
+
+    Status
+    Parse(AttrFilter::NodePtr& root) {
+        auto status = ParseOr(root);
+        if (status.ok() && Peek().type != TokenType::END) {
+            return Status(DB_ERROR, "Unexpected token '" + Peek().text + "'");
+        }
+        return status;
+    }
+
+    std::vector<std::string>&
+    Names() {
+        return names_;
+    }
+
+ private:
+    const Token&
+    Peek() const {
+        return tokens_[pos_];
+    }
+
+    bool
+    Accept(const std::string& text) {
+        auto& token = Peek();
+        if (token.type != TokenType::END && token.type != TokenType::NUMBER && token.text == text) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    Status
+    Expect(const std::string& text) {
+        if (!Accept(text)) {
+            return Status(DB_ERROR, "Expect '" + text + "' but got '" + Peek().text + "'");
+        }
+        return Status::OK();
+    }
+
+    Status
+    ParseBinary(AttrFilter::NodeType type, const std::string& symbol, const std::string& keyword,
+                Status (Parser::*parse_operand)(AttrFilter::NodePtr&), AttrFilter::NodePtr& node) {
+        auto status = (this->*parse_operand)(node);
+        if (!status.ok()) {
+            return status;
+        }
+        while (Accept(symbol) || Accept(keyword)) {
+            AttrFilter::NodePtr right;
+            status = (this->*parse_operand)(right);
+            if (!status.ok()) {
+                return status;
+            }
+            if (node->type != type) {
+                auto parent = std::make_shared<AttrFilter::Node>();
+                parent->type = type;
+                parent->children.push_back(node);
+                node = parent;
+            }
+            node->children.push_back(right);
+        }
+        return Status::OK();
+    }
+
+    Status
+    ParseOr(AttrFilter::NodePtr& node) {
+        return ParseBinary(AttrFilter::NodeType::OR, "||", "or", &Parser::ParseAnd, node);
+    }
+
+    Status
+    ParseAnd(AttrFilter::NodePtr& node) {
+        return ParseBinary(AttrFilter::NodeType::AND, "&&", "and", &Parser::ParseNot, node);
+    }
+
+    Status
+    ParseNot(AttrFilter::NodePtr& node) {
+        if (Accept("!") || Accept("not")) {
+            AttrFilter::NodePtr child;
+            auto status = ParseNot(child);
+            if (!status.ok()) {
+                return status;
+            }
+            node = std::make_shared<AttrFilter::Node>();
+            node->type = AttrFilter::NodeType::NOT;
+            node->children.push_back(child);
+            return Status::OK();
+        }
+
+        if (Accept("(")) {
+            auto status = ParseOr(node);
+            if (!status.ok()) {
+                return status;
+            }
+            return Expect(")");
+        }
+
+        return ParseComparison(node);
+    }
+
+    Status
+    ParseComparison(AttrFilter::NodePtr& node) {
+        using Operator = std::pair<std::string, AttrFilter::NodeType>;
+        static const std::vector<Operator> operators = {
+            {"==", AttrFilter::NodeType::EQ}, {"!=", AttrFilter::NodeType::NE}, {"<=", AttrFilter::NodeType::LE},
+            {">=", AttrFilter::NodeType::GE}, {"<", AttrFilter::NodeType::LT},  {">", AttrFilter::NodeType::GT},
+            {"in", AttrFilter::NodeType::IN}};
+
+        auto& name = Peek();
+        if (name.type != TokenType::NAME) {
+            return Status(DB_ERROR, "Expect attribute name but got '" + name.text + "'");
+        }
+        node = std::make_shared<AttrFilter::Node>();
+        auto found = std::find(names_.begin(), names_.end(), name.text);
+        node->column = found - names_.begin();
+        if (found == names_.end()) {
+            names_.push_back(name.text);
+        }
+        ++pos_;
+
+        auto op = std::find_if(operators.begin(), operators.end(),
+                               [&](const Operator& pair) { return Accept(pair.first); });
+        if (op == operators.end()) {
+            return Status(DB_ERROR, "Expect comparison operator but got '" + Peek().text + "'");
+        }
+        node->type = op->second;
+
+        if (node->type != AttrFilter::NodeType::IN) {
+            return ParseLiteral(node->values);
+        }
+
+        auto status = Expect("[");
+        while (status.ok()) {
+            status = ParseLiteral(node->values);
+            if (status.ok() && !Accept(",")) {
+                return Expect("]");
+            }
+        }
+        return status;
+    }
+
+    Status
+    ParseLiteral(std::vector<AttrFilter::Literal>& values) {
+        auto& token = Peek();
+        if (token.type != TokenType::NUMBER) {
+            return Status(DB_ERROR, "Expect number but got '" + token.text + "'");
+        }
+
+        AttrFilter::Literal literal;
+        literal.integral = token.text.find_first_not_of("+-0123456789") == std::string::npos;
+        if (literal.integral) {
+            literal.int_value = strtoll(token.text.c_str(), nullptr, 10);
+            literal.double_value = static_cast<double>(literal.int_value);
+        } else {
+            literal.double_value = strtod(token.text.c_str(), nullptr);
+        }
+        values.push_back(literal);
+        ++pos_;
+        return Status::OK();
+    }
+
+ private:
+    std::vector<Token> tokens_;
+    size_t pos_ = 0;
+    std::vector<std::string> names_;
+};
+
+template <typename T>
+bool
+Compare(AttrFilter::NodeType type, T value, T literal) {
+    switch (type) {
+        case AttrFilter::NodeType::EQ:
+        case AttrFilter::NodeType::IN:
+            return value == literal;
+        case AttrFilter::NodeType::NE:
+            return value != literal;
+        case AttrFilter::NodeType::LT:
+            return value < literal;
+        case AttrFilter::NodeType::LE:
+            return value <= literal;
+        case AttrFilter::NodeType::GT:
+            return value > literal;
+        case AttrFilter::NodeType::GE:
+            return value >= literal;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+AttrFilter::AttrFilter(const std::string& expr, NodePtr root, std::vector<std::string> names)
+    : expr_(expr), root_(std::move(root)), names_(std::move(names)) {
+}
+
+Status
+AttrFilter::Parse(const std::string& expr, AttrFilterPtr& filter) {
+    std::vector<Token> tokens;
+    auto status = Tokenize(expr, tokens);
+    if (!status.ok()) {
+        return Status(status.code(), "Invalid filter expression: " + status.message());
+    }
+
+    Parser parser(std::move(tokens));
+    NodePtr root;
+    status = parser.Parse(root);
+    if (!status.ok()) {
+        return Status(status.code(), "Invalid filter expression: " + status.message());
+    }
+
+    filter = AttrFilterPtr(new AttrFilter(expr, root, std::move(parser.Names())));
+    return Status::OK();
+}
+
+std::vector<const segment::Attr*>
+AttrFilter::Columns(const segment::Attrs& attrs) const {
+    std::vector<const segment::Attr*> columns;
+    for (auto& name : names_) {
+        auto found = attrs.attrs.find(name);
+        columns.push_back(found == attrs.attrs.end() ? nullptr : found->second.get());
+    }
+    return columns;
+}
+
+bool
+AttrFilter::MatchNode(const Node& node, const std::vector<const segment::Attr*>& columns, size_t row) {
+    switch (node.type) {
+        case NodeType::OR:
+            return std::any_of(node.children.begin(), node.children.end(),
+                               [&](const NodePtr& child) { return MatchNode(*child, columns, row); });
+        case NodeType::AND:
+            return std::all_of(node.children.begin(), node.children.end(),
+                               [&](const NodePtr& child) { return MatchNode(*child, columns, row); });
+        case NodeType::NOT:
+            return !MatchNode(*node.children[0], columns, row);
+        default:
+            break;
+    }
+
+    auto column = columns[node.column];
+    bool integral = true;
+    int64_t int_value = 0;
+    double double_value = 0;
+    if (column != nullptr && row < column->GetCount()) {
+        if (column->GetType() == segment::AttrType::INT64) {
+            int_value = column->GetInt64(row);
+            double_value = static_cast<double>(int_value);
+        } else {
+            integral = false;
+            double_value = column->GetDouble(row);
+        }
+    }
+
+    return std::any_of(node.values.begin(), node.values.end(), [&](const Literal& literal) {
+        if (integral && literal.integral) {
+            return Compare(node.type, int_value, literal.int_value);
+        }
+        return Compare(node.type, double_value, literal.double_value);
+    });
+}
+
+bool
+AttrFilter::Match(const segment::Attrs& attrs, size_t row) const {
+    return MatchNode(*root_, Columns(attrs), row);
+}
+
+faiss::ConcurrentBitsetPtr
+AttrFilter::Evaluate(const segment::Attrs& attrs, size_t row_count) const {
+    auto columns = Columns(attrs);
+    auto bitset = std::make_shared<faiss::ConcurrentBitset>(row_count);
+    for (size_t row = 0; row < row_count; ++row) {
+        if (!MatchNode(*root_, columns, row)) {
+            bitset->set(row);
+        }
+    }
+    return bitset;
+}
+
+}  // namespace engine
+}  // namespace milvus
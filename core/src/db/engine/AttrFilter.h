@@ -0,0 +1,96 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <faiss/utils/ConcurrentBitset.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "segment/Attrs.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace engine {
+
+// key of the filter expression in search parameters
+static const char* ATTR_FILTER_KEY = "filter";
+
+class AttrFilter;
+using AttrFilterPtr = std::shared_ptr<AttrFilter>;
+
+/*
+ * Boolean expression over numeric attributes, for example "price < 9.5 && (color == 1 || color in [3, 4])".
+ * Supports "||" / "or", "&&" / "and", "!" / "not", parentheses, "== != < <= > >=" and "in [v, ...]",
+ * the attribute is always on the left side of a comparison.
+ * A row without the attribute is evaluated with value 0. Int64 columns compare exactly with integer literals,
+ * everything else compares as double.
+ */
+class AttrFilter {
+ public:
+    static Status
+    Parse(const std::string& expr, AttrFilterPtr& filter);
+
+    const std::string&
+    Expression() const {
+        return expr_;
+    }
+
+    // attribute names referenced by the expression, without duplicates
+    const std::vector<std::string>&
+    Names() const {
+        return names_;
+    }
+
+    bool
+    Match(const segment::Attrs& attrs, size_t row) const;
+
+    // bit i is set when row i doesn't match, the same convention as the blacklist of deleted docs
+    faiss::ConcurrentBitsetPtr
+    Evaluate(const segment::Attrs& attrs, size_t row_count) const;
+
+ public:
+    struct Literal {
+        bool integral = false;
+        int64_t int_value = 0;
+        double double_value = 0;
+    };
+
+    enum class NodeType { OR, AND, NOT, EQ, NE, LT, LE, GT, GE, IN };
+
+    struct Node {
+        NodeType type;
+        std::vector<std::shared_ptr<Node>> children;  // OR, AND, NOT
+        size_t column = 0;                            // comparisons, index in Names()
+        std::vector<Literal> values;                  // comparisons, one value except IN
+    };
+    using NodePtr = std::shared_ptr<Node>;
+
+ private:
+    AttrFilter(const std::string& expr, NodePtr root, std::vector<std::string> names);
+
+    // columns in the order of Names(), nullptr for absent attributes
+    std::vector<const segment::Attr*>
+    Columns(const segment::Attrs& attrs) const;
+
+    static bool
+    MatchNode(const Node& node, const std::vector<const segment::Attr*>& columns, size_t row);
+
+ private:
+    std::string expr_;
+    NodePtr root_;
+    std::vector<std::string> names_;
+};
+
+}  // namespace engine
+}  // namespace milvus
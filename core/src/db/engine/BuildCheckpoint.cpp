@@ -0,0 +1,216 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#include "db/engine/BuildCheckpoint.h"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <stdexcept>
+
+#include "server/Config.h"
+#include "storage/file/FileIOReader.h"
+#include "storage/file/FileIOWriter.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+constexpr const char* STAGE_TRAINED = "trained";
+constexpr const char* STAGE_PARTIAL = "partial";
+
+constexpr const char* META_SUFFIX = ".build_checkpoint";
+constexpr const char* DATA_SUFFIX = ".build_checkpoint_data";
+
+// write to a temporary file first, so a crash while saving never leaves a torn checkpoint behind
+Status
+ReplaceFile(const std::string& tmp_path, const std::string& path) {
+    boost::system::error_code err;
+    boost::filesystem::rename(tmp_path, path, err);
+    if (err) {
+        return Status(DB_ERROR, "Failed to save build checkpoint " + path + ": " + err.message());
+    }
+    return Status::OK();
+}
+
+// same layout as the entries of an index file
+void
+WriteBinarySet(const knowhere::BinarySet& binary_set, const std::string& path) {
+    storage::FileIOWriter writer(path);
+    for (auto& iter : binary_set.binary_map_) {
+        size_t meta_length = iter.first.length();
+        writer.write(&meta_length, sizeof(meta_length));
+        writer.write((void*)iter.first.c_str(), meta_length);
+
+        auto& binary = iter.second;
+        int64_t binary_length = binary->size;
+        writer.write(&binary_length, sizeof(binary_length));
+        writer.write((void*)binary->data.get(), binary_length);
+    }
+    writer.fs_.flush();
+    if (!writer.fs_) {
+        throw std::runtime_error("write error");
+    }
+}
+
+void
+ReadBinarySet(const std::string& path, knowhere::BinarySet& binary_set) {
+    storage::FileIOReader reader(path);
+    size_t length = reader.length();
+    size_t rp = 0;
+    reader.seekg(0);
+    while (rp < length) {
+        size_t meta_length;
+        reader.read(&meta_length, sizeof(meta_length));
+        rp += sizeof(meta_length);
+        if (rp > length || meta_length > length - rp) {
+            throw std::runtime_error("truncated file");
+        }
+        std::string meta(meta_length, '\0');
+        reader.read(&meta[0], meta_length);
+        rp += meta_length;
+
+        int64_t binary_length;
+        reader.read(&binary_length, sizeof(binary_length));
+        rp += sizeof(binary_length);
+        if (rp > length || binary_length < 0 || (size_t)binary_length > length - rp) {
+            throw std::runtime_error("truncated file");
+        }
+        std::shared_ptr<uint8_t> data(new uint8_t[binary_length], std::default_delete<uint8_t[]>());
+        reader.read(data.get(), binary_length);
+        binary_set.Append(meta, data, binary_length);
+
+        rp += binary_length;
+    }
+}
+
+}  // namespace
+
+BuildCheckpoint::BuildCheckpoint(const std::string& location, IndexType index_type, const milvus::json& params)
+    : meta_path_(location + META_SUFFIX),
+      data_path_(location + DATA_SUFFIX),
+      index_type_(index_type),
+      params_(params.dump()) {
+    bool s3_enable = false;
+    server::Config::GetInstance().GetStorageConfigS3Enable(s3_enable);
+    enabled_ = !s3_enable;
+}
+
+void
+BuildCheckpoint::Restore(VecIndexPtr& index, BuildHooks& hooks) {
+    if (!enabled_ || !boost::filesystem::exists(meta_path_) || !boost::filesystem::exists(data_path_)) {
+        return;
+    }
+
+    try {
+        milvus::json meta;
+        std::ifstream(meta_path_) >> meta;
+        if (meta["index_type"].get<int>() != static_cast<int>(index_type_) ||
+            meta["params"].get<std::string>() != params_) {
+            ENGINE_LOG_DEBUG << "Discard build checkpoint " << meta_path_ << " of other index type or params";
+            Remove();
+            return;
+        }
+
+        auto stage = meta["stage"].get<std::string>();
+        if (stage == STAGE_PARTIAL) {
+            auto partial = read_index(data_path_);
+            if (partial != nullptr && partial->GetType() == index_type_) {
+                ENGINE_LOG_DEBUG << "Resume index build from " << data_path_ << " with " << partial->Count()
+                                 << " rows built";
+                index = partial;
+                hooks.resume_partial_ = true;
+            }
+        } else if (stage == STAGE_TRAINED) {
+            ReadBinarySet(data_path_, hooks.model_);
+            ENGINE_LOG_DEBUG << "Resume index build from trained model " << data_path_;
+        }
+    } catch (std::exception& e) {
+        ENGINE_LOG_WARNING << "Discard broken build checkpoint " << meta_path_ << ": " << e.what();
+        hooks.model_ = knowhere::BinarySet();
+        Remove();
+    }
+}
+
+Status
+BuildCheckpoint::SaveModel(const knowhere::BinarySet& model) {
+    if (!enabled_) {
+        return Status::OK();
+    }
+
+    std::string tmp_path = data_path_ + ".tmp";
+    try {
+        WriteBinarySet(model, tmp_path);
+    } catch (std::exception& e) {
+        return Status(DB_ERROR, "Failed to save build checkpoint " + data_path_ + ": " + e.what());
+    }
+    auto status = ReplaceFile(tmp_path, data_path_);
+    if (!status.ok()) {
+        return status;
+    }
+    return SaveMeta(STAGE_TRAINED);
+}
+
+Status
+BuildCheckpoint::SavePartial(const VecIndexPtr& index) {
+    if (!enabled_ || index_type_ != IndexType::HNSW) {
+        return Status::OK();
+    }
+
+    std::string tmp_path = data_path_ + ".tmp";
+    auto status = write_index(index, tmp_path);
+    if (!status.ok()) {
+        return status;
+    }
+    status = ReplaceFile(tmp_path, data_path_);
+    if (!status.ok()) {
+        return status;
+    }
+    return SaveMeta(STAGE_PARTIAL);
+}
+
+void
+BuildCheckpoint::Remove() {
+    boost::system::error_code err;
+    boost::filesystem::remove(meta_path_, err);
+    boost::filesystem::remove(data_path_, err);
+}
+
+void
+BuildCheckpoint::Remove(const std::string& location) {
+    boost::system::error_code err;
+    boost::filesystem::remove(location + META_SUFFIX, err);
+    boost::filesystem::remove(location + DATA_SUFFIX, err);
+}
+
+Status
+BuildCheckpoint::SaveMeta(const std::string& stage) {
+    milvus::json meta;
+    meta["index_type"] = static_cast<int>(index_type_);
+    meta["params"] = params_;
+    meta["stage"] = stage;
+
+    std::string tmp_path = meta_path_ + ".tmp";
+    {
+        std::ofstream out(tmp_path);
+        out << meta.dump();
+        if (!out) {
+            return Status(DB_ERROR, "Failed to save build checkpoint " + meta_path_);
+        }
+    }
+    return ReplaceFile(tmp_path, meta_path_);
+}
+
+}  // namespace engine
+}  // namespace milvus
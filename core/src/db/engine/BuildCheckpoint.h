@@ -0,0 +1,69 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "utils/Json.h"
+#include "utils/Status.h"
+#include "wrapper/VecIndex.h"
+
+namespace milvus {
+namespace engine {
+
+// a partially built index is saved at most once per interval
+static constexpr int64_t BUILD_CHECKPOINT_INTERVAL_SEC = 300;
+
+/*
+ * Checkpoint of the index build of a raw file, kept in the segment folder so a build interrupted by a restart
+ * resumes instead of starting over. "<location>.build_checkpoint" records the index type and build parameters,
+ * "<location>.build_checkpoint_data" holds the trained model of IVF types or the partially built HNSW graph.
+ * A checkpoint of another index type or other parameters is discarded. Checkpoints are disabled on S3 storage.
+ */
+class BuildCheckpoint {
+ public:
+    BuildCheckpoint(const std::string& location, IndexType index_type, const milvus::json& params);
+
+    // replace index by the partial index saved before, or put the saved model into hooks
+    void
+    Restore(VecIndexPtr& index, BuildHooks& hooks);
+
+    Status
+    SaveModel(const knowhere::BinarySet& model);
+
+    // nothing is saved for index types that can't resume from a partial index
+    Status
+    SavePartial(const VecIndexPtr& index);
+
+    void
+    Remove();
+
+    // drop the checkpoint of the raw file at location, e.g. once its build failed for good
+    static void
+    Remove(const std::string& location);
+
+ private:
+    Status
+    SaveMeta(const std::string& stage);
+
+ private:
+    bool enabled_ = true;
+    std::string meta_path_;
+    std::string data_path_;
+    IndexType index_type_;
+    std::string params_;
+};
+
+}  // namespace engine
+}  // namespace milvus
@@ -47,6 +47,17 @@ enum class MetricType {
     MAX_VALUE = TANIMOTO,
 };
 
+// key of the radius in search parameters, a search with radius only returns results with distance below it,
+// or similarity above it for IP, topk is then the limit of results per query
+static const char* RANGE_RADIUS_KEY = "radius";
+
+// results per query of a range search, knn searches are limited to 2048
+static constexpr int64_t RANGE_SEARCH_MAX_K = 16384;
+
+// key of the re-rank factor in search parameters, quantized indexes then search k * factor candidates and
+// rank them again by exact distances computed from the raw vectors of the segment
+static const char* RERANK_KEY = "rerank";
+
 class ExecutionEngine {
  public:
     virtual Status
@@ -73,6 +84,10 @@ class ExecutionEngine {
     virtual Status
     Load(bool to_cache = true) = 0;
 
+    // load for searching only, large raw segments are not loaded as a whole but searched block by block
+    virtual Status
+    LoadForSearch() = 0;
+
     virtual Status
     CopyToGpu(uint64_t device_id, bool hybrid) = 0;
 
@@ -94,6 +109,11 @@ class ExecutionEngine {
     virtual Status
     GetVectorByID(const int64_t& id, uint8_t* vector, bool hybrid) = 0;
 
+    // get raw vector of id from cpu cache without disk io, vector is empty if id is absent or deleted,
+    // cached is false if the file is not in cache or its index is not a flat one
+    virtual Status
+    GetVectorByIdFromCache(const int64_t& id, std::vector<uint8_t>& vector, bool& cached) = 0;
+
     virtual Status
     Search(int64_t n, const float* data, int64_t k, const milvus::json& extra_params, float* distances, int64_t* labels,
            bool hybrid) = 0;
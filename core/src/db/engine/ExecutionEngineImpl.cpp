@@ -11,16 +11,28 @@
 
 #include "db/engine/ExecutionEngineImpl.h"
 
+#include <faiss/FaissHook.h>
 #include <faiss/utils/ConcurrentBitset.h>
+#include <faiss/utils/Heap.h>
+#include <faiss/utils/distances.h>
 #include <fiu-local.h>
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <limits>
+#include <numeric>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
+#include "db/BuildIndexProgress.h"
 #include "db/Utils.h"
+#include "db/engine/AttrFilter.h"
+#include "db/engine/BuildCheckpoint.h"
+#include "db/engine/SegmentPruner.h"
 #include "knowhere/common/Config.h"
 #include "metrics/Metrics.h"
 #include "scheduler/Utils.h"
@@ -72,8 +84,155 @@ IsBinaryIndexType(IndexType type) {
     return type == IndexType::FAISS_BIN_IDMAP || type == IndexType::FAISS_BIN_IVFLAT_CPU;
 }
 
+// index types which keep raw vectors, other types could only give back approximate vectors
+bool
+IsLosslessIndexType(IndexType type) {
+    return type == IndexType::FAISS_IDMAP || type == IndexType::FAISS_BIN_IDMAP ||
+           type == IndexType::FAISS_IVFFLAT_CPU || type == IndexType::FAISS_BIN_IVFLAT_CPU;
+}
+
+// drop results of filtered rows and move the rest forward, for indexes which search without bitset
+void
+PostFilter(const faiss::ConcurrentBitsetPtr& filter, int64_t n, int64_t k, bool ascending, float* distances,
+           int64_t* labels) {
+    float padding = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    for (int64_t i = 0; i < n; ++i) {
+        int64_t kept = 0;
+        for (int64_t j = 0; j < k; ++j) {
+            int64_t label = labels[i * k + j];
+            if (label != -1 && !filter->test(label)) {
+                labels[i * k + kept] = label;
+                distances[i * k + kept] = distances[i * k + j];
+                ++kept;
+            }
+        }
+        for (int64_t j = kept; j < k; ++j) {
+            labels[i * k + j] = -1;
+            distances[i * k + j] = padding;
+        }
+    }
+}
+
+bool
+InRadius(float distance, float radius, bool ascending) {
+    return ascending ? distance < radius : distance > radius;
+}
+
+// drop results out of radius, results are sorted so the rest stay in front
+void
+RadiusFilter(float radius, int64_t n, int64_t k, bool ascending, float* distances, int64_t* labels) {
+    float padding = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    for (int64_t i = 0; i < n * k; ++i) {
+        if (labels[i] != -1 && !InRadius(distances[i], radius, ascending)) {
+            labels[i] = -1;
+            distances[i] = padding;
+        }
+    }
+}
+
+constexpr int64_t RANGE_SEARCH_INITIAL_K = 16;
+
+// results per query of a range search on indexes without native support, the topk limit of gpu indexes
+constexpr int64_t EXPANDING_SEARCH_MAX_K = 2048;
+
+// candidates of a re-ranked search, the topk limit of gpu indexes
+constexpr int64_t RERANK_MAX_CANDIDATES = 2048;
+
+// range search for indexes without native support: search with growing k, only queries whose last result
+// is still within radius are searched again, until k reaches the limit, k is the row size of the results
+template <typename T>
+Status
+ExpandingSearch(const VecIndexPtr& index, int64_t n, const T* data, size_t row_size, int64_t k, float radius,
+                bool ascending, const faiss::ConcurrentBitsetPtr& bitset, milvus::json conf, float* distances,
+                int64_t* labels) {
+    float padding = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    std::vector<int64_t> pending(n);
+    std::iota(pending.begin(), pending.end(), 0);
+    std::vector<T> queries;
+    std::vector<float> round_distances;
+    std::vector<int64_t> round_labels;
+    int64_t max_k = std::min(k, EXPANDING_SEARCH_MAX_K);
+    int64_t round_k = std::min(max_k, RANGE_SEARCH_INITIAL_K);
+    while (!pending.empty()) {
+        int64_t nq = pending.size();
+        queries.resize(nq * row_size);
+        for (int64_t i = 0; i < nq; ++i) {
+            std::copy_n(data + pending[i] * row_size, row_size, queries.data() + i * row_size);
+        }
+        round_distances.resize(nq * round_k);
+        round_labels.resize(nq * round_k);
+        conf[knowhere::meta::TOPK] = round_k;
+        auto status = index->Search(nq, queries.data(), bitset, round_distances.data(), round_labels.data(), conf);
+        if (!status.ok()) {
+            return status;
+        }
+
+        std::vector<int64_t> next;
+        for (int64_t i = 0; i < nq; ++i) {
+            int64_t q = pending[i];
+            std::copy_n(round_distances.data() + i * round_k, round_k, distances + q * k);
+            std::copy_n(round_labels.data() + i * round_k, round_k, labels + q * k);
+            std::fill(distances + q * k + round_k, distances + (q + 1) * k, padding);
+            std::fill(labels + q * k + round_k, labels + (q + 1) * k, -1);
+
+            int64_t last = (i + 1) * round_k - 1;
+            if (round_k < max_k && round_labels[last] != -1 && InRadius(round_distances[last], radius, ascending)) {
+                next.push_back(q);
+            }
+        }
+        pending.swap(next);
+        round_k = std::min(max_k, round_k * 2);
+    }
+    return Status::OK();
+}
+
+Status
+RangeSearch(const VecIndexPtr& index, int64_t n, const float* data, size_t dim, int64_t k, float radius,
+            bool ascending, const faiss::ConcurrentBitsetPtr& bitset, milvus::json conf, float* distances,
+            int64_t* labels) {
+    if (!index->SupportRangeSearch()) {
+        return ExpandingSearch(index, n, data, dim, k, radius, ascending, bitset, conf, distances, labels);
+    }
+    conf[knowhere::meta::RADIUS] = radius;
+    return index->RangeSearch(n, data, bitset, distances, labels, conf);
+}
+
+// the engine may search more than the topk of the request, for the candidates of query groups or re-ranking,
+// hnsw searches max(ef, k) candidates anyway, so ef is raised to k instead of failing the ef >= k check
+void
+RaiseSearchEf(IndexType type, milvus::json& conf) {
+    if (type == IndexType::HNSW && conf.contains(knowhere::IndexParams::ef) &&
+        conf[knowhere::IndexParams::ef].is_number_integer() &&
+        conf[knowhere::IndexParams::ef].get<int64_t>() < conf[knowhere::meta::TOPK].get<int64_t>()) {
+        conf[knowhere::IndexParams::ef] = conf[knowhere::meta::TOPK];
+    }
+}
+
 }  // namespace
 
+class CachedAttrs : public cache::DataObj {
+ public:
+    explicit CachedAttrs(segment::AttrsPtr data) : data_(std::move(data)) {
+    }
+
+    const segment::Attrs&
+    Data() const {
+        return *data_;
+    }
+
+    int64_t
+    Size() override {
+        int64_t size = 0;
+        for (auto& pair : data_->attrs) {
+            size += pair.second->Size();
+        }
+        return size;
+    }
+
+ private:
+    segment::AttrsPtr data_;
+};
+
 class CachedQuantizer : public cache::DataObj {
  public:
     explicit CachedQuantizer(knowhere::QuantizerPtr data) : data_(std::move(data)) {
@@ -317,6 +476,9 @@ ExecutionEngineImpl::AddWithIds(int64_t n, const uint8_t* xdata, const int64_t*
 
 size_t
 ExecutionEngineImpl::Count() const {
+    if (block_reader_ != nullptr) {
+        return block_reader_->RowCount();
+    }
     if (index_ == nullptr) {
         ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, return count 0";
         return 0;
@@ -326,6 +488,13 @@ ExecutionEngineImpl::Count() const {
 
 size_t
 ExecutionEngineImpl::Size() const {
+    if (block_reader_ != nullptr) {
+        return block_reader_->RowCount() * block_reader_->RowBytes();
+    }
+    if (index_ == nullptr) {
+        ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, return size 0";
+        return 0;
+    }
     if (IsBinaryIndexType(index_->GetType())) {
         return (size_t)(Count() * Dimension() / 8);
     } else {
@@ -335,6 +504,9 @@ ExecutionEngineImpl::Size() const {
 
 size_t
 ExecutionEngineImpl::Dimension() const {
+    if (block_reader_ != nullptr) {
+        return dim_;
+    }
     if (index_ == nullptr) {
         ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, return dimension " << dim_;
         return dim_;
@@ -527,6 +699,30 @@ ExecutionEngineImpl::Load(bool to_cache) {
     return Status::OK();
 }  // namespace engine
 
+Status
+ExecutionEngineImpl::LoadForSearch() {
+    // binary vectors and index files are always loaded as a whole
+    if (index_type_ != EngineType::FAISS_IDMAP || (metric_type_ != MetricType::L2 && metric_type_ != MetricType::IP) ||
+        cache::CpuCacheMgr::GetInstance()->ItemExists(location_)) {
+        return Load(true);
+    }
+
+    auto block_reader = std::make_shared<RawBlockReader>(location_, dim_ * sizeof(float));
+    auto status = block_reader->Open();
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (block_reader->RowCount() * block_reader->RowBytes() <= RAW_BLOCK_SIZE) {
+        return Load(true);
+    }
+
+    ENGINE_LOG_DEBUG << "Search " << location_ << " by " << block_reader->BlockCount() << " blocks";
+    index_ = nullptr;
+    block_reader_ = block_reader;
+    return Status::OK();
+}
+
 Status
 ExecutionEngineImpl::CopyToGpu(uint64_t device_id, bool hybrid) {
 #if 0
@@ -587,6 +783,13 @@ ExecutionEngineImpl::CopyToGpu(uint64_t device_id, bool hybrid) {
     if (already_in_cache) {
         index_ = index;
     } else {
+        if (index_ == nullptr && block_reader_ != nullptr) {
+            // gpu searches the whole segment, load it without occupying cpu cache
+            auto status = Load(false);
+            if (!status.ok()) {
+                return status;
+            }
+        }
         if (index_ == nullptr) {
             ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, failed to copy to gpu";
             return Status(DB_ERROR, "index is null");
@@ -736,15 +939,60 @@ ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_t
     }
     ENGINE_LOG_DEBUG << "Index config: " << conf.dump();
 
+    auto& progress = BuildIndexProgress::GetInstance();
+    BuildIndexState state;
+    state.stage_ = BUILD_STAGE_TRAINING;
+    state.total_rows_ = Count();
+
     auto status = Status::OK();
     std::vector<segment::doc_id_t> uids;
     if (from_index) {
-        status = to_index->BuildAll(Count(), from_index->GetRawVectors(), from_index->GetRawIds(), conf);
+        // long builds save checkpoints beside the raw file, a build interrupted by a restart resumes from them
+        BuildCheckpoint checkpoint(location_, to_index->GetType(), conf);
+        BuildHooks hooks;
+        checkpoint.Restore(to_index, hooks);
+        if (hooks.resume_partial_) {
+            state.stage_ = BUILD_STAGE_ADDING;
+            state.built_rows_ = to_index->Count();
+        }
+        state.resumed_ = hooks.resume_partial_ || !hooks.model_.binary_map_.empty();
+        progress.Update(location_, state);
+
+        auto last_save = std::chrono::steady_clock::now();
+        hooks.trained_ = [&](const knowhere::BinarySet& model) {
+            auto save_status = checkpoint.SaveModel(model);
+            if (!save_status.ok()) {
+                ENGINE_LOG_WARNING << save_status.message();
+            }
+        };
+        hooks.progress_ = [&](int64_t rows_added) {
+            state.stage_ = BUILD_STAGE_ADDING;
+            state.built_rows_ = rows_added;
+            progress.Update(location_, state);
+
+            auto now = std::chrono::steady_clock::now();
+            if (rows_added < Count() &&
+                now - last_save >= std::chrono::seconds(BUILD_CHECKPOINT_INTERVAL_SEC)) {
+                auto save_status = checkpoint.SavePartial(to_index);
+                if (!save_status.ok()) {
+                    ENGINE_LOG_WARNING << save_status.message();
+                }
+                last_save = now;
+            }
+        };
+
+        status = to_index->BuildAllResumable(Count(), from_index->GetRawVectors(), from_index->GetRawIds(), conf,
+                                             hooks);
+        if (status.ok()) {
+            checkpoint.Remove();
+        }
         uids = from_index->GetUids();
     } else if (bin_from_index) {
+        progress.Update(location_, state);
         status = to_index->BuildAll(Count(), bin_from_index->GetRawVectors(), bin_from_index->GetRawIds(), conf);
         uids = bin_from_index->GetUids();
     }
+    progress.Remove(location_);
     to_index->SetUids(uids);
     ENGINE_LOG_DEBUG << "set uids " << to_index->GetUids().size() << " for " << location;
 
@@ -767,6 +1015,188 @@ MapUids(const std::vector<segment::doc_id_t>& uids, int64_t* labels, size_t num)
     }
 }
 
+Status
+ExecutionEngineImpl::SearchBlocks(int64_t n, const float* data, int64_t k, const faiss::ConcurrentBitsetPtr& filter,
+                                  float* distances, int64_t* labels) {
+    bool is_l2 = (metric_type_ == MetricType::L2);
+    for (int64_t i = 0; i < n; ++i) {
+        if (is_l2) {
+            faiss::maxheap_heapify(k, distances + i * k, labels + i * k);
+        } else {
+            faiss::minheap_heapify(k, distances + i * k, labels + i * k);
+        }
+    }
+
+    size_t block_count = block_reader_->BlockCount();
+    auto read_block = [this](size_t block_no) {
+        RawBlockPtr block;
+        auto status = block_reader_->GetBlock(block_no, block);
+        return std::make_pair(status, block);
+    };
+
+    // read next block while computing distances of current block
+    std::future<std::pair<Status, RawBlockPtr>> next = std::async(std::launch::async, read_block, 0);
+    std::vector<float> block_distances;
+    std::vector<int64_t> block_labels;
+    for (size_t block_no = 0; block_no < block_count; ++block_no) {
+        auto current = next.get();
+        if (!current.first.ok()) {
+            return current.first;
+        }
+        if (block_no + 1 < block_count) {
+            next = std::async(std::launch::async, read_block, block_no + 1);
+        }
+
+        size_t rows = block_reader_->BlockRows(block_no);
+        size_t bk = std::min<size_t>(k, rows);
+        block_distances.resize(n * bk);
+        block_labels.resize(n * bk);
+        int64_t block_begin = block_reader_->BlockBegin(block_no);
+        auto blacklist = block_reader_->BlockBlacklist(block_no);
+        if (filter != nullptr) {
+            auto block_filter = std::make_shared<faiss::ConcurrentBitset>(rows);
+            for (size_t row = 0; row < rows; ++row) {
+                if (filter->test(block_begin + row) || (blacklist != nullptr && blacklist->test(row))) {
+                    block_filter->set(row);
+                }
+            }
+            blacklist = block_filter;
+        }
+        auto block_data = reinterpret_cast<const float*>(current.second->Data());
+        if (is_l2) {
+            faiss::float_maxheap_array_t res = {(size_t)n, bk, block_labels.data(), block_distances.data()};
+            faiss::knn_L2sqr(data, block_data, dim_, n, rows, &res, blacklist);
+        } else {
+            faiss::float_minheap_array_t res = {(size_t)n, bk, block_labels.data(), block_distances.data()};
+            faiss::knn_inner_product(data, block_data, dim_, n, rows, &res, blacklist);
+        }
+
+        for (auto& label : block_labels) {
+            if (label != -1) {
+                label += block_begin;
+            }
+        }
+
+        for (int64_t i = 0; i < n; ++i) {
+            if (is_l2) {
+                faiss::maxheap_addn(k, distances + i * k, labels + i * k, block_distances.data() + i * bk,
+                                    block_labels.data() + i * bk, bk);
+            } else {
+                faiss::minheap_addn(k, distances + i * k, labels + i * k, block_distances.data() + i * bk,
+                                    block_labels.data() + i * bk, bk);
+            }
+        }
+    }
+
+    for (int64_t i = 0; i < n; ++i) {
+        if (is_l2) {
+            faiss::maxheap_reorder(k, distances + i * k, labels + i * k);
+        } else {
+            faiss::minheap_reorder(k, distances + i * k, labels + i * k);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::Rerank(int64_t n, const float* data, int64_t candidate_k, const int64_t* candidates, int64_t k,
+                            float* distances, int64_t* labels) {
+    RawBlockReader reader(location_, dim_ * sizeof(float));
+    auto status = reader.Open();
+    if (!status.ok()) {
+        return status;
+    }
+
+    bool ascending = (metric_type_ != MetricType::IP);
+    float padding = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    auto compare = [ascending](const std::pair<float, int64_t>& a, const std::pair<float, int64_t>& b) {
+        return ascending ? a.first < b.first : a.first > b.first;
+    };
+
+    std::vector<uint8_t> vector;
+    std::vector<std::pair<float, int64_t>> scored;
+    for (int64_t i = 0; i < n; ++i) {
+        const float* query = data + i * dim_;
+        scored.clear();
+        for (int64_t j = 0; j < candidate_k; ++j) {
+            int64_t offset = candidates[i * candidate_k + j];
+            if (offset == -1) {
+                continue;
+            }
+            status = reader.GetVector(offset, vector);
+            if (!status.ok()) {
+                return status;
+            }
+            auto raw = reinterpret_cast<const float*>(vector.data());
+            float distance =
+                ascending ? faiss::fvec_L2sqr(query, raw, dim_) : faiss::fvec_inner_product(query, raw, dim_);
+            scored.emplace_back(distance, offset);
+        }
+
+        int64_t count = std::min<int64_t>(k, scored.size());
+        std::partial_sort(scored.begin(), scored.begin() + count, scored.end(), compare);
+        for (int64_t j = 0; j < k; ++j) {
+            distances[i * k + j] = j < count ? scored[j].first : padding;
+            labels[i * k + j] = j < count ? scored[j].second : -1;
+        }
+    }
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::FilterBitset(const milvus::json& extra_params, int64_t row_count,
+                                  faiss::ConcurrentBitsetPtr& filter) {
+    filter = nullptr;
+    if (!extra_params.contains(ATTR_FILTER_KEY)) {
+        return Status::OK();
+    }
+    if (!extra_params[ATTR_FILTER_KEY].is_string()) {
+        return Status(DB_ERROR, "Filter expression must be a string");
+    }
+
+    AttrFilterPtr attr_filter;
+    auto status = AttrFilter::Parse(extra_params[ATTR_FILTER_KEY].get<std::string>(), attr_filter);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // attributes are never changed in place, deletion only marks deleted docs
+    std::string key = location_ + ".attrs";
+    auto attrs = std::static_pointer_cast<CachedAttrs>(cache::CpuCacheMgr::GetInstance()->GetIndex(key));
+    if (attrs == nullptr) {
+        std::string segment_dir;
+        utils::GetParentPath(location_, segment_dir);
+        segment::SegmentReader segment_reader(segment_dir);
+        segment::AttrsPtr attrs_ptr;
+        status = segment_reader.LoadAttrs(attrs_ptr);
+        if (!status.ok()) {
+            return status;
+        }
+        attrs = std::make_shared<CachedAttrs>(attrs_ptr);
+        cache::CpuCacheMgr::GetInstance()->InsertItem(key, attrs);
+    }
+
+    filter = attr_filter->Evaluate(attrs->Data(), row_count);
+    return Status::OK();
+}
+
+faiss::ConcurrentBitsetPtr
+ExecutionEngineImpl::SearchBitset(const faiss::ConcurrentBitsetPtr& filter, int64_t row_count) {
+    faiss::ConcurrentBitsetPtr blacklist;
+    index_->GetBlacklist(blacklist);
+    if (filter == nullptr || blacklist == nullptr) {
+        return filter;
+    }
+
+    auto bitset = std::make_shared<faiss::ConcurrentBitset>(row_count);
+    for (int64_t row = 0; row < row_count; ++row) {
+        if (filter->test(row) || blacklist->test(row)) {
+            bitset->set(row);
+        }
+    }
+    return bitset;
+}
+
 Status
 ExecutionEngineImpl::Search(int64_t n, const float* data, int64_t k, const milvus::json& extra_params, float* distances,
                             int64_t* labels, bool hybrid) {
@@ -824,13 +1254,62 @@ ExecutionEngineImpl::Search(int64_t n, const float* data, int64_t k, const milvu
 #endif
     TimeRecorder rc("ExecutionEngineImpl::Search float");
 
+    if (index_ == nullptr && block_reader_ != nullptr) {
+        faiss::ConcurrentBitsetPtr filter;
+        auto status = FilterBitset(extra_params, block_reader_->RowCount(), filter);
+        if (!status.ok()) {
+            return status;
+        }
+        status = SearchBlocks(n, data, k, filter, distances, labels);
+        if (extra_params.contains(RANGE_RADIUS_KEY)) {
+            RadiusFilter(extra_params[RANGE_RADIUS_KEY], n, k, metric_type_ != MetricType::IP, distances, labels);
+        }
+        rc.RecordSection("search " + std::to_string(block_reader_->BlockCount()) + " blocks done");
+        MapUids(block_reader_->Uids(), labels, n * k);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Search error:" << status.message();
+        }
+        return status;
+    }
+
     if (index_ == nullptr) {
         ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, failed to search";
         return Status(DB_ERROR, "index is null");
     }
 
+    faiss::ConcurrentBitsetPtr filter;
+    auto status = FilterBitset(extra_params, index_->Count(), filter);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // quantized and graph indexes search more candidates for re-ranking, RaiseSearchEf() lets hnsw return them,
+    // lossless indexes already give exact distances
+    int64_t search_k = k;
+    std::vector<float> candidate_distances;
+    std::vector<int64_t> candidate_labels;
+    float* search_distances = distances;
+    int64_t* search_labels = labels;
+    if (extra_params.contains(RERANK_KEY) && !IsLosslessIndexType(index_->GetType())) {
+        int64_t factor = extra_params[RERANK_KEY];
+        search_k = std::max(k, std::min(k * factor, RERANK_MAX_CANDIDATES));
+        candidate_distances.resize(n * search_k);
+        candidate_labels.resize(n * search_k);
+        search_distances = candidate_distances.data();
+        search_labels = candidate_labels.data();
+    }
+
     milvus::json conf = extra_params;
-    conf[knowhere::meta::TOPK] = k;
+    conf.erase(ATTR_FILTER_KEY);
+    conf.erase(RANGE_RADIUS_KEY);
+    conf.erase(RERANK_KEY);
+    conf.erase(SEGMENT_FRACTION_KEY);
+    conf[knowhere::meta::TOPK] = search_k;
+    if (extra_params.contains(RANGE_RADIUS_KEY) && !index_->SupportRangeSearch()) {
+        // ExpandingSearch() never asks the index for more than this
+        conf[knowhere::meta::TOPK] = std::min(search_k, EXPANDING_SEARCH_MAX_K);
+    }
+    RaiseSearchEf(index_->GetType(), conf);
     auto adapter = AdapterMgr::GetInstance().GetAdapter(index_->GetType());
     ENGINE_LOG_DEBUG << "Search params: " << conf.dump();
     if (!adapter->CheckSearch(conf, index_->GetType())) {
@@ -842,7 +1321,25 @@ ExecutionEngineImpl::Search(int64_t n, const float* data, int64_t k, const milvu
     }
 
     rc.RecordSection("search prepare");
-    auto status = index_->Search(n, data, distances, labels, conf);
+    bool ascending = (metric_type_ != MetricType::IP);
+    auto bitset = SearchBitset(filter, index_->Count());
+    if (extra_params.contains(RANGE_RADIUS_KEY)) {
+        float radius = extra_params[RANGE_RADIUS_KEY];
+        status = RangeSearch(index_, n, data, dim_, search_k, radius, ascending, bitset, conf, search_distances,
+                             search_labels);
+    } else {
+        status = index_->Search(n, data, bitset, search_distances, search_labels, conf);
+    }
+    if (filter != nullptr) {
+        PostFilter(filter, n, search_k, ascending, search_distances, search_labels);
+    }
+    if (status.ok() && search_k != k) {
+        rc.RecordSection("search " + std::to_string(search_k) + " candidates done");
+        status = Rerank(n, data, search_k, search_labels, k, distances, labels);
+    }
+    if (extra_params.contains(RANGE_RADIUS_KEY)) {
+        RadiusFilter(extra_params[RANGE_RADIUS_KEY], n, k, ascending, distances, labels);
+    }
     rc.RecordSection("search done");
 
     // map offsets to ids
@@ -871,8 +1368,19 @@ ExecutionEngineImpl::Search(int64_t n, const uint8_t* data, int64_t k, const mil
         return Status(DB_ERROR, "index is null");
     }
 
+    faiss::ConcurrentBitsetPtr filter;
+    auto status = FilterBitset(extra_params, index_->Count(), filter);
+    if (!status.ok()) {
+        return status;
+    }
+
     milvus::json conf = extra_params;
-    conf[knowhere::meta::TOPK] = k;
+    conf.erase(ATTR_FILTER_KEY);
+    conf.erase(RANGE_RADIUS_KEY);
+    conf.erase(RERANK_KEY);
+    conf.erase(SEGMENT_FRACTION_KEY);
+    conf[knowhere::meta::TOPK] = extra_params.contains(RANGE_RADIUS_KEY) ? std::min(k, EXPANDING_SEARCH_MAX_K) : k;
+    RaiseSearchEf(index_->GetType(), conf);
     auto adapter = AdapterMgr::GetInstance().GetAdapter(index_->GetType());
     ENGINE_LOG_DEBUG << "Search params: " << conf.dump();
     if (!adapter->CheckSearch(conf, index_->GetType())) {
@@ -884,7 +1392,20 @@ ExecutionEngineImpl::Search(int64_t n, const uint8_t* data, int64_t k, const mil
     }
 
     rc.RecordSection("search prepare");
-    auto status = index_->Search(n, data, distances, labels, conf);
+    bool ascending = (metric_type_ != MetricType::IP);
+    auto bitset = SearchBitset(filter, index_->Count());
+    if (extra_params.contains(RANGE_RADIUS_KEY)) {
+        float radius = extra_params[RANGE_RADIUS_KEY];
+        status = ExpandingSearch(index_, n, data, dim_ / 8, k, radius, ascending, bitset, conf, distances, labels);
+    } else {
+        status = index_->Search(n, data, bitset, distances, labels, conf);
+    }
+    if (filter != nullptr) {
+        PostFilter(filter, n, k, ascending, distances, labels);
+    }
+    if (extra_params.contains(RANGE_RADIUS_KEY)) {
+        RadiusFilter(extra_params[RANGE_RADIUS_KEY], n, k, ascending, distances, labels);
+    }
     rc.RecordSection("search done");
 
     // map offsets to ids
@@ -908,13 +1429,63 @@ ExecutionEngineImpl::Search(int64_t n, const std::vector<int64_t>& ids, int64_t
                             float* distances, int64_t* labels, bool hybrid) {
     TimeRecorder rc("ExecutionEngineImpl::Search vector of ids");
 
+    if (index_ == nullptr && block_reader_ != nullptr) {
+        std::vector<float> queries;
+        const std::vector<segment::doc_id_t>& uids = block_reader_->Uids();
+        for (auto& id : ids) {
+            auto found = std::find(uids.begin(), uids.end(), id);
+            if (found != uids.end()) {
+                std::vector<uint8_t> vector;
+                auto status = block_reader_->GetVector(std::distance(uids.begin(), found), vector);
+                if (!status.ok()) {
+                    return status;
+                }
+                auto begin = reinterpret_cast<const float*>(vector.data());
+                queries.insert(queries.end(), begin, begin + dim_);
+            }
+        }
+        rc.RecordSection("get vectors");
+
+        faiss::ConcurrentBitsetPtr filter;
+        auto status = FilterBitset(extra_params, block_reader_->RowCount(), filter);
+        if (!status.ok()) {
+            return status;
+        }
+
+        int64_t nq = queries.size() / dim_;
+        if (nq > 0) {
+            status = SearchBlocks(nq, queries.data(), k, filter, distances, labels);
+            if (extra_params.contains(RANGE_RADIUS_KEY)) {
+                RadiusFilter(extra_params[RANGE_RADIUS_KEY], nq, k, metric_type_ != MetricType::IP, distances,
+                             labels);
+            }
+            MapUids(uids, labels, nq * k);
+            rc.RecordSection("search " + std::to_string(block_reader_->BlockCount()) + " blocks done");
+        }
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Search error:" << status.message();
+        }
+        return status;
+    }
+
     if (index_ == nullptr) {
         ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, failed to search";
         return Status(DB_ERROR, "index is null");
     }
 
+    faiss::ConcurrentBitsetPtr filter;
+    auto status = FilterBitset(extra_params, index_->Count(), filter);
+    if (!status.ok()) {
+        return status;
+    }
+
     milvus::json conf = extra_params;
+    conf.erase(ATTR_FILTER_KEY);
+    conf.erase(RANGE_RADIUS_KEY);
+    conf.erase(RERANK_KEY);
+    conf.erase(SEGMENT_FRACTION_KEY);
     conf[knowhere::meta::TOPK] = k;
+    RaiseSearchEf(index_->GetType(), conf);
     auto adapter = AdapterMgr::GetInstance().GetAdapter(index_->GetType());
     ENGINE_LOG_DEBUG << "Search params: " << conf.dump();
     if (!adapter->CheckSearch(conf, index_->GetType())) {
@@ -966,9 +1537,16 @@ ExecutionEngineImpl::Search(int64_t n, const std::vector<int64_t>& ids, int64_t
 
     rc.RecordSection("get offset");
 
-    auto status = Status::OK();
     if (!offsets.empty()) {
+        // search by id has no bitset of its own, filtered rows are dropped from results
         status = index_->SearchById(offsets.size(), offsets.data(), distances, labels, conf);
+        if (filter != nullptr) {
+            PostFilter(filter, offsets.size(), k, metric_type_ != MetricType::IP, distances, labels);
+        }
+        if (extra_params.contains(RANGE_RADIUS_KEY)) {
+            RadiusFilter(extra_params[RANGE_RADIUS_KEY], offsets.size(), k, metric_type_ != MetricType::IP, distances,
+                         labels);
+        }
         rc.RecordSection("search done");
 
         // map offsets to ids
@@ -1040,6 +1618,48 @@ ExecutionEngineImpl::GetVectorByID(const int64_t& id, uint8_t* vector, bool hybr
     return status;
 }
 
+Status
+ExecutionEngineImpl::GetVectorByIdFromCache(const int64_t& id, std::vector<uint8_t>& vector, bool& cached) {
+    cached = false;
+    vector.clear();
+
+    // the cached index is shared by concurrent searches, ivf indexes build their direct map on the first
+    // reconstruction without a lock, so only flat indexes are read here and ivf ones fall back to the raw file
+    auto index = std::static_pointer_cast<VecIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(location_));
+    if (index == nullptr ||
+        (index->GetType() != IndexType::FAISS_IDMAP && index->GetType() != IndexType::FAISS_BIN_IDMAP)) {
+        return Status::OK();
+    }
+    cached = true;
+
+    const std::vector<segment::doc_id_t>& uids = index->GetUids();
+    auto found = std::find(uids.begin(), uids.end(), id);
+    if (found == uids.end()) {
+        return Status::OK();
+    }
+
+    int64_t offset = std::distance(uids.begin(), found);
+    faiss::ConcurrentBitsetPtr blacklist;
+    index->GetBlacklist(blacklist);
+    if (blacklist != nullptr && blacklist->test(offset)) {
+        return Status::OK();
+    }
+
+    Status status;
+    if (IsBinaryIndexType(index->GetType())) {
+        vector.resize(dim_ / 8);
+        status = index->GetVectorById(1, &offset, vector.data());
+    } else {
+        vector.resize(dim_ * sizeof(float));
+        status = index->GetVectorById(1, &offset, reinterpret_cast<float*>(vector.data()));
+    }
+    if (!status.ok()) {
+        vector.clear();
+        ENGINE_LOG_ERROR << "Failed to get vector from cached index " << location_ << ": " << status.message();
+    }
+    return status;
+}
+
 Status
 ExecutionEngineImpl::Cache() {
     cache::DataObjPtr obj = std::static_pointer_cast<cache::DataObj>(index_);
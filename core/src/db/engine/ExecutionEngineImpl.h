@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "ExecutionEngine.h"
+#include "db/engine/RawBlockReader.h"
 #include "wrapper/VecIndex.h"
 
 namespace milvus {
@@ -56,6 +57,9 @@ class ExecutionEngineImpl : public ExecutionEngine {
     Status
     Load(bool to_cache) override;
 
+    Status
+    LoadForSearch() override;
+
     Status
     CopyToGpu(uint64_t device_id, bool hybrid = false) override;
 
@@ -77,6 +81,9 @@ class ExecutionEngineImpl : public ExecutionEngine {
     Status
     GetVectorByID(const int64_t& id, uint8_t* vector, bool hybrid) override;
 
+    Status
+    GetVectorByIdFromCache(const int64_t& id, std::vector<uint8_t>& vector, bool& cached) override;
+
     Status
     Search(int64_t n, const float* data, int64_t k, const milvus::json& extra_params, float* distances, int64_t* labels,
            bool hybrid = false) override;
@@ -129,8 +136,27 @@ class ExecutionEngineImpl : public ExecutionEngine {
     void
     HybridUnset() const;
 
+    // brute force search over raw blocks, labels are offsets in segment
+    Status
+    SearchBlocks(int64_t n, const float* data, int64_t k, const faiss::ConcurrentBitsetPtr& filter, float* distances,
+                 int64_t* labels);
+
+    // exact distances of candidate offsets from raw vectors, keep the best k per query
+    Status
+    Rerank(int64_t n, const float* data, int64_t candidate_k, const int64_t* candidates, int64_t k, float* distances,
+           int64_t* labels);
+
+    // rows not matching the attribute filter of search params are set, nullptr if there is no filter
+    Status
+    FilterBitset(const milvus::json& extra_params, int64_t row_count, faiss::ConcurrentBitsetPtr& filter);
+
+    // rows either filtered out or deleted, nullptr if there is no filter
+    faiss::ConcurrentBitsetPtr
+    SearchBitset(const faiss::ConcurrentBitsetPtr& filter, int64_t row_count);
+
  protected:
     VecIndexPtr index_ = nullptr;
+    RawBlockReaderPtr block_reader_ = nullptr;  // set instead of index_ when searching by blocks
     EngineType index_type_;
     MetricType metric_type_;
 
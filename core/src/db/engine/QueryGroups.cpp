@@ -0,0 +1,78 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/engine/QueryGroups.h"
+
+#include "utils/Error.h"
+
+namespace milvus {
+namespace engine {
+
+Status
+QueryGroups::Parse(const milvus::json& search_params, uint64_t nq, QueryGroupsPtr& groups) {
+    groups = nullptr;
+    if (!search_params.contains(QUERY_GROUPS_KEY)) {
+        return Status::OK();
+    }
+
+    auto& spec = search_params[QUERY_GROUPS_KEY];
+    if (!spec.is_object() || !spec.contains("groups") || !spec["groups"].is_array() || spec["groups"].empty()) {
+        return Status(DB_ERROR, "Invalid multi_vector params: groups must be a non-empty array of query counts");
+    }
+
+    QueryGroupsPtr result(new QueryGroups());
+    result->offsets_.push_back(0);
+    for (auto& count : spec["groups"]) {
+        if (!count.is_number_integer() || count.get<int64_t>() <= 0) {
+            return Status(DB_ERROR, "Invalid multi_vector params: query count of a group must be a positive integer");
+        }
+        result->offsets_.push_back(result->offsets_.back() + count.get<uint64_t>());
+    }
+    if (result->offsets_.back() != nq) {
+        return Status(DB_ERROR, "Invalid multi_vector params: groups hold " + std::to_string(result->offsets_.back()) +
+                                    " queries but " + std::to_string(nq) + " query vectors are given");
+    }
+
+    std::string aggregation = "sum";
+    if (spec.contains("aggregation")) {
+        if (!spec["aggregation"].is_string()) {
+            return Status(DB_ERROR, "Invalid multi_vector params: aggregation must be sum, weighted or max");
+        }
+        aggregation = spec["aggregation"].get<std::string>();
+    }
+    if (aggregation == "sum") {
+        result->aggregation_ = Aggregation::SUM;
+    } else if (aggregation == "weighted") {
+        result->aggregation_ = Aggregation::WEIGHTED;
+    } else if (aggregation == "max") {
+        result->aggregation_ = Aggregation::MAX;
+    } else {
+        return Status(DB_ERROR, "Invalid multi_vector params: aggregation must be sum, weighted or max");
+    }
+
+    if (result->aggregation_ == Aggregation::WEIGHTED) {
+        if (!spec.contains("weights") || !spec["weights"].is_array() || spec["weights"].size() != nq) {
+            return Status(DB_ERROR, "Invalid multi_vector params: weighted aggregation needs one weight per query");
+        }
+        for (auto& weight : spec["weights"]) {
+            if (!weight.is_number()) {
+                return Status(DB_ERROR, "Invalid multi_vector params: weight must be a number");
+            }
+            result->weights_.push_back(weight.get<float>());
+        }
+    }
+
+    groups = result;
+    return Status::OK();
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,78 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/Json.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace engine {
+
+// key of the multi-vector search spec in search parameters
+static const char* QUERY_GROUPS_KEY = "multi_vector";
+
+class QueryGroups;
+using QueryGroupsPtr = std::shared_ptr<QueryGroups>;
+
+/*
+ * Query vectors searched as groups, one group per entity with several embeddings, for example
+ * {"groups": [2, 3], "aggregation": "weighted", "weights": [0.7, 0.3, 1, 1, 1]}.
+ * Every query is searched for more candidates than topk, then the distances of an id are aggregated over the
+ * queries of its group and each group gets one topk list:
+ *   "sum"      sum of distances, a query which didn't hit the id contributes its worst candidate distance
+ *   "weighted" the same as sum, each distance multiplied by the weight of its query
+ *   "max"      the best distance among the queries which hit the id
+ */
+class QueryGroups {
+ public:
+    enum class Aggregation { SUM, WEIGHTED, MAX };
+
+    // groups is nullptr when the search parameters have no query groups
+    static Status
+    Parse(const milvus::json& search_params, uint64_t nq, QueryGroupsPtr& groups);
+
+    size_t
+    GroupCount() const {
+        return offsets_.size() - 1;
+    }
+
+    // group i holds queries [GroupBegin(i), GroupBegin(i + 1))
+    uint64_t
+    GroupBegin(size_t group) const {
+        return offsets_[group];
+    }
+
+    Aggregation
+    GetAggregation() const {
+        return aggregation_;
+    }
+
+    float
+    Weight(uint64_t query) const {
+        return aggregation_ == Aggregation::WEIGHTED ? weights_[query] : 1.0f;
+    }
+
+ private:
+    QueryGroups() = default;
+
+ private:
+    std::vector<uint64_t> offsets_;
+    std::vector<float> weights_;
+    Aggregation aggregation_ = Aggregation::SUM;
+};
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,156 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/engine/RawBlockReader.h"
+
+#include <algorithm>
+
+#include "cache/CpuCacheMgr.h"
+#include "db/Utils.h"
+#include "segment/SegmentReader.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+std::string
+BlockKey(const std::string& location, size_t block_no) {
+    return location + ".block_" + std::to_string(block_no);
+}
+
+std::string
+UidsKey(const std::string& location) {
+    return location + ".uids";
+}
+
+size_t
+BlockRowsOf(size_t row_bytes) {
+    return std::max<size_t>(1, RAW_BLOCK_SIZE / row_bytes);
+}
+
+}  // namespace
+
+RawBlockReader::RawBlockReader(const std::string& location, size_t row_bytes)
+    : location_(location), row_bytes_(row_bytes) {
+    utils::GetParentPath(location_, segment_dir_);
+    block_rows_ = BlockRowsOf(row_bytes_);
+}
+
+Status
+RawBlockReader::Open() {
+    segment::SegmentReader segment_reader(segment_dir_);
+
+    uids_ = std::static_pointer_cast<RawUids>(cache::CpuCacheMgr::GetInstance()->GetIndex(UidsKey(location_)));
+    if (uids_ == nullptr) {
+        std::vector<segment::doc_id_t> uids;
+        auto status = segment_reader.LoadUids(uids);
+        if (!status.ok()) {
+            return status;
+        }
+        uids_ = std::make_shared<RawUids>(std::move(uids), row_bytes_);
+        cache::CpuCacheMgr::GetInstance()->InsertItem(UidsKey(location_), uids_);
+    }
+
+    segment::DeletedDocsPtr deleted_docs_ptr;
+    auto status = segment_reader.LoadDeletedDocs(deleted_docs_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+    deleted_docs_ = deleted_docs_ptr->GetDeletedDocs();
+    std::sort(deleted_docs_.begin(), deleted_docs_.end());
+
+    return Status::OK();
+}
+
+size_t
+RawBlockReader::BlockCount() const {
+    return (RowCount() + block_rows_ - 1) / block_rows_;
+}
+
+size_t
+RawBlockReader::BlockRows(size_t block_no) const {
+    size_t begin = BlockBegin(block_no);
+    return std::min(block_rows_, RowCount() - begin);
+}
+
+Status
+RawBlockReader::GetBlock(size_t block_no, RawBlockPtr& block) {
+    auto key = BlockKey(location_, block_no);
+    block = std::static_pointer_cast<RawBlock>(cache::CpuCacheMgr::GetInstance()->GetIndex(key));
+    if (block != nullptr) {
+        return Status::OK();
+    }
+
+    std::vector<uint8_t> data;
+    segment::SegmentReader segment_reader(segment_dir_);
+    auto status = segment_reader.LoadVectors(BlockBegin(block_no) * row_bytes_, BlockRows(block_no) * row_bytes_, data);
+    if (!status.ok()) {
+        return status;
+    }
+
+    block = std::make_shared<RawBlock>(std::move(data));
+    cache::CpuCacheMgr::GetInstance()->InsertItem(key, block);
+    return Status::OK();
+}
+
+faiss::ConcurrentBitsetPtr
+RawBlockReader::BlockBlacklist(size_t block_no) const {
+    auto begin = (segment::offset_t)BlockBegin(block_no);
+    auto end = (segment::offset_t)(BlockBegin(block_no) + BlockRows(block_no));
+    auto lower = std::lower_bound(deleted_docs_.begin(), deleted_docs_.end(), begin);
+    auto upper = std::lower_bound(lower, deleted_docs_.end(), end);
+    if (lower == upper) {
+        return nullptr;
+    }
+
+    auto blacklist = std::make_shared<faiss::ConcurrentBitset>(BlockRows(block_no));
+    for (auto iter = lower; iter != upper; ++iter) {
+        blacklist->set(*iter - begin);
+    }
+    return blacklist;
+}
+
+Status
+RawBlockReader::GetVector(size_t offset, std::vector<uint8_t>& vector) {
+    RawBlockPtr block;
+    size_t block_no = offset / block_rows_;
+    auto status = GetBlock(block_no, block);
+    if (!status.ok()) {
+        return status;
+    }
+
+    const uint8_t* row = block->Data() + (offset - BlockBegin(block_no)) * row_bytes_;
+    vector.assign(row, row + row_bytes_);
+    return Status::OK();
+}
+
+void
+RawBlockReader::EraseFromCache(const std::string& location) {
+    // blocks are only read after Open cached the uids, and every search touches the uids again,
+    // so blocks outliving the uids entry are already at the cold end of the cache
+    auto cache = cache::CpuCacheMgr::GetInstance();
+    auto uids = std::static_pointer_cast<RawUids>(cache->GetIndex(UidsKey(location)));
+    if (uids == nullptr) {
+        return;
+    }
+
+    size_t block_rows = BlockRowsOf(uids->RowBytes());
+    size_t block_count = (uids->Uids().size() + block_rows - 1) / block_rows;
+    for (size_t block_no = 0; block_no < block_count; ++block_no) {
+        cache->EraseItem(BlockKey(location, block_no));
+    }
+    cache->EraseItem(UidsKey(location));
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,148 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <faiss/utils/ConcurrentBitset.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cache/DataObj.h"
+#include "db/Constants.h"
+#include "segment/Types.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace engine {
+
+// raw vectors larger than one block are searched block by block instead of being loaded as a whole
+static constexpr uint64_t RAW_BLOCK_SIZE = 64 * ONE_MB;
+
+class RawBlock : public cache::DataObj {
+ public:
+    explicit RawBlock(std::vector<uint8_t>&& data) : data_(std::move(data)) {
+    }
+
+    const uint8_t*
+    Data() const {
+        return data_.data();
+    }
+
+    int64_t
+    Size() override {
+        return data_.size();
+    }
+
+ private:
+    std::vector<uint8_t> data_;
+};
+
+using RawBlockPtr = std::shared_ptr<RawBlock>;
+
+class RawUids : public cache::DataObj {
+ public:
+    RawUids(std::vector<segment::doc_id_t>&& uids, size_t row_bytes) : uids_(std::move(uids)), row_bytes_(row_bytes) {
+    }
+
+    const std::vector<segment::doc_id_t>&
+    Uids() const {
+        return uids_;
+    }
+
+    // kept so the blocks of the file can be found in cache without the table schema
+    size_t
+    RowBytes() const {
+        return row_bytes_;
+    }
+
+    int64_t
+    Size() override {
+        return uids_.size() * sizeof(segment::doc_id_t);
+    }
+
+ private:
+    std::vector<segment::doc_id_t> uids_;
+    size_t row_bytes_;
+};
+
+using RawUidsPtr = std::shared_ptr<RawUids>;
+
+/*
+ * Reads the raw vector file of a segment in fixed-size blocks. Blocks are kept in cpu cache under
+ * "<location>.block_<n>" so only hot blocks stay in memory, uids are cached under "<location>.uids".
+ * Deleted docs are not cached since deletion rewrites them in place.
+ */
+class RawBlockReader {
+ public:
+    RawBlockReader(const std::string& location, size_t row_bytes);
+
+    // load uids and deleted docs, must be called before any other method
+    Status
+    Open();
+
+    size_t
+    RowCount() const {
+        return uids_->Uids().size();
+    }
+
+    size_t
+    RowBytes() const {
+        return row_bytes_;
+    }
+
+    const std::vector<segment::doc_id_t>&
+    Uids() const {
+        return uids_->Uids();
+    }
+
+    size_t
+    BlockCount() const;
+
+    size_t
+    BlockBegin(size_t block_no) const {
+        return block_no * block_rows_;
+    }
+
+    size_t
+    BlockRows(size_t block_no) const;
+
+    // read from cache, or from disk and put into cache
+    Status
+    GetBlock(size_t block_no, RawBlockPtr& block);
+
+    // deleted docs inside the block, offset by block begin, nullptr if none
+    faiss::ConcurrentBitsetPtr
+    BlockBlacklist(size_t block_no) const;
+
+    Status
+    GetVector(size_t offset, std::vector<uint8_t>& vector);
+
+    // erase the cached uids and blocks of the raw file at location, when the file is deleted
+    static void
+    EraseFromCache(const std::string& location);
+
+ private:
+    std::string location_;
+    std::string segment_dir_;
+    size_t row_bytes_;
+    size_t block_rows_;
+
+    RawUidsPtr uids_;
+    std::vector<segment::offset_t> deleted_docs_;  // sorted
+};
+
+using RawBlockReaderPtr = std::shared_ptr<RawBlockReader>;
+
+}  // namespace engine
+}  // namespace milvus
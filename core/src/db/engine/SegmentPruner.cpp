@@ -0,0 +1,144 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#include "db/engine/SegmentPruner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cache/CpuCacheMgr.h"
+#include "db/Utils.h"
+#include "db/engine/ExecutionEngine.h"
+#include "segment/SegmentReader.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+// a segment without summary is cached too, so it isn't looked up on disk again
+class CachedSummary : public cache::DataObj {
+ public:
+    explicit CachedSummary(segment::SummaryPtr summary) : summary_(std::move(summary)) {
+    }
+
+    const segment::SummaryPtr&
+    Summary() const {
+        return summary_;
+    }
+
+    int64_t
+    Size() override {
+        return sizeof(*this) + (summary_ == nullptr ? 0 : summary_->Size());
+    }
+
+ private:
+    segment::SummaryPtr summary_;
+};
+
+std::string
+SummaryKey(const std::string& segment_dir) {
+    return segment_dir + ".summary";
+}
+
+segment::SummaryPtr
+GetSummary(const meta::TableFileSchema& file) {
+    std::string segment_dir;
+    utils::GetParentPath(file.location_, segment_dir);
+    auto key = SummaryKey(segment_dir);
+
+    auto cached = std::static_pointer_cast<CachedSummary>(cache::CpuCacheMgr::GetInstance()->GetIndex(key));
+    if (cached == nullptr) {
+        segment::SummaryPtr summary;
+        segment::SegmentReader segment_reader(segment_dir);
+        if (!segment_reader.LoadSummary(summary).ok()) {
+            return nullptr;  // not cached, a broken file may be rewritten by a later merge
+        }
+        cached = std::make_shared<CachedSummary>(summary);
+        cache::CpuCacheMgr::GetInstance()->InsertItem(key, cached);
+    }
+    return cached->Summary();
+}
+
+}  // namespace
+
+Status
+SegmentPruner::Prune(const milvus::json& extra_params, const VectorsData& vectors, meta::TableFilesSchema& files) {
+    if (!extra_params.contains(SEGMENT_FRACTION_KEY) || !extra_params[SEGMENT_FRACTION_KEY].is_number()) {
+        return Status::OK();
+    }
+    double fraction = extra_params[SEGMENT_FRACTION_KEY];
+    if (fraction >= 1.0 || files.size() <= 1 || vectors.float_data_.empty() || vectors.vector_count_ == 0) {
+        return Status::OK();
+    }
+
+    // only the files with a summary of the query dimension take part in the ranking
+    size_t dimension = vectors.float_data_.size() / vectors.vector_count_;
+    std::vector<size_t> ranked;
+    std::vector<segment::SummaryPtr> summaries(files.size());
+    std::vector<bool> keep(files.size(), true);
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (utils::IsBinaryMetricType(files[i].metric_type_)) {
+            continue;
+        }
+        summaries[i] = GetSummary(files[i]);
+        if (summaries[i] != nullptr && summaries[i]->GetDimension() == (int64_t)dimension) {
+            ranked.push_back(i);
+            keep[i] = false;
+        }
+    }
+
+    auto top = std::max<size_t>(1, (size_t)std::ceil(fraction * ranked.size()));
+    if (top >= ranked.size()) {
+        return Status::OK();
+    }
+
+    // smaller score is better, L2 takes the distance bound and IP the negative similarity bound
+    std::vector<std::pair<float, size_t>> scores(ranked.size());
+    for (uint64_t q = 0; q < vectors.vector_count_; ++q) {
+        const float* query = vectors.float_data_.data() + q * dimension;
+        for (size_t j = 0; j < ranked.size(); ++j) {
+            auto i = ranked[j];
+            bool ip = files[i].metric_type_ == (int32_t)MetricType::IP;
+            float score = ip ? -summaries[i]->MaxInnerProduct(query) : summaries[i]->MinL2Distance(query);
+            scores[j] = std::make_pair(score, i);
+        }
+        std::nth_element(scores.begin(), scores.begin() + top, scores.end());
+        for (size_t j = 0; j < top; ++j) {
+            keep[scores[j].second] = true;
+        }
+    }
+
+    meta::TableFilesSchema kept;
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (keep[i]) {
+            kept.emplace_back(std::move(files[i]));
+        }
+    }
+    ENGINE_LOG_DEBUG << "Segment pruning keeps " << kept.size() << " of " << files.size() << " files";
+    files.swap(kept);
+
+    return Status::OK();
+}
+
+void
+SegmentPruner::EraseFromCache(const std::string& segment_dir) {
+    cache::CpuCacheMgr::GetInstance()->EraseItem(SummaryKey(segment_dir));
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,46 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#pragma once
+
+#include <string>
+
+#include "db/Types.h"
+#include "db/meta/MetaTypes.h"
+#include "utils/Json.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace engine {
+
+// key of the fraction of segments to search in search parameters, within (0, 1], all segments by default
+static const char* SEGMENT_FRACTION_KEY = "segment_fraction";
+
+/*
+ * Ranks the segments of a float table by the distance bound of their summary to each query and keeps the
+ * top fraction for every query, so a small query doesn't schedule a task per segment. Vectors outside the
+ * kept segments are not searched, recall drops in exchange for fewer tasks.
+ * Summaries are cached in cpu cache under "<segment dir>.summary".
+ */
+class SegmentPruner {
+ public:
+    // files without summary are always kept, nothing is pruned without SEGMENT_FRACTION_KEY
+    static Status
+    Prune(const milvus::json& extra_params, const VectorsData& vectors, meta::TableFilesSchema& files);
+
+    // erase the cached summary of a segment, when the segment is deleted
+    static void
+    EraseFromCache(const std::string& segment_dir);
+};
+
+}  // namespace engine
+}  // namespace milvus
@@ -25,11 +25,13 @@ class MemManager {
  public:
     virtual Status
     InsertVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
-                  const float* vectors, uint64_t lsn, std::set<std::string>& flushed_tables) = 0;
+                  const float* vectors, const segment::Attrs& attrs, uint64_t lsn,
+                  std::set<std::string>& flushed_tables) = 0;
 
     virtual Status
     InsertVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
-                  const uint8_t* vectors, uint64_t lsn, std::set<std::string>& flushed_tables) = 0;
+                  const uint8_t* vectors, const segment::Attrs& attrs, uint64_t lsn,
+                  std::set<std::string>& flushed_tables) = 0;
 
     virtual Status
     DeleteVector(const std::string& table_id, IDNumber vector_id, uint64_t lsn) = 0;
@@ -33,7 +33,8 @@ MemManagerImpl::GetMemByTable(const std::string& table_id) {
 
 Status
 MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
-                              const float* vectors, uint64_t lsn, std::set<std::string>& flushed_tables) {
+                              const float* vectors, const segment::Attrs& attrs, uint64_t lsn,
+                              std::set<std::string>& flushed_tables) {
     flushed_tables.clear();
     if (GetCurrentMem() > options_.insert_buffer_size_) {
         ENGINE_LOG_DEBUG << "Insert buffer size exceeds limit. Performing force flush";
@@ -50,6 +51,7 @@ MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const
     memcpy(vectors_data.float_data_.data(), vectors, length * dim * sizeof(float));
     vectors_data.id_array_.resize(length);
     memcpy(vectors_data.id_array_.data(), vector_ids, length * sizeof(IDNumber));
+    vectors_data.attrs_ = attrs;
     VectorSourcePtr source = std::make_shared<VectorSource>(vectors_data);
 
     std::unique_lock<std::mutex> lock(mutex_);
@@ -59,7 +61,8 @@ MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const
 
 Status
 MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
-                              const uint8_t* vectors, uint64_t lsn, std::set<std::string>& flushed_tables) {
+                              const uint8_t* vectors, const segment::Attrs& attrs, uint64_t lsn,
+                              std::set<std::string>& flushed_tables) {
     flushed_tables.clear();
     if (GetCurrentMem() > options_.insert_buffer_size_) {
         ENGINE_LOG_DEBUG << "Insert buffer size exceeds limit. Performing force flush";
@@ -76,6 +79,7 @@ MemManagerImpl::InsertVectors(const std::string& table_id, int64_t length, const
     memcpy(vectors_data.binary_data_.data(), vectors, length * dim * sizeof(uint8_t));
     vectors_data.id_array_.resize(length);
     memcpy(vectors_data.id_array_.data(), vector_ids, length * sizeof(IDNumber));
+    vectors_data.attrs_ = attrs;
     VectorSourcePtr source = std::make_shared<VectorSource>(vectors_data);
 
     std::unique_lock<std::mutex> lock(mutex_);
@@ -42,11 +42,13 @@ class MemManagerImpl : public MemManager, public server::CacheConfigHandler {
 
     Status
     InsertVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
-                  const float* vectors, uint64_t lsn, std::set<std::string>& flushed_tables) override;
+                  const float* vectors, const segment::Attrs& attrs, uint64_t lsn,
+                  std::set<std::string>& flushed_tables) override;
 
     Status
     InsertVectors(const std::string& table_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
-                  const uint8_t* vectors, uint64_t lsn, std::set<std::string>& flushed_tables) override;
+                  const uint8_t* vectors, const segment::Attrs& attrs, uint64_t lsn,
+                  std::set<std::string>& flushed_tables) override;
 
     Status
     DeleteVector(const std::string& table_id, IDNumber vector_id, uint64_t lsn) override;
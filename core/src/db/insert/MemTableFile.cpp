@@ -39,6 +39,9 @@ MemTableFile::MemTableFile(const std::string& table_id, const meta::MetaPtr& met
         std::string directory;
         utils::GetParentPath(table_file_schema_.location_, directory);
         segment_writer_ptr_ = std::make_shared<segment::SegmentWriter>(directory);
+        if (!utils::IsBinaryMetricType(table_file_schema_.metric_type_)) {
+            segment_writer_ptr_->EnableSummary(table_file_schema_.dimension_);
+        }
     }
 
     SetIdentity("MemTableFile");
@@ -99,6 +102,9 @@ MemTableFile::Delete(segment::doc_id_t doc_id) {
     if (found != uids.end()) {
         auto offset = std::distance(uids.begin(), found);
         segment_ptr->vectors_ptr_->Erase(offset);
+        for (auto& pair : segment_ptr->attrs_ptr_->attrs) {
+            pair.second->Erase(offset);
+        }
     }
 
     return Status::OK();
@@ -124,6 +130,9 @@ MemTableFile::Delete(const std::vector<segment::doc_id_t>& doc_ids) {
     for (size_t i = 0; i < loop; ++i) {
         if (std::binary_search(temp.begin(), temp.end(), uids[i])) {
             segment_ptr->vectors_ptr_->Erase(i - deleted);
+            for (auto& pair : segment_ptr->attrs_ptr_->attrs) {
+                pair.second->Erase(i - deleted);
+            }
             ++deleted;
         }
     }
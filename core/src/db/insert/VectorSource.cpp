@@ -80,6 +80,10 @@ VectorSource::Add(/*const ExecutionEnginePtr& execution_engine,*/ const segment:
         status = segment_writer_ptr->AddVectors(table_file_schema.file_id_, vectors, vector_ids_to_add);
     }
 
+    if (status.ok() && !vectors_.attrs_.attrs.empty()) {
+        status = segment_writer_ptr->AddAttrs(vectors_.attrs_, current_num_vectors_added, num_vectors_added);
+    }
+
     // Clear vector data
     if (status.ok()) {
         current_num_vectors_added += num_vectors_added;
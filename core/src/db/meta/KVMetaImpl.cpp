@@ -0,0 +1,1476 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/meta/KVMetaImpl.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fiu-local.h>
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include "MetaConsts.h"
+#include "db/IDGenerator.h"
+#include "db/OngoingFileChecker.h"
+#include "db/Utils.h"
+#include "db/engine/RawBlockReader.h"
+#include "db/engine/SegmentPruner.h"
+#include "metrics/Metrics.h"
+#include "utils/CommonUtil.h"
+#include "utils/Exception.h"
+#include "utils/Log.h"
+#include "utils/StringHelpFunctions.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+namespace {
+
+constexpr uint64_t COMPACT_MIN_RECORDS = 4096;
+constexpr uint64_t COMPACT_GARBAGE_RATIO = 4;  // compact when manifest holds 4x records of live meta
+
+const char* RECORD_OP = "op";
+const char* OP_PUT_TABLE = "put_table";
+const char* OP_DROP_TABLE = "drop_table";
+const char* OP_PUT_FILE = "put_file";
+const char* OP_DROP_FILE = "drop_file";
+const char* OP_SET_LSN = "set_lsn";
+const char* OP_CLEAR = "clear";
+
+Status
+HandleException(const std::string& desc, const char* what = nullptr) {
+    if (what == nullptr) {
+        ENGINE_LOG_ERROR << desc;
+        return Status(DB_META_TRANSACTION_FAILED, desc);
+    } else {
+        std::string msg = desc + ":" + what;
+        ENGINE_LOG_ERROR << msg;
+        return Status(DB_META_TRANSACTION_FAILED, msg);
+    }
+}
+
+milvus::json
+PutTableRecord(const TableSchema& table) {
+    milvus::json value;
+    value["id"] = table.id_;
+    value["table_id"] = table.table_id_;
+    value["state"] = table.state_;
+    value["dimension"] = table.dimension_;
+    value["created_on"] = table.created_on_;
+    value["flag"] = table.flag_;
+    value["index_file_size"] = table.index_file_size_;
+    value["engine_type"] = table.engine_type_;
+    value["index_params"] = table.index_params_;
+    value["metric_type"] = table.metric_type_;
+    value["owner_table"] = table.owner_table_;
+    value["partition_tag"] = table.partition_tag_;
+    value["version"] = table.version_;
+    value["flush_lsn"] = table.flush_lsn_;
+    return milvus::json{{RECORD_OP, OP_PUT_TABLE}, {"table", value}};
+}
+
+void
+ParseTable(const milvus::json& value, TableSchema& table) {
+    table.id_ = value["id"].get<size_t>();
+    table.table_id_ = value["table_id"].get<std::string>();
+    table.state_ = value["state"].get<int32_t>();
+    table.dimension_ = value["dimension"].get<uint16_t>();
+    table.created_on_ = value["created_on"].get<int64_t>();
+    table.flag_ = value["flag"].get<int64_t>();
+    table.index_file_size_ = value["index_file_size"].get<int64_t>();
+    table.engine_type_ = value["engine_type"].get<int32_t>();
+    table.index_params_ = value["index_params"].get<std::string>();
+    table.metric_type_ = value["metric_type"].get<int32_t>();
+    table.owner_table_ = value["owner_table"].get<std::string>();
+    table.partition_tag_ = value["partition_tag"].get<std::string>();
+    table.version_ = value["version"].get<std::string>();
+    table.flush_lsn_ = value["flush_lsn"].get<uint64_t>();
+}
+
+// same columns as TableFiles of sql meta, others are filled from table schema
+milvus::json
+PutFileRecord(const TableFileSchema& file) {
+    milvus::json value;
+    value["id"] = file.id_;
+    value["table_id"] = file.table_id_;
+    value["segment_id"] = file.segment_id_;
+    value["engine_type"] = file.engine_type_;
+    value["file_id"] = file.file_id_;
+    value["file_type"] = file.file_type_;
+    value["file_size"] = file.file_size_;
+    value["row_count"] = file.row_count_;
+    value["updated_time"] = file.updated_time_;
+    value["created_on"] = file.created_on_;
+    value["date"] = file.date_;
+    value["flush_lsn"] = file.flush_lsn_;
+    return milvus::json{{RECORD_OP, OP_PUT_FILE}, {"file", value}};
+}
+
+void
+ParseFile(const milvus::json& value, TableFileSchema& file) {
+    file.id_ = value["id"].get<size_t>();
+    file.table_id_ = value["table_id"].get<std::string>();
+    file.segment_id_ = value["segment_id"].get<std::string>();
+    file.engine_type_ = value["engine_type"].get<int32_t>();
+    file.file_id_ = value["file_id"].get<std::string>();
+    file.file_type_ = value["file_type"].get<int32_t>();
+    file.file_size_ = value["file_size"].get<size_t>();
+    file.row_count_ = value["row_count"].get<size_t>();
+    file.updated_time_ = value["updated_time"].get<int64_t>();
+    file.created_on_ = value["created_on"].get<int64_t>();
+    file.date_ = value["date"].get<DateT>();
+    file.flush_lsn_ = value["flush_lsn"].get<uint64_t>();
+}
+
+milvus::json
+DropTableRecord(const std::string& table_id) {
+    return milvus::json{{RECORD_OP, OP_DROP_TABLE}, {"table_id", table_id}};
+}
+
+milvus::json
+DropFileRecord(size_t id) {
+    return milvus::json{{RECORD_OP, OP_DROP_FILE}, {"id", id}};
+}
+
+bool
+WriteAll(int fd, const std::string& data) {
+    const char* ptr = data.data();
+    size_t left = data.size();
+    while (left > 0) {
+        ssize_t written = ::write(fd, ptr, left);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        ptr += written;
+        left -= written;
+    }
+    return true;
+}
+
+}  // namespace
+
+KVMetaImpl::KVMetaImpl(const DBMetaOptions& options) : options_(options) {
+    Initialize();
+}
+
+KVMetaImpl::~KVMetaImpl() {
+    if (manifest_fd_ >= 0) {
+        ::close(manifest_fd_);
+    }
+}
+
+Status
+KVMetaImpl::NextTableId(std::string& table_id) {
+    std::lock_guard<std::mutex> lock(genid_mutex_);  // avoid duplicated id
+    std::stringstream ss;
+    SafeIDGenerator& id_generator = SafeIDGenerator::GetInstance();
+    ss << id_generator.GetNextIDNumber();
+    table_id = ss.str();
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::NextFileId(std::string& file_id) {
+    std::lock_guard<std::mutex> lock(genid_mutex_);  // avoid duplicated id
+    std::stringstream ss;
+    SafeIDGenerator& id_generator = SafeIDGenerator::GetInstance();
+    ss << id_generator.GetNextIDNumber();
+    file_id = ss.str();
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::Initialize() {
+    if (!boost::filesystem::is_directory(options_.path_)) {
+        auto ret = boost::filesystem::create_directory(options_.path_);
+        fiu_do_on("KVMetaImpl.Initialize.fail_create_directory", ret = false);
+        if (!ret) {
+            std::string msg = "Failed to create db directory " + options_.path_;
+            ENGINE_LOG_ERROR << msg;
+            throw Exception(DB_INVALID_PATH, msg);
+        }
+    }
+
+    manifest_path_ = options_.path_ + "/" + KV_META_MANIFEST;
+    auto status = Load();
+    if (!status.ok()) {
+        throw Exception(status.code(), status.message());
+    }
+
+    manifest_fd_ = ::open(manifest_path_.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (manifest_fd_ < 0) {
+        std::string msg = "Failed to open meta manifest " + manifest_path_;
+        ENGINE_LOG_ERROR << msg;
+        throw Exception(DB_INVALID_PATH, msg);
+    }
+
+    ENGINE_LOG_DEBUG << "Load " << tables_.size() << " tables and " << files_.size() << " files from "
+                     << manifest_path_;
+
+    CleanUpShadowFiles();
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::Load() {
+    manifest_size_ = 0;
+    manifest_records_ = 0;
+    if (!boost::filesystem::exists(manifest_path_)) {
+        return Status::OK();
+    }
+
+    std::ifstream in(manifest_path_, std::ios::binary);
+    if (!in.is_open()) {
+        return Status(DB_INVALID_PATH, "Failed to read meta manifest " + manifest_path_);
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (in.eof()) {
+            // no line break, the last batch was not completely written
+            ENGINE_LOG_WARNING << "Drop incomplete batch at the tail of meta manifest";
+            break;
+        }
+
+        milvus::json batch;
+        try {
+            batch = milvus::json::parse(line);
+            for (auto& record : batch) {
+                Apply(record);
+            }
+        } catch (std::exception& e) {
+            std::string msg = "Meta manifest is corrupted at offset " + std::to_string(manifest_size_) + ": " +
+                              e.what();
+            ENGINE_LOG_ERROR << msg;
+            return Status(DB_INCOMPATIB_META, msg);
+        }
+
+        manifest_size_ += line.size() + 1;
+        manifest_records_ += batch.size();
+    }
+    in.close();
+
+    if (boost::filesystem::file_size(manifest_path_) != (uintmax_t)manifest_size_) {
+        if (::truncate(manifest_path_.c_str(), manifest_size_) != 0) {
+            return Status(DB_ERROR, "Failed to truncate meta manifest " + manifest_path_);
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::Commit(const Batch& batch) {
+    if (batch.empty()) {
+        return Status::OK();
+    }
+
+    std::string data = milvus::json(batch).dump() + "\n";
+    bool ok = WriteAll(manifest_fd_, data) && ::fdatasync(manifest_fd_) == 0;
+    fiu_do_on("KVMetaImpl.Commit.fail_write", ok = false);
+    if (!ok) {
+        // roll back partially written batch, otherwise following batches are lost on replay
+        if (::ftruncate(manifest_fd_, manifest_size_) != 0) {
+            ENGINE_LOG_ERROR << "Failed to roll back meta manifest " << manifest_path_;
+        }
+        return HandleException("Failed to write meta manifest " + manifest_path_, strerror(errno));
+    }
+    manifest_size_ += data.size();
+    manifest_records_ += batch.size();
+
+    for (auto& record : batch) {
+        Apply(record);
+    }
+
+    uint64_t live_records = tables_.size() + files_.size() + 1;
+    if (manifest_records_ > COMPACT_MIN_RECORDS && manifest_records_ > live_records * COMPACT_GARBAGE_RATIO) {
+        auto status = Compact();
+        if (!status.ok()) {
+            // the batch is persisted, compaction will be retried by later batches
+            ENGINE_LOG_WARNING << status.message();
+        }
+    }
+
+    return Status::OK();
+}
+
+void
+KVMetaImpl::Apply(const milvus::json& record) {
+    std::string op = record[RECORD_OP].get<std::string>();
+    if (op == OP_PUT_TABLE) {
+        TableSchema table;
+        ParseTable(record["table"], table);
+        max_table_id_ = std::max(max_table_id_, table.id_);
+        tables_[table.table_id_] = table;
+    } else if (op == OP_DROP_TABLE) {
+        tables_.erase(record["table_id"].get<std::string>());
+    } else if (op == OP_PUT_FILE) {
+        TableFileSchema file;
+        ParseFile(record["file"], file);
+        max_file_id_ = std::max(max_file_id_, file.id_);
+        PutFile(file);
+    } else if (op == OP_DROP_FILE) {
+        EraseFile(record["id"].get<size_t>());
+    } else if (op == OP_SET_LSN) {
+        global_lsn_ = record["lsn"].get<uint64_t>();
+    } else if (op == OP_CLEAR) {
+        tables_.clear();
+        files_.clear();
+        table_index_.clear();
+        type_index_.clear();
+        segment_index_.clear();
+    } else {
+        throw Exception(DB_INCOMPATIB_META, "Unknown meta record: " + op);
+    }
+}
+
+Status
+KVMetaImpl::Compact() {
+    Batch batch;
+    batch.reserve(tables_.size() + files_.size() + 1);
+    batch.emplace_back(milvus::json{{RECORD_OP, OP_SET_LSN}, {"lsn", global_lsn_}});
+    for (auto& kv : tables_) {
+        batch.emplace_back(PutTableRecord(kv.second));
+    }
+    for (auto& kv : files_) {
+        batch.emplace_back(PutFileRecord(kv.second));
+    }
+    std::string data = milvus::json(batch).dump() + "\n";
+
+    std::string temp_path = manifest_path_ + ".tmp";
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return Status(DB_ERROR, "Failed to create " + temp_path);
+    }
+    bool ok = WriteAll(fd, data) && ::fsync(fd) == 0;
+    ::close(fd);
+    if (!ok || std::rename(temp_path.c_str(), manifest_path_.c_str()) != 0) {
+        boost::filesystem::remove(temp_path);
+        return Status(DB_ERROR, "Failed to compact meta manifest " + manifest_path_);
+    }
+
+    ::close(manifest_fd_);
+    manifest_fd_ = ::open(manifest_path_.c_str(), O_WRONLY | O_APPEND, 0644);
+    if (manifest_fd_ < 0) {
+        throw Exception(DB_INVALID_PATH, "Failed to reopen meta manifest " + manifest_path_);
+    }
+
+    ENGINE_LOG_DEBUG << "Compact meta manifest from " << manifest_records_ << " to " << batch.size() << " records";
+    manifest_size_ = data.size();
+    manifest_records_ = batch.size();
+    return Status::OK();
+}
+
+const TableSchema*
+KVMetaImpl::FindTable(const std::string& table_id, bool include_deleted) const {
+    auto iter = tables_.find(table_id);
+    if (iter == tables_.end()) {
+        return nullptr;
+    }
+    if (!include_deleted && iter->second.state_ == (int)TableSchema::TO_DELETE) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+void
+KVMetaImpl::PutFile(const TableFileSchema& file) {
+    EraseFile(file.id_);
+    files_[file.id_] = file;
+    table_index_[file.table_id_].insert(file.id_);
+    type_index_[file.file_type_].insert(file.id_);
+    segment_index_[file.segment_id_].insert(file.id_);
+}
+
+void
+KVMetaImpl::EraseFile(size_t id) {
+    auto iter = files_.find(id);
+    if (iter == files_.end()) {
+        return;
+    }
+
+    auto erase_from = [id](auto& index, const auto& key) {
+        auto pos = index.find(key);
+        if (pos != index.end()) {
+            pos->second.erase(id);
+            if (pos->second.empty()) {
+                index.erase(pos);
+            }
+        }
+    };
+    erase_from(table_index_, iter->second.table_id_);
+    erase_from(type_index_, iter->second.file_type_);
+    erase_from(segment_index_, iter->second.segment_id_);
+    files_.erase(iter);
+}
+
+Status
+KVMetaImpl::CollectFile(const TableFileSchema& file, const TableSchema& table, TableFilesSchema& files) const {
+    TableFileSchema table_file = file;
+    table_file.dimension_ = table.dimension_;
+    table_file.index_file_size_ = table.index_file_size_;
+    table_file.index_params_ = table.index_params_;
+    table_file.metric_type_ = table.metric_type_;
+
+    auto status = utils::GetTableFilePath(options_, table_file);
+    files.emplace_back(table_file);
+    return status;
+}
+
+Status
+KVMetaImpl::CreateTable(TableSchema& table_schema) {
+    server::MetricCollector metric;
+    {
+        std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+        if (table_schema.table_id_ == "") {
+            NextTableId(table_schema.table_id_);
+        } else {
+            auto table = FindTable(table_schema.table_id_, true);
+            if (table != nullptr) {
+                if (TableSchema::TO_DELETE == table->state_) {
+                    return Status(DB_ERROR, "Table already exists and it is in delete state, please wait a second");
+                } else {
+                    // Change from no error to already exist.
+                    return Status(DB_ALREADY_EXIST, "Table already exists");
+                }
+            }
+        }
+
+        table_schema.id_ = max_table_id_ + 1;
+        table_schema.created_on_ = utils::GetMicroSecTimeStamp();
+
+        auto status = Commit({PutTableRecord(table_schema)});
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Successfully create table: " << table_schema.table_id_;
+
+    return utils::CreateTablePath(options_, table_schema.table_id_);
+}
+
+Status
+KVMetaImpl::DescribeTable(TableSchema& table_schema) {
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_schema.table_id_);
+    if (table == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_schema.table_id_ + " not found");
+    }
+    table_schema = *table;
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::HasTable(const std::string& table_id, bool& has_or_not) {
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    has_or_not = (FindTable(table_id) != nullptr);
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::AllTables(std::vector<TableSchema>& table_schema_array) {
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    for (auto& kv : tables_) {
+        if (kv.second.state_ != (int)TableSchema::TO_DELETE && kv.second.owner_table_.empty()) {
+            table_schema_array.emplace_back(kv.second);
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::DropTable(const std::string& table_id) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id);
+    if (table != nullptr) {
+        // soft delete table
+        TableSchema table_schema = *table;
+        table_schema.state_ = (int)TableSchema::TO_DELETE;
+        auto status = Commit({PutTableRecord(table_schema)});
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Successfully delete table, table id = " << table_id;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::DeleteTableFiles(const std::string& table_id) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    // soft delete table files
+    Batch batch;
+    auto iter = table_index_.find(table_id);
+    if (iter != table_index_.end()) {
+        auto now = utils::GetMicroSecTimeStamp();
+        for (auto id : iter->second) {
+            TableFileSchema file = files_[id];
+            if (file.file_type_ != (int)TableFileSchema::TO_DELETE) {
+                file.file_type_ = (int)TableFileSchema::TO_DELETE;
+                file.updated_time_ = now;
+                batch.emplace_back(PutFileRecord(file));
+            }
+        }
+    }
+
+    auto status = Commit(batch);
+    if (!status.ok()) {
+        return status;
+    }
+
+    ENGINE_LOG_DEBUG << "Successfully delete table files, table id = " << table_id;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::CreateTableFile(TableFileSchema& file_schema) {
+    if (file_schema.date_ == EmptyDate) {
+        file_schema.date_ = utils::GetDate();
+    }
+
+    server::MetricCollector metric;
+    {
+        std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+        auto table = FindTable(file_schema.table_id_);
+        if (table == nullptr) {
+            return Status(DB_NOT_FOUND, "Table " + file_schema.table_id_ + " not found");
+        }
+
+        NextFileId(file_schema.file_id_);
+        if (file_schema.segment_id_.empty()) {
+            file_schema.segment_id_ = file_schema.file_id_;
+        }
+        file_schema.id_ = max_file_id_ + 1;
+        file_schema.dimension_ = table->dimension_;
+        file_schema.file_size_ = 0;
+        file_schema.row_count_ = 0;
+        file_schema.created_on_ = utils::GetMicroSecTimeStamp();
+        file_schema.updated_time_ = file_schema.created_on_;
+        file_schema.index_file_size_ = table->index_file_size_;
+        file_schema.index_params_ = table->index_params_;
+        file_schema.engine_type_ = table->engine_type_;
+        file_schema.metric_type_ = table->metric_type_;
+
+        auto status = Commit({PutFileRecord(file_schema)});
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Successfully create table file, file id = " << file_schema.file_id_;
+    return utils::CreateTableFilePath(options_, file_schema);
+}
+
+Status
+KVMetaImpl::GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids,
+                          TableFilesSchema& table_files) {
+    table_files.clear();
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id);
+    if (table == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_id + " not found");
+    }
+
+    for (auto id : ids) {
+        auto iter = files_.find(id);
+        if (iter == files_.end() || iter->second.table_id_ != table_id ||
+            iter->second.file_type_ == (int)TableFileSchema::TO_DELETE) {
+            continue;
+        }
+        CollectFile(iter->second, *table, table_files);
+    }
+
+    ENGINE_LOG_DEBUG << "Get table files by id";
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::GetTableFilesBySegmentId(const std::string& segment_id, TableFilesSchema& table_files) {
+    table_files.clear();
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto iter = segment_index_.find(segment_id);
+    if (iter != segment_index_.end()) {
+        const TableSchema* table = nullptr;
+        for (auto id : iter->second) {
+            auto& file = files_[id];
+            if (file.file_type_ == (int)TableFileSchema::TO_DELETE) {
+                continue;
+            }
+            if (table == nullptr) {
+                table = FindTable(file.table_id_);
+                if (table == nullptr) {
+                    return Status(DB_NOT_FOUND, "Table " + file.table_id_ + " not found");
+                }
+            }
+            CollectFile(file, *table, table_files);
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Get table files by segment id";
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::UpdateTableIndex(const std::string& table_id, const TableIndex& index) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id);
+    if (table == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_id + " not found");
+    }
+
+    Batch batch;
+    TableSchema table_schema = *table;
+    table_schema.engine_type_ = index.engine_type_;
+    table_schema.index_params_ = index.extra_params_.dump();
+    table_schema.metric_type_ = index.metric_type_;
+    batch.emplace_back(PutTableRecord(table_schema));
+
+    // set all backup file to raw
+    auto iter = table_index_.find(table_id);
+    if (iter != table_index_.end()) {
+        auto now = utils::GetMicroSecTimeStamp();
+        for (auto id : iter->second) {
+            TableFileSchema file = files_[id];
+            if (file.file_type_ == (int)TableFileSchema::BACKUP) {
+                file.file_type_ = (int)TableFileSchema::RAW;
+                file.updated_time_ = now;
+                batch.emplace_back(PutFileRecord(file));
+            }
+        }
+    }
+
+    auto status = Commit(batch);
+    if (!status.ok()) {
+        return status;
+    }
+
+    ENGINE_LOG_DEBUG << "Successfully update table index, table id = " << table_id;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::UpdateTableFlag(const std::string& table_id, int64_t flag) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id, true);
+    if (table != nullptr) {
+        TableSchema table_schema = *table;
+        table_schema.flag_ = flag;
+        auto status = Commit({PutTableRecord(table_schema)});
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Successfully update table flag, table id = " << table_id;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::UpdateTableFlushLSN(const std::string& table_id, uint64_t flush_lsn) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id, true);
+    if (table != nullptr) {
+        TableSchema table_schema = *table;
+        table_schema.flush_lsn_ = flush_lsn;
+        auto status = Commit({PutTableRecord(table_schema)});
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Successfully update table flush_lsn, table id = " << table_id;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::GetTableFlushLSN(const std::string& table_id, uint64_t& flush_lsn) {
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id, true);
+    if (table == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_id + " not found");
+    }
+    flush_lsn = table->flush_lsn_;
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::GetTableFilesByFlushLSN(uint64_t flush_lsn, TableFilesSchema& table_files) {
+    table_files.clear();
+
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    // only used by wal recovery, no need to index by lsn
+    Status ret;
+    for (auto& kv : files_) {
+        auto& file = kv.second;
+        if (file.flush_lsn_ != flush_lsn) {
+            continue;
+        }
+        auto table = FindTable(file.table_id_);
+        if (table == nullptr) {
+            return Status(DB_NOT_FOUND, "Table " + file.table_id_ + " not found");
+        }
+        auto status = CollectFile(file, *table, table_files);
+        if (!status.ok()) {
+            ret = status;
+        }
+    }
+
+    if (table_files.size() > 0) {
+        ENGINE_LOG_DEBUG << "Collect " << table_files.size() << " files with flush_lsn = " << flush_lsn;
+    }
+    return ret;
+}
+
+Status
+KVMetaImpl::UpdateTableFile(TableFileSchema& file_schema) {
+    file_schema.updated_time_ = utils::GetMicroSecTimeStamp();
+
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    // if the table has been deleted, just mark the table file as TO_DELETE
+    // clean thread will delete the file later
+    if (FindTable(file_schema.table_id_) == nullptr) {
+        file_schema.file_type_ = TableFileSchema::TO_DELETE;
+    }
+
+    if (files_.find(file_schema.id_) != files_.end()) {
+        auto status = Commit({PutFileRecord(file_schema)});
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    ENGINE_LOG_DEBUG << "Update single table file, file id = " << file_schema.file_id_;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::UpdateTableFilesToIndex(const std::string& table_id) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    Batch batch;
+    auto iter = table_index_.find(table_id);
+    if (iter != table_index_.end()) {
+        for (auto id : iter->second) {
+            TableFileSchema file = files_[id];
+            if (file.file_type_ == (int)TableFileSchema::RAW && file.row_count_ >= meta::BUILD_INDEX_THRESHOLD) {
+                file.file_type_ = (int)TableFileSchema::TO_INDEX;
+                batch.emplace_back(PutFileRecord(file));
+            }
+        }
+    }
+
+    auto status = Commit(batch);
+    if (!status.ok()) {
+        return status;
+    }
+
+    ENGINE_LOG_DEBUG << "Update files to to_index, table id = " << table_id;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::UpdateTableFiles(TableFilesSchema& files) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    Batch batch;
+    for (auto& file : files) {
+        if (FindTable(file.table_id_) == nullptr) {
+            file.file_type_ = TableFileSchema::TO_DELETE;
+        }
+
+        file.updated_time_ = utils::GetMicroSecTimeStamp();
+        if (files_.find(file.id_) != files_.end()) {
+            batch.emplace_back(PutFileRecord(file));
+        }
+    }
+
+    // all files are updated in one batch, or none of them
+    auto status = Commit(batch);
+    if (!status.ok()) {
+        return status;
+    }
+
+    ENGINE_LOG_DEBUG << "Update " << files.size() << " table files";
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::DescribeTableIndex(const std::string& table_id, TableIndex& index) {
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id);
+    if (table == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_id + " not found");
+    }
+
+    try {
+        index.engine_type_ = table->engine_type_;
+        index.extra_params_ = milvus::json::parse(table->index_params_);
+        index.metric_type_ = table->metric_type_;
+    } catch (std::exception& e) {
+        return HandleException("Encounter exception when describe index", e.what());
+    }
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::DropTableIndex(const std::string& table_id) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    Batch batch;
+    auto iter = table_index_.find(table_id);
+    if (iter != table_index_.end()) {
+        auto now = utils::GetMicroSecTimeStamp();
+        for (auto id : iter->second) {
+            TableFileSchema file = files_[id];
+            if (file.file_type_ == (int)TableFileSchema::INDEX) {
+                // soft delete index files
+                file.file_type_ = (int)TableFileSchema::TO_DELETE;
+            } else if (file.file_type_ == (int)TableFileSchema::BACKUP) {
+                // set all backup file to raw
+                file.file_type_ = (int)TableFileSchema::RAW;
+            } else {
+                continue;
+            }
+            file.updated_time_ = now;
+            batch.emplace_back(PutFileRecord(file));
+        }
+    }
+
+    // set table index type to raw
+    auto table = FindTable(table_id, true);
+    if (table != nullptr) {
+        TableSchema table_schema = *table;
+        table_schema.engine_type_ = DEFAULT_ENGINE_TYPE;
+        if (engine::utils::IsBinaryMetricType(table_schema.metric_type_)) {
+            table_schema.engine_type_ = (int32_t)EngineType::FAISS_BIN_IDMAP;
+        }
+        table_schema.index_params_ = "{}";
+        batch.emplace_back(PutTableRecord(table_schema));
+    }
+
+    auto status = Commit(batch);
+    if (!status.ok()) {
+        return status;
+    }
+
+    ENGINE_LOG_DEBUG << "Successfully drop table index, table id = " << table_id;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::CreatePartition(const std::string& table_id, const std::string& partition_name, const std::string& tag,
+                            uint64_t lsn) {
+    server::MetricCollector metric;
+
+    TableSchema table_schema;
+    table_schema.table_id_ = table_id;
+    auto status = DescribeTable(table_schema);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // not allow create partition under partition
+    if (!table_schema.owner_table_.empty()) {
+        return Status(DB_ERROR, "Nested partition is not allowed");
+    }
+
+    // trim side-blank of tag, only compare valid characters
+    // for example: " ab cd " is treated as "ab cd"
+    std::string valid_tag = tag;
+    server::StringHelpFunctions::TrimStringBlank(valid_tag);
+
+    // not allow duplicated partition
+    std::string exist_partition;
+    GetPartitionName(table_id, valid_tag, exist_partition);
+    if (!exist_partition.empty()) {
+        return Status(DB_ERROR, "Duplicate partition is not allowed");
+    }
+
+    if (partition_name == "") {
+        // generate unique partition name
+        NextTableId(table_schema.table_id_);
+    } else {
+        table_schema.table_id_ = partition_name;
+    }
+
+    table_schema.id_ = -1;
+    table_schema.flag_ = 0;
+    table_schema.created_on_ = utils::GetMicroSecTimeStamp();
+    table_schema.owner_table_ = table_id;
+    table_schema.partition_tag_ = valid_tag;
+    table_schema.flush_lsn_ = lsn;
+
+    status = CreateTable(table_schema);
+    if (status.code() == DB_ALREADY_EXIST) {
+        return Status(DB_ALREADY_EXIST, "Partition already exists");
+    }
+
+    return status;
+}
+
+Status
+KVMetaImpl::DropPartition(const std::string& partition_name) {
+    return DropTable(partition_name);
+}
+
+Status
+KVMetaImpl::ShowPartitions(const std::string& table_id, std::vector<meta::TableSchema>& partition_schema_array) {
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    for (auto& kv : tables_) {
+        if (kv.second.owner_table_ == table_id && kv.second.state_ != (int)TableSchema::TO_DELETE) {
+            partition_schema_array.emplace_back(kv.second);
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::GetPartitionName(const std::string& table_id, const std::string& tag, std::string& partition_name) {
+    server::MetricCollector metric;
+
+    // trim side-blank of tag, only compare valid characters
+    // for example: " ab cd " is treated as "ab cd"
+    std::string valid_tag = tag;
+    server::StringHelpFunctions::TrimStringBlank(valid_tag);
+
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+    for (auto& kv : tables_) {
+        if (kv.second.owner_table_ == table_id && kv.second.partition_tag_ == valid_tag &&
+            kv.second.state_ != (int)TableSchema::TO_DELETE) {
+            partition_name = kv.first;
+            return Status::OK();
+        }
+    }
+
+    return Status(DB_NOT_FOUND, "Table " + table_id + "'s partition " + valid_tag + " not found");
+}
+
+Status
+KVMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, TableFilesSchema& files) {
+    files.clear();
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id);
+    if (table == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_id + " not found");
+    }
+
+    auto is_searchable = [](const TableFileSchema& file) {
+        return file.file_type_ == (int)TableFileSchema::RAW || file.file_type_ == (int)TableFileSchema::TO_INDEX ||
+               file.file_type_ == (int)TableFileSchema::INDEX;
+    };
+
+    Status ret;
+    if (ids.empty()) {
+        auto iter = table_index_.find(table_id);
+        if (iter != table_index_.end()) {
+            for (auto id : iter->second) {
+                auto& file = files_[id];
+                if (is_searchable(file)) {
+                    auto status = CollectFile(file, *table, files);
+                    if (!status.ok()) {
+                        ret = status;
+                    }
+                }
+            }
+        }
+    } else {
+        std::set<size_t> unique_ids(ids.begin(), ids.end());
+        for (auto id : unique_ids) {
+            auto iter = files_.find(id);
+            if (iter != files_.end() && iter->second.table_id_ == table_id && is_searchable(iter->second)) {
+                auto status = CollectFile(iter->second, *table, files);
+                if (!status.ok()) {
+                    ret = status;
+                }
+            }
+        }
+    }
+
+    if (files.empty()) {
+        ENGINE_LOG_ERROR << "No file to search for table: " << table_id;
+    } else {
+        ENGINE_LOG_DEBUG << "Collect " << files.size() << " to-search files";
+    }
+    return ret;
+}
+
+Status
+KVMetaImpl::FilesToMerge(const std::string& table_id, TableFilesSchema& files) {
+    files.clear();
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    // check table existence
+    auto table = FindTable(table_id);
+    if (table == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_id + " not found");
+    }
+
+    // walk the smaller one of table files and raw files
+    std::vector<const TableFileSchema*> raw_files;
+    auto table_iter = table_index_.find(table_id);
+    auto type_iter = type_index_.find((int32_t)TableFileSchema::RAW);
+    if (table_iter != table_index_.end() && type_iter != type_index_.end()) {
+        bool by_table = table_iter->second.size() < type_iter->second.size();
+        auto& candidates = by_table ? table_iter->second : type_iter->second;
+        for (auto id : candidates) {
+            auto& file = files_[id];
+            if (file.table_id_ != table_id || file.file_type_ != (int)TableFileSchema::RAW) {
+                continue;
+            }
+            if (file.file_size_ >= (size_t)table->index_file_size_) {
+                continue;  // skip large file
+            }
+            raw_files.push_back(&file);
+        }
+    }
+
+    std::stable_sort(raw_files.begin(), raw_files.end(), [](const TableFileSchema* a, const TableFileSchema* b) {
+        return a->file_size_ > b->file_size_;
+    });
+
+    Status result;
+    for (auto file : raw_files) {
+        auto status = CollectFile(*file, *table, files);
+        if (!status.ok()) {
+            result = status;
+        }
+    }
+
+    if (files.size() > 0) {
+        ENGINE_LOG_TRACE << "Collect " << files.size() << " to-merge files";
+    }
+    return result;
+}
+
+Status
+KVMetaImpl::FilesToIndex(TableFilesSchema& files) {
+    files.clear();
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto iter = type_index_.find((int32_t)TableFileSchema::TO_INDEX);
+    if (iter == type_index_.end()) {
+        return Status::OK();
+    }
+
+    Status ret;
+    for (auto id : iter->second) {
+        auto& file = files_[id];
+        auto table = FindTable(file.table_id_);
+        if (table == nullptr) {
+            return Status(DB_NOT_FOUND, "Table " + file.table_id_ + " not found");
+        }
+        auto status = CollectFile(file, *table, files);
+        if (!status.ok()) {
+            ret = status;
+        }
+    }
+
+    if (files.size() > 0) {
+        ENGINE_LOG_DEBUG << "Collect " << files.size() << " to-index files";
+    }
+    return ret;
+}
+
+Status
+KVMetaImpl::FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                        TableFilesSchema& table_files) {
+    if (file_types.empty()) {
+        return Status(DB_ERROR, "file types array is empty");
+    }
+
+    table_files.clear();
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    auto table = FindTable(table_id);
+    if (table == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_id + " not found");
+    }
+
+    auto iter = table_index_.find(table_id);
+    if (iter == table_index_.end()) {
+        return Status::OK();
+    }
+
+    Status ret;
+    std::set<int> types(file_types.begin(), file_types.end());
+    std::map<int, int64_t> type_count;
+    for (auto id : iter->second) {
+        auto& file = files_[id];
+        if (types.find(file.file_type_) == types.end()) {
+            continue;
+        }
+        ++type_count[file.file_type_];
+        auto status = CollectFile(file, *table, table_files);
+        if (!status.ok()) {
+            ret = status;
+        }
+    }
+
+    if (!table_files.empty()) {
+        std::string msg = "Get table files by type.";
+        for (auto& kv : type_count) {
+            msg += " type " + std::to_string(kv.first) + " files:" + std::to_string(kv.second);
+        }
+        ENGINE_LOG_DEBUG << msg;
+    }
+
+    return ret;
+}
+
+Status
+KVMetaImpl::Size(uint64_t& result) {
+    result = 0;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    for (auto& kv : files_) {
+        if (kv.second.file_type_ != (int)TableFileSchema::TO_DELETE) {
+            result += kv.second.file_size_;
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::Archive() {
+    auto& criterias = options_.archive_conf_.GetCriterias();
+    if (criterias.size() == 0) {
+        return Status::OK();
+    }
+
+    for (auto kv : criterias) {
+        auto& criteria = kv.first;
+        auto& limit = kv.second;
+        if (criteria == engine::ARCHIVE_CONF_DAYS) {
+            int64_t usecs = limit * DAY * US_PS;
+            int64_t now = utils::GetMicroSecTimeStamp();
+
+            std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+            Batch batch;
+            for (auto& file_kv : files_) {
+                auto& file = file_kv.second;
+                if (file.created_on_ < (int64_t)(now - usecs) &&
+                    file.file_type_ != (int)TableFileSchema::TO_DELETE) {
+                    TableFileSchema to_delete = file;
+                    to_delete.file_type_ = (int)TableFileSchema::TO_DELETE;
+                    batch.emplace_back(PutFileRecord(to_delete));
+                }
+            }
+            auto status = Commit(batch);
+            if (!status.ok()) {
+                return status;
+            }
+
+            ENGINE_LOG_DEBUG << "Archive old files";
+        }
+        if (criteria == engine::ARCHIVE_CONF_DISK) {
+            uint64_t sum = 0;
+            Size(sum);
+
+            int64_t to_delete = (int64_t)sum - limit * G;
+            DiscardFiles(to_delete);
+
+            ENGINE_LOG_DEBUG << "Archive files to free disk";
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::DiscardFiles(int64_t to_discard_size) {
+    if (to_discard_size <= 0) {
+        return Status::OK();
+    }
+
+    ENGINE_LOG_DEBUG << "About to discard size=" << to_discard_size;
+
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    // discard oldest files first
+    Batch batch;
+    auto now = utils::GetMicroSecTimeStamp();
+    for (auto& kv : files_) {
+        if (to_discard_size <= 0) {
+            break;
+        }
+        if (kv.second.file_type_ == (int)TableFileSchema::TO_DELETE) {
+            continue;
+        }
+
+        TableFileSchema file = kv.second;
+        ENGINE_LOG_DEBUG << "Discard table_file.id=" << file.file_id_ << " table_file.size=" << file.file_size_;
+        to_discard_size -= file.file_size_;
+        file.file_type_ = (int)TableFileSchema::TO_DELETE;
+        file.updated_time_ = now;
+        batch.emplace_back(PutFileRecord(file));
+    }
+
+    return Commit(batch);
+}
+
+Status
+KVMetaImpl::CleanUpShadowFiles() {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    Batch batch;
+    std::vector<int32_t> file_types = {(int)TableFileSchema::NEW, (int)TableFileSchema::NEW_INDEX,
+                                       (int)TableFileSchema::NEW_MERGE};
+    for (auto file_type : file_types) {
+        auto iter = type_index_.find(file_type);
+        if (iter == type_index_.end()) {
+            continue;
+        }
+        for (auto id : iter->second) {
+            batch.emplace_back(DropFileRecord(id));
+        }
+    }
+
+    auto status = Commit(batch);
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (batch.size() > 0) {
+        ENGINE_LOG_DEBUG << "Clean " << batch.size() << " files";
+    }
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter*/) {
+    int64_t expire_time = (int64_t)utils::GetMicroSecTimeStamp() - (int64_t)(seconds * US_PS);
+    std::set<std::string> table_ids;
+    std::map<std::string, TableFileSchema> segment_ids;
+
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    // remove to_delete files, backup files are only erased from cache like sql meta does
+    Batch batch;
+    std::vector<int32_t> file_types = {(int)TableFileSchema::TO_DELETE, (int)TableFileSchema::BACKUP};
+    for (auto file_type : file_types) {
+        auto iter = type_index_.find(file_type);
+        if (iter == type_index_.end()) {
+            continue;
+        }
+
+        for (auto id : iter->second) {
+            TableFileSchema table_file = files_[id];
+            if (table_file.updated_time_ >= expire_time) {
+                continue;
+            }
+
+            // check if the file can be deleted
+            if (OngoingFileChecker::GetInstance().IsIgnored(table_file)) {
+                ENGINE_LOG_DEBUG << "File:" << table_file.file_id_ << " currently is in use, not able to delete now";
+                continue;  // ignore this file, don't delete it
+            }
+
+            // erase from cache, must do this before file deleted,
+            // because GetTableFilePath won't able to generate file path after the file is deleted
+            utils::GetTableFilePath(options_, table_file);
+            server::CommonUtil::EraseFromCache(table_file.location_);
+            RawBlockReader::EraseFromCache(table_file.location_);
+
+            if (table_file.file_type_ == (int)TableFileSchema::TO_DELETE) {
+                // delete file from disk storage
+                utils::DeleteTableFilePath(options_, table_file);
+
+                ENGINE_LOG_DEBUG << "Remove file id:" << table_file.file_id_ << " location:" << table_file.location_;
+                batch.emplace_back(DropFileRecord(table_file.id_));
+                table_ids.insert(table_file.table_id_);
+                segment_ids.insert(std::make_pair(table_file.segment_id_, table_file));
+            }
+        }
+    }
+    int64_t clean_files = batch.size();
+
+    // remove to_delete tables
+    int64_t clean_tables = 0;
+    for (auto& kv : tables_) {
+        if (kv.second.state_ == (int)TableSchema::TO_DELETE) {
+            utils::DeleteTablePath(options_, kv.first, false);  // only delete empty folder
+            batch.emplace_back(DropTableRecord(kv.first));
+            ++clean_tables;
+        }
+    }
+
+    auto status = Commit(batch);
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (clean_files > 0) {
+        ENGINE_LOG_DEBUG << "Clean " << clean_files << " files expired in " << seconds << " seconds";
+    }
+    if (clean_tables > 0) {
+        ENGINE_LOG_DEBUG << "Remove " << clean_tables << " tables from meta";
+    }
+
+    // remove deleted table folder
+    // don't remove table folder until all its files has been deleted
+    int64_t remove_tables = 0;
+    for (auto& table_id : table_ids) {
+        if (table_index_.find(table_id) == table_index_.end()) {
+            utils::DeleteTablePath(options_, table_id);
+            ++remove_tables;
+        }
+    }
+    if (remove_tables) {
+        ENGINE_LOG_DEBUG << "Remove " << remove_tables << " tables folder";
+    }
+
+    // remove deleted segment folder
+    // don't remove segment folder until all its tablefiles has been deleted
+    int64_t remove_segments = 0;
+    for (auto& segment_id : segment_ids) {
+        if (segment_index_.find(segment_id.first) == segment_index_.end()) {
+            utils::DeleteSegment(options_, segment_id.second);
+            std::string segment_dir;
+            utils::GetParentPath(segment_id.second.location_, segment_dir);
+            SegmentPruner::EraseFromCache(segment_dir);
+            ENGINE_LOG_DEBUG << "Remove segment directory: " << segment_dir;
+            ++remove_segments;
+        }
+    }
+    if (remove_segments > 0) {
+        ENGINE_LOG_DEBUG << "Remove " << remove_segments << " segments folder";
+    }
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::Count(const std::string& table_id, uint64_t& result) {
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    if (FindTable(table_id) == nullptr) {
+        return Status(DB_NOT_FOUND, "Table " + table_id + " not found");
+    }
+
+    result = 0;
+    auto iter = table_index_.find(table_id);
+    if (iter != table_index_.end()) {
+        for (auto id : iter->second) {
+            auto& file = files_[id];
+            if (file.file_type_ == (int)TableFileSchema::RAW || file.file_type_ == (int)TableFileSchema::TO_INDEX ||
+                file.file_type_ == (int)TableFileSchema::INDEX) {
+                result += file.row_count_;
+            }
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::DropAll() {
+    ENGINE_LOG_DEBUG << "Drop all kv meta";
+
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+    auto status = Commit({milvus::json{{RECORD_OP, OP_CLEAR}}});
+    if (!status.ok()) {
+        return status;
+    }
+
+    return Compact();
+}
+
+Status
+KVMetaImpl::SetGlobalLastLSN(uint64_t lsn) {
+    server::MetricCollector metric;
+    std::unique_lock<std::shared_mutex> lock(meta_mutex_);
+
+    if (lsn == global_lsn_) {
+        return Status::OK();
+    }
+
+    auto status = Commit({milvus::json{{RECORD_OP, OP_SET_LSN}, {"lsn", lsn}}});
+    if (!status.ok()) {
+        return status;
+    }
+
+    ENGINE_LOG_DEBUG << "Update global lsn = " << lsn;
+    return Status::OK();
+}
+
+Status
+KVMetaImpl::GetGlobalLastLSN(uint64_t& lsn) {
+    server::MetricCollector metric;
+    std::shared_lock<std::shared_mutex> lock(meta_mutex_);
+
+    lsn = global_lsn_;
+    return Status::OK();
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,217 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <sys/types.h>
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Meta.h"
+#include "db/Options.h"
+#include "utils/Json.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+static const char* KV_META_MANIFEST = "meta.kvlog";
+
+/*
+ * Embedded meta backend for single node deployment, selected by backend_url "kv://:@:/".
+ * Every change is appended to a manifest file as one json line holding a batch of records, so a batch
+ * is applied entirely or not at all (a torn last line is dropped on replay). The whole meta lives in
+ * memory with indexes by table, file type and segment, so file lookups don't scan all files.
+ * The manifest is rewritten with live records only when it grows too large.
+ */
+class KVMetaImpl : public Meta {
+ public:
+    explicit KVMetaImpl(const DBMetaOptions& options);
+    ~KVMetaImpl();
+
+    Status
+    CreateTable(TableSchema& table_schema) override;
+
+    Status
+    DescribeTable(TableSchema& table_schema) override;
+
+    Status
+    HasTable(const std::string& table_id, bool& has_or_not) override;
+
+    Status
+    AllTables(std::vector<TableSchema>& table_schema_array) override;
+
+    Status
+    DropTable(const std::string& table_id) override;
+
+    Status
+    DeleteTableFiles(const std::string& table_id) override;
+
+    Status
+    CreateTableFile(TableFileSchema& file_schema) override;
+
+    Status
+    GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids, TableFilesSchema& table_files) override;
+
+    Status
+    GetTableFilesBySegmentId(const std::string& segment_id, TableFilesSchema& table_files) override;
+
+    Status
+    UpdateTableIndex(const std::string& table_id, const TableIndex& index) override;
+
+    Status
+    UpdateTableFlag(const std::string& table_id, int64_t flag) override;
+
+    Status
+    UpdateTableFlushLSN(const std::string& table_id, uint64_t flush_lsn) override;
+
+    Status
+    GetTableFlushLSN(const std::string& table_id, uint64_t& flush_lsn) override;
+
+    Status
+    GetTableFilesByFlushLSN(uint64_t flush_lsn, TableFilesSchema& table_files) override;
+
+    Status
+    UpdateTableFile(TableFileSchema& file_schema) override;
+
+    Status
+    UpdateTableFilesToIndex(const std::string& table_id) override;
+
+    Status
+    UpdateTableFiles(TableFilesSchema& files) override;
+
+    Status
+    DescribeTableIndex(const std::string& table_id, TableIndex& index) override;
+
+    Status
+    DropTableIndex(const std::string& table_id) override;
+
+    Status
+    CreatePartition(const std::string& table_id, const std::string& partition_name, const std::string& tag,
+                    uint64_t lsn) override;
+
+    Status
+    DropPartition(const std::string& partition_name) override;
+
+    Status
+    ShowPartitions(const std::string& table_id, std::vector<meta::TableSchema>& partition_schema_array) override;
+
+    Status
+    GetPartitionName(const std::string& table_id, const std::string& tag, std::string& partition_name) override;
+
+    Status
+    FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, TableFilesSchema& files) override;
+
+    Status
+    FilesToMerge(const std::string& table_id, TableFilesSchema& files) override;
+
+    Status
+    FilesToIndex(TableFilesSchema&) override;
+
+    Status
+    FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                TableFilesSchema& table_files) override;
+
+    Status
+    Size(uint64_t& result) override;
+
+    Status
+    Archive() override;
+
+    Status
+    CleanUpShadowFiles() override;
+
+    Status
+    CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter = nullptr*/) override;
+
+    Status
+    DropAll() override;
+
+    Status
+    Count(const std::string& table_id, uint64_t& result) override;
+
+    Status
+    SetGlobalLastLSN(uint64_t lsn) override;
+
+    Status
+    GetGlobalLastLSN(uint64_t& lsn) override;
+
+ private:
+    using Batch = std::vector<milvus::json>;
+
+    Status
+    NextFileId(std::string& file_id);
+    Status
+    NextTableId(std::string& table_id);
+
+    Status
+    Initialize();
+
+    // replay manifest into memory, drop a torn tail left by a crash
+    Status
+    Load();
+
+    // append batch to manifest then apply it to memory, caller must hold unique lock of meta_mutex_
+    Status
+    Commit(const Batch& batch);
+
+    void
+    Apply(const milvus::json& record);
+
+    // rewrite manifest with live records, caller must hold unique lock of meta_mutex_
+    Status
+    Compact();
+
+    // below helpers require meta_mutex_ to be held
+    const TableSchema*
+    FindTable(const std::string& table_id, bool include_deleted = false) const;
+
+    void
+    PutFile(const TableFileSchema& file);
+
+    void
+    EraseFile(size_t id);
+
+    Status
+    CollectFile(const TableFileSchema& file, const TableSchema& table, TableFilesSchema& files) const;
+
+    Status
+    DiscardFiles(int64_t to_discard_size);
+
+ private:
+    const DBMetaOptions options_;
+    std::string manifest_path_;
+    int manifest_fd_ = -1;
+    off_t manifest_size_ = 0;        // bytes of complete records in manifest file
+    uint64_t manifest_records_ = 0;  // records in manifest file, include overwritten ones
+
+    std::shared_mutex meta_mutex_;
+    std::mutex genid_mutex_;
+
+    std::map<std::string, TableSchema> tables_;
+    std::map<size_t, TableFileSchema> files_;  // ordered by id, like rowid of sql meta
+    std::unordered_map<std::string, std::set<size_t>> table_index_;
+    std::unordered_map<int32_t, std::set<size_t>> type_index_;
+    std::unordered_map<std::string, std::set<size_t>> segment_index_;
+    size_t max_table_id_ = 0;
+    size_t max_file_id_ = 0;
+    uint64_t global_lsn_ = 0;
+};  // KVMetaImpl
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
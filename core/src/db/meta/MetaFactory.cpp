@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "db/meta/MetaFactory.h"
+#include "KVMetaImpl.h"
 #include "MySQLMetaImpl.h"
 #include "SqliteMetaImpl.h"
 #include "db/Utils.h"
@@ -60,9 +61,12 @@ MetaFactory::Build(const DBMetaOptions& metaOptions, const int& mode) {
     } else if (strcasecmp(uri_info.dialect_.c_str(), "sqlite") == 0) {
         ENGINE_LOG_INFO << "Using SQLite";
         return std::make_shared<meta::SqliteMetaImpl>(metaOptions);
+    } else if (strcasecmp(uri_info.dialect_.c_str(), "kv") == 0) {
+        ENGINE_LOG_INFO << "Using embedded KV meta";
+        return std::make_shared<meta::KVMetaImpl>(metaOptions);
     } else {
         ENGINE_LOG_ERROR << "Invalid dialect in URI: dialect = " << uri_info.dialect_;
-        throw InvalidArgumentException("URI dialect is not mysql / sqlite");
+        throw InvalidArgumentException("URI dialect is not mysql / sqlite / kv");
     }
 }
 
@@ -33,6 +33,8 @@
 #include "db/IDGenerator.h"
 #include "db/OngoingFileChecker.h"
 #include "db/Utils.h"
+#include "db/engine/RawBlockReader.h"
+#include "db/engine/SegmentPruner.h"
 #include "metrics/Metrics.h"
 #include "utils/CommonUtil.h"
 #include "utils/Exception.h"
@@ -2078,6 +2080,7 @@ MySQLMetaImpl::CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter*/)
                 // because GetTableFilePath won't able to generate file path after the file is deleted
                 utils::GetTableFilePath(options_, table_file);
                 server::CommonUtil::EraseFromCache(table_file.location_);
+                RawBlockReader::EraseFromCache(table_file.location_);
 
                 if (table_file.file_type_ == (int)TableFileSchema::TO_DELETE) {
                     // delete file from disk storage
@@ -2243,6 +2246,7 @@ MySQLMetaImpl::CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter*/)
                     utils::DeleteSegment(options_, segment_id.second);
                     std::string segment_dir;
                     utils::GetParentPath(segment_id.second.location_, segment_dir);
+                    SegmentPruner::EraseFromCache(segment_dir);
                     ENGINE_LOG_DEBUG << "Remove segment directory: " << segment_dir;
                     ++remove_segments;
                 }
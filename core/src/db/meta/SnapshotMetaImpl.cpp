@@ -0,0 +1,347 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/meta/SnapshotMetaImpl.h"
+
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+SnapshotMetaImpl::SnapshotMetaImpl(const MetaPtr& meta, const DBMetaOptions& options)
+    : meta_(meta), options_(options), snapshot_(std::make_shared<MetaSnapshot>()) {
+}
+
+Status
+SnapshotMetaImpl::SnapshotFilesToSearch(const std::string& table_id, TableFilesSchema& files) {
+    files.clear();
+
+    MetaSnapshotPtr snapshot = std::atomic_load(&snapshot_);
+    auto iter = snapshot->search_files_.find(table_id);
+    if (iter != snapshot->search_files_.end()) {
+        files = *iter->second;
+        return Status::OK();
+    }
+
+    std::vector<size_t> ids;
+    auto status = meta_->FilesToSearch(table_id, ids, files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    auto entry = std::make_shared<const TableFilesSchema>(files);
+    Fill(snapshot->version_, [&](MetaSnapshot& next) { next.search_files_[table_id] = entry; });
+    return Status::OK();
+}
+
+Status
+SnapshotMetaImpl::SnapshotPartitions(const std::string& table_id, std::vector<TableSchema>& partition_schema_array) {
+    partition_schema_array.clear();
+
+    MetaSnapshotPtr snapshot = std::atomic_load(&snapshot_);
+    auto iter = snapshot->partitions_.find(table_id);
+    if (iter != snapshot->partitions_.end()) {
+        partition_schema_array = *iter->second;
+        return Status::OK();
+    }
+
+    auto status = meta_->ShowPartitions(table_id, partition_schema_array);
+    if (!status.ok()) {
+        return status;
+    }
+
+    auto entry = std::make_shared<const std::vector<TableSchema>>(partition_schema_array);
+    Fill(snapshot->version_, [&](MetaSnapshot& next) { next.partitions_[table_id] = entry; });
+    return Status::OK();
+}
+
+uint64_t
+SnapshotMetaImpl::SnapshotVersion() const {
+    return std::atomic_load(&snapshot_)->version_;
+}
+
+void
+SnapshotMetaImpl::Fill(uint64_t base_version, const SnapshotModifier& modifier) {
+    std::lock_guard<std::mutex> lock(update_mutex_);
+    MetaSnapshotPtr current = std::atomic_load(&snapshot_);
+    if (current->version_ != base_version) {
+        // meta changed while reading backend, the result may be stale
+        return;
+    }
+
+    auto next = std::make_shared<MetaSnapshot>(*current);
+    modifier(*next);
+    std::atomic_store(&snapshot_, MetaSnapshotPtr(next));
+}
+
+void
+SnapshotMetaImpl::Invalidate(const SnapshotModifier& modifier) {
+    std::lock_guard<std::mutex> lock(update_mutex_);
+    MetaSnapshotPtr current = std::atomic_load(&snapshot_);
+    // copies only the pointer maps, the file lists of untouched tables are shared with the current snapshot
+    auto next = std::make_shared<MetaSnapshot>(*current);
+    modifier(*next);
+    next->version_ = current->version_ + 1;
+    std::atomic_store(&snapshot_, MetaSnapshotPtr(next));
+}
+
+void
+SnapshotMetaImpl::InvalidateTable(const std::string& table_id) {
+    Invalidate([&](MetaSnapshot& next) { next.search_files_.erase(table_id); });
+}
+
+void
+SnapshotMetaImpl::InvalidateAll() {
+    Invalidate([](MetaSnapshot& next) {
+        next.search_files_.clear();
+        next.partitions_.clear();
+    });
+}
+
+Status
+SnapshotMetaImpl::CreateTable(TableSchema& table_schema) {
+    auto status = meta_->CreateTable(table_schema);
+    // a table with same name may be dropped before
+    InvalidateTable(table_schema.table_id_);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DescribeTable(TableSchema& table_schema) {
+    return meta_->DescribeTable(table_schema);
+}
+
+Status
+SnapshotMetaImpl::HasTable(const std::string& table_id, bool& has_or_not) {
+    return meta_->HasTable(table_id, has_or_not);
+}
+
+Status
+SnapshotMetaImpl::AllTables(std::vector<TableSchema>& table_schema_array) {
+    return meta_->AllTables(table_schema_array);
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFlag(const std::string& table_id, int64_t flag) {
+    return meta_->UpdateTableFlag(table_id, flag);
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFlushLSN(const std::string& table_id, uint64_t flush_lsn) {
+    return meta_->UpdateTableFlushLSN(table_id, flush_lsn);
+}
+
+Status
+SnapshotMetaImpl::GetTableFlushLSN(const std::string& table_id, uint64_t& flush_lsn) {
+    return meta_->GetTableFlushLSN(table_id, flush_lsn);
+}
+
+Status
+SnapshotMetaImpl::GetTableFilesByFlushLSN(uint64_t flush_lsn, TableFilesSchema& table_files) {
+    return meta_->GetTableFilesByFlushLSN(flush_lsn, table_files);
+}
+
+Status
+SnapshotMetaImpl::DropTable(const std::string& table_id) {
+    auto status = meta_->DropTable(table_id);
+    // the table may be a partition, owner's partition list is unknown here
+    Invalidate([&](MetaSnapshot& next) {
+        next.search_files_.erase(table_id);
+        next.partitions_.clear();
+    });
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DeleteTableFiles(const std::string& table_id) {
+    auto status = meta_->DeleteTableFiles(table_id);
+    InvalidateTable(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CreateTableFile(TableFileSchema& file_schema) {
+    auto status = meta_->CreateTableFile(file_schema);
+    InvalidateTable(file_schema.table_id_);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids,
+                                TableFilesSchema& table_files) {
+    return meta_->GetTableFiles(table_id, ids, table_files);
+}
+
+Status
+SnapshotMetaImpl::GetTableFilesBySegmentId(const std::string& segment_id, TableFilesSchema& table_files) {
+    return meta_->GetTableFilesBySegmentId(segment_id, table_files);
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFile(TableFileSchema& file_schema) {
+    auto status = meta_->UpdateTableFile(file_schema);
+    InvalidateTable(file_schema.table_id_);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFiles(TableFilesSchema& files) {
+    auto status = meta_->UpdateTableFiles(files);
+
+    std::set<std::string> table_ids;
+    for (auto& file : files) {
+        table_ids.insert(file.table_id_);
+    }
+    Invalidate([&](MetaSnapshot& next) {
+        for (auto& table_id : table_ids) {
+            next.search_files_.erase(table_id);
+        }
+    });
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateTableIndex(const std::string& table_id, const TableIndex& index) {
+    auto status = meta_->UpdateTableIndex(table_id, index);
+    // index params are carried by every file schema
+    InvalidateTable(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateTableFilesToIndex(const std::string& table_id) {
+    auto status = meta_->UpdateTableFilesToIndex(table_id);
+    InvalidateTable(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DescribeTableIndex(const std::string& table_id, TableIndex& index) {
+    return meta_->DescribeTableIndex(table_id, index);
+}
+
+Status
+SnapshotMetaImpl::DropTableIndex(const std::string& table_id) {
+    auto status = meta_->DropTableIndex(table_id);
+    InvalidateTable(table_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CreatePartition(const std::string& table_name, const std::string& partition_name,
+                                  const std::string& tag, uint64_t lsn) {
+    auto status = meta_->CreatePartition(table_name, partition_name, tag, lsn);
+    Invalidate([&](MetaSnapshot& next) {
+        next.partitions_.erase(table_name);
+        next.search_files_.erase(partition_name);
+    });
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DropPartition(const std::string& partition_name) {
+    auto status = meta_->DropPartition(partition_name);
+    Invalidate([&](MetaSnapshot& next) {
+        next.search_files_.erase(partition_name);
+        next.partitions_.clear();
+    });
+    return status;
+}
+
+Status
+SnapshotMetaImpl::ShowPartitions(const std::string& table_name,
+                                 std::vector<meta::TableSchema>& partition_schema_array) {
+    return meta_->ShowPartitions(table_name, partition_schema_array);
+}
+
+Status
+SnapshotMetaImpl::GetPartitionName(const std::string& table_name, const std::string& tag,
+                                   std::string& partition_name) {
+    return meta_->GetPartitionName(table_name, tag, partition_name);
+}
+
+Status
+SnapshotMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids,
+                                TableFilesSchema& files) {
+    return meta_->FilesToSearch(table_id, ids, files);
+}
+
+Status
+SnapshotMetaImpl::FilesToMerge(const std::string& table_id, TableFilesSchema& files) {
+    return meta_->FilesToMerge(table_id, files);
+}
+
+Status
+SnapshotMetaImpl::FilesToIndex(TableFilesSchema& files) {
+    return meta_->FilesToIndex(files);
+}
+
+Status
+SnapshotMetaImpl::FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                              TableFilesSchema& table_files) {
+    return meta_->FilesByType(table_id, file_types, table_files);
+}
+
+Status
+SnapshotMetaImpl::Size(uint64_t& result) {
+    return meta_->Size(result);
+}
+
+Status
+SnapshotMetaImpl::Archive() {
+    auto status = meta_->Archive();
+    // archive marks old files as to-delete, nothing changed if no criteria
+    if (!options_.archive_conf_.GetCriterias().empty()) {
+        InvalidateAll();
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CleanUpShadowFiles() {
+    // only new/new_merge/new_index files are removed, they are not searchable
+    return meta_->CleanUpShadowFiles();
+}
+
+Status
+SnapshotMetaImpl::CleanUpFilesWithTTL(uint64_t seconds) {
+    // only to_delete/backup files and to_delete tables are removed, they are not searchable
+    return meta_->CleanUpFilesWithTTL(seconds);
+}
+
+Status
+SnapshotMetaImpl::DropAll() {
+    auto status = meta_->DropAll();
+    InvalidateAll();
+    return status;
+}
+
+Status
+SnapshotMetaImpl::Count(const std::string& table_id, uint64_t& result) {
+    return meta_->Count(table_id, result);
+}
+
+Status
+SnapshotMetaImpl::SetGlobalLastLSN(uint64_t lsn) {
+    return meta_->SetGlobalLastLSN(lsn);
+}
+
+Status
+SnapshotMetaImpl::GetGlobalLastLSN(uint64_t& lsn) {
+    return meta_->GetGlobalLastLSN(lsn);
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,198 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Meta.h"
+#include "db/Options.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+using TableFilesSchemaPtr = std::shared_ptr<const TableFilesSchema>;
+using PartitionsSchemaPtr = std::shared_ptr<const std::vector<TableSchema>>;
+
+// Immutable view of the search-related meta, replaced on every change. Entries are shared between
+// versions, so a change copies the pointer maps and rebuilds only the entries of the tables it touches.
+struct MetaSnapshot {
+    uint64_t version_ = 0;
+    std::map<std::string, TableFilesSchemaPtr> search_files_;  // table id -> files to search
+    std::map<std::string, PartitionsSchemaPtr> partitions_;    // owner table id -> partitions
+};
+
+using MetaSnapshotPtr = std::shared_ptr<const MetaSnapshot>;
+
+/*
+ * Wraps a persistent meta backend (sqlite/mysql) and keeps an in-memory snapshot of files to search
+ * and partitions for the query path. All writes go to the backend first, then drop the affected
+ * snapshot entries and bump the version; search reads the snapshot without taking any lock and
+ * only falls back to the backend on a miss.
+ * Must not be used on a readonly node in cluster mode, since that node never sees the writes.
+ */
+class SnapshotMetaImpl : public Meta {
+ public:
+    SnapshotMetaImpl(const MetaPtr& meta, const DBMetaOptions& options);
+
+    // lock-free read path for search
+    Status
+    SnapshotFilesToSearch(const std::string& table_id, TableFilesSchema& files);
+
+    Status
+    SnapshotPartitions(const std::string& table_id, std::vector<TableSchema>& partition_schema_array);
+
+    uint64_t
+    SnapshotVersion() const;
+
+    Status
+    CreateTable(TableSchema& table_schema) override;
+
+    Status
+    DescribeTable(TableSchema& table_schema) override;
+
+    Status
+    HasTable(const std::string& table_id, bool& has_or_not) override;
+
+    Status
+    AllTables(std::vector<TableSchema>& table_schema_array) override;
+
+    Status
+    UpdateTableFlag(const std::string& table_id, int64_t flag) override;
+
+    Status
+    UpdateTableFlushLSN(const std::string& table_id, uint64_t flush_lsn) override;
+
+    Status
+    GetTableFlushLSN(const std::string& table_id, uint64_t& flush_lsn) override;
+
+    Status
+    GetTableFilesByFlushLSN(uint64_t flush_lsn, TableFilesSchema& table_files) override;
+
+    Status
+    DropTable(const std::string& table_id) override;
+
+    Status
+    DeleteTableFiles(const std::string& table_id) override;
+
+    Status
+    CreateTableFile(TableFileSchema& file_schema) override;
+
+    Status
+    GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids, TableFilesSchema& table_files) override;
+
+    Status
+    GetTableFilesBySegmentId(const std::string& segment_id, TableFilesSchema& table_files) override;
+
+    Status
+    UpdateTableFile(TableFileSchema& file_schema) override;
+
+    Status
+    UpdateTableFiles(TableFilesSchema& files) override;
+
+    Status
+    UpdateTableIndex(const std::string& table_id, const TableIndex& index) override;
+
+    Status
+    UpdateTableFilesToIndex(const std::string& table_id) override;
+
+    Status
+    DescribeTableIndex(const std::string& table_id, TableIndex& index) override;
+
+    Status
+    DropTableIndex(const std::string& table_id) override;
+
+    Status
+    CreatePartition(const std::string& table_name, const std::string& partition_name, const std::string& tag,
+                    uint64_t lsn) override;
+
+    Status
+    DropPartition(const std::string& partition_name) override;
+
+    Status
+    ShowPartitions(const std::string& table_name, std::vector<meta::TableSchema>& partition_schema_array) override;
+
+    Status
+    GetPartitionName(const std::string& table_name, const std::string& tag, std::string& partition_name) override;
+
+    Status
+    FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, TableFilesSchema& files) override;
+
+    Status
+    FilesToMerge(const std::string& table_id, TableFilesSchema& files) override;
+
+    Status
+    FilesToIndex(TableFilesSchema&) override;
+
+    Status
+    FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                TableFilesSchema& table_files) override;
+
+    Status
+    Size(uint64_t& result) override;
+
+    Status
+    Archive() override;
+
+    Status
+    CleanUpShadowFiles() override;
+
+    Status
+    CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter = nullptr*/) override;
+
+    Status
+    DropAll() override;
+
+    Status
+    Count(const std::string& table_id, uint64_t& result) override;
+
+    Status
+    SetGlobalLastLSN(uint64_t lsn) override;
+
+    Status
+    GetGlobalLastLSN(uint64_t& lsn) override;
+
+ private:
+    using SnapshotModifier = std::function<void(MetaSnapshot&)>;
+
+    // fill a missing entry, skipped if any write happened since base_version was read
+    void
+    Fill(uint64_t base_version, const SnapshotModifier& modifier);
+
+    // drop entries after a write, always applied
+    void
+    Invalidate(const SnapshotModifier& modifier);
+
+    void
+    InvalidateTable(const std::string& table_id);
+
+    void
+    InvalidateAll();
+
+ private:
+    MetaPtr meta_;
+    DBMetaOptions options_;
+
+    MetaSnapshotPtr snapshot_;  // accessed by std::atomic_load/std::atomic_store only
+    std::mutex update_mutex_;   // serialize snapshot writers
+};
+
+using SnapshotMetaImplPtr = std::shared_ptr<SnapshotMetaImpl>;
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -28,6 +28,8 @@
 #include "db/IDGenerator.h"
 #include "db/OngoingFileChecker.h"
 #include "db/Utils.h"
+#include "db/engine/RawBlockReader.h"
+#include "db/engine/SegmentPruner.h"
 #include "metrics/Metrics.h"
 #include "utils/CommonUtil.h"
 #include "utils/Exception.h"
@@ -1410,6 +1412,7 @@ SqliteMetaImpl::CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter*/
                 // TODO(zhiru): clean up
                 utils::GetTableFilePath(options_, table_file);
                 server::CommonUtil::EraseFromCache(table_file.location_);
+                RawBlockReader::EraseFromCache(table_file.location_);
 
                 if (table_file.file_type_ == (int)TableFileSchema::TO_DELETE) {
                     // delete file from meta
@@ -1510,6 +1513,7 @@ SqliteMetaImpl::CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter*/
                 utils::DeleteSegment(options_, segment_id.second);
                 std::string segment_dir;
                 utils::GetParentPath(segment_id.second.location_, segment_dir);
+                SegmentPruner::EraseFromCache(segment_dir);
                 ENGINE_LOG_DEBUG << "Remove segment directory: " << segment_dir;
                 ++remove_segments;
             }
@@ -186,7 +186,8 @@ MXLogBuffer::SurplusSpace() {
 uint32_t
 MXLogBuffer::RecordSize(const MXLogRecord& record) {
     return SizeOfMXLogRecordHeader + (uint32_t)record.table_id.size() + (uint32_t)record.partition_tag.size() +
-           record.length * (uint32_t)sizeof(IDNumber) + record.data_size;
+           record.length * (uint32_t)sizeof(IDNumber) + record.data_size +
+           (record.attrs_size > 0 ? (uint32_t)sizeof(uint32_t) + record.attrs_size : 0);
 }
 
 ErrorCode
@@ -217,11 +218,16 @@ MXLogBuffer::Append(MXLogRecord& record) {
 
     MXLogRecordHeader head;
     BuildLsn(mxlog_buffer_writer_.file_no, mxlog_buffer_writer_.buf_offset + (uint32_t)record_size, head.mxl_lsn);
+    bool has_attrs = (record.attrs != nullptr && record.attrs_size > 0);
     head.mxl_type = (uint8_t)record.type;
     head.table_id_size = (uint16_t)record.table_id.size();
     head.partition_tag_size = (uint16_t)record.partition_tag.size();
     head.vector_num = record.length;
     head.data_size = record.data_size;
+    if (has_attrs) {
+        head.mxl_type |= MXLogTypeAttrsFlag;
+        head.data_size += (uint32_t)sizeof(uint32_t) + record.attrs_size;
+    }
 
     memcpy(current_write_buf + current_write_offset, &head, SizeOfMXLogRecordHeader);
     current_write_offset += SizeOfMXLogRecordHeader;
@@ -240,6 +246,13 @@ MXLogBuffer::Append(MXLogRecord& record) {
         current_write_offset += record.length * sizeof(IDNumber);
     }
 
+    if (has_attrs) {
+        memcpy(current_write_buf + current_write_offset, &record.attrs_size, sizeof(uint32_t));
+        current_write_offset += sizeof(uint32_t);
+        memcpy(current_write_buf + current_write_offset, record.attrs, record.attrs_size);
+        current_write_offset += record.attrs_size;
+    }
+
     if (record.data != nullptr && record.data_size > 0) {
         memcpy(current_write_buf + current_write_offset, record.data, record.data_size);
         current_write_offset += record.data_size;
@@ -299,7 +312,8 @@ MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
     uint64_t current_read_offset = mxlog_buffer_reader_.buf_offset;
 
     MXLogRecordHeader* head = (MXLogRecordHeader*)(current_read_buf + current_read_offset);
-    record.type = (MXLogType)head->mxl_type;
+    bool has_attrs = (head->mxl_type & MXLogTypeAttrsFlag) != 0;
+    record.type = (MXLogType)(head->mxl_type & ~MXLogTypeAttrsFlag);
     record.lsn = head->mxl_lsn;
     record.length = head->vector_num;
     record.data_size = head->data_size;
@@ -327,6 +341,16 @@ MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
         record.ids = nullptr;
     }
 
+    record.attrs_size = 0;
+    record.attrs = nullptr;
+    if (has_attrs) {
+        memcpy(&record.attrs_size, current_read_buf + current_read_offset, sizeof(uint32_t));
+        current_read_offset += sizeof(uint32_t);
+        record.attrs = current_read_buf + current_read_offset;
+        current_read_offset += record.attrs_size;
+        record.data_size -= (uint32_t)sizeof(uint32_t) + record.attrs_size;
+    }
+
     if (record.data_size != 0) {
         record.data = current_read_buf + current_read_offset;
     } else {
@@ -39,6 +39,9 @@ struct MXLogRecordHeader {
 
 const uint32_t SizeOfMXLogRecordHeader = sizeof(MXLogRecordHeader);
 
+// set in mxl_type when the record carries attributes, data is then |uint32 attrs size|attrs|vectors|
+const uint8_t MXLogTypeAttrsFlag = 0x80;
+
 #pragma pack(pop)
 
 struct MXLogBufferHandler {
@@ -39,6 +39,8 @@ struct MXLogRecord {
     const IDNumber* ids;
     uint32_t data_size;
     const void* data;
+    uint32_t attrs_size = 0;  // serialized segment::Attrs of the vectors, see segment/Attrs.h
+    const void* attrs = nullptr;
 };
 
 struct MXLogConfiguration {
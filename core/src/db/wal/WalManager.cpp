@@ -228,7 +228,7 @@ WalManager::TableFlushed(const std::string& table_id, uint64_t lsn) {
 template <typename T>
 bool
 WalManager::Insert(const std::string& table_id, const std::string& partition_tag, const IDNumbers& vector_ids,
-                   const std::vector<T>& vectors) {
+                   const std::vector<T>& vectors, const segment::Attrs& attrs) {
     MXLogType log_type;
     if (std::is_same<T, float>::value) {
         log_type = MXLogType::InsertVector;
@@ -246,8 +246,13 @@ WalManager::Insert(const std::string& table_id, const std::string& partition_tag
     size_t dim = vectors.size() / vector_num;
     size_t unit_size = dim * sizeof(T) + sizeof(IDNumber);
     size_t head_size = SizeOfMXLogRecordHeader + table_id.length() + partition_tag.length();
+    if (!attrs.attrs.empty()) {
+        unit_size += attrs.attrs.size() * segment::ATTR_VALUE_SIZE;
+        head_size += sizeof(uint32_t) + segment::SerializedAttrsSize(attrs, 0);
+    }
 
     MXLogRecord record;
+    std::vector<uint8_t> attrs_blob;
     record.type = log_type;
     record.table_id = table_id;
     record.partition_tag = partition_tag;
@@ -270,6 +275,11 @@ WalManager::Insert(const std::string& table_id, const std::string& partition_tag
         record.ids = vector_ids.data() + i;
         record.data_size = record.length * dim * sizeof(T);
         record.data = vectors.data() + i * dim;
+        if (!attrs.attrs.empty()) {
+            segment::SerializeAttrs(attrs, i, record.length, attrs_blob);
+            record.attrs_size = attrs_blob.size();
+            record.attrs = attrs_blob.data();
+        }
 
         auto error_code = p_buffer_->Append(record);
         if (error_code != WAL_SUCCESS) {
@@ -390,11 +400,11 @@ WalManager::RemoveOldFiles(uint64_t flushed_lsn) {
 
 template bool
 WalManager::Insert<float>(const std::string& table_id, const std::string& partition_tag, const IDNumbers& vector_ids,
-                          const std::vector<float>& vectors);
+                          const std::vector<float>& vectors, const segment::Attrs& attrs);
 
 template bool
 WalManager::Insert<uint8_t>(const std::string& table_id, const std::string& partition_tag, const IDNumbers& vector_ids,
-                            const std::vector<uint8_t>& vectors);
+                            const std::vector<uint8_t>& vectors, const segment::Attrs& attrs);
 
 }  // namespace wal
 }  // namespace engine
@@ -86,11 +86,12 @@ class WalManager {
      * @param table_id: partition tag
      * @param vector_ids: vector ids
      * @param vectors: vectors
+     * @param attrs: attributes of the vectors, may be empty
      */
     template <typename T>
     bool
     Insert(const std::string& table_id, const std::string& partition_tag, const IDNumbers& vector_ids,
-           const std::vector<T>& vectors);
+           const std::vector<T>& vectors, const segment::Attrs& attrs = segment::Attrs());
 
     /*
      * Insert
@@ -148,11 +149,11 @@ class WalManager {
 
 extern template bool
 WalManager::Insert<float>(const std::string& table_id, const std::string& partition_tag, const IDNumbers& vector_ids,
-                          const std::vector<float>& vectors);
+                          const std::vector<float>& vectors, const segment::Attrs& attrs);
 
 extern template bool
 WalManager::Insert<uint8_t>(const std::string& table_id, const std::string& partition_tag, const IDNumbers& vector_ids,
-                            const std::vector<uint8_t>& vectors);
+                            const std::vector<uint8_t>& vectors, const segment::Attrs& attrs);
 
 }  // namespace wal
 }  // namespace engine
@@ -466,9 +466,10 @@ static void InitDefaultsscc_info_TopKQueryResult_milvus_2eproto() {
   ::milvus::grpc::TopKQueryResult::InitAsDefaultInstance();
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TopKQueryResult_milvus_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_TopKQueryResult_milvus_2eproto}, {
-      &scc_info_Status_status_2eproto.base,}};
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_TopKQueryResult_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_TopKQueryResult_milvus_2eproto}, {
+      &scc_info_Status_status_2eproto.base,
+      &scc_info_KeyValuePair_milvus_2eproto.base,}};
 
 static void InitDefaultsscc_info_VectorData_milvus_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -625,6 +626,7 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::TopKQueryResult, row_num_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::TopKQueryResult, ids_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::TopKQueryResult, distances_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::TopKQueryResult, extra_params_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::StringReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -683,6 +685,8 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::SegmentStat, row_count_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::SegmentStat, index_name_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::SegmentStat, data_size_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::SegmentStat, build_stage_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::SegmentStat, built_count_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::PartitionStat, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -735,19 +739,19 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 79, -1, sizeof(::milvus::grpc::SearchInFilesParam)},
   { 86, -1, sizeof(::milvus::grpc::SearchByIDParam)},
   { 96, -1, sizeof(::milvus::grpc::TopKQueryResult)},
-  { 105, -1, sizeof(::milvus::grpc::StringReply)},
-  { 112, -1, sizeof(::milvus::grpc::BoolReply)},
-  { 119, -1, sizeof(::milvus::grpc::TableRowCount)},
-  { 126, -1, sizeof(::milvus::grpc::Command)},
-  { 132, -1, sizeof(::milvus::grpc::IndexParam)},
-  { 141, -1, sizeof(::milvus::grpc::FlushParam)},
-  { 147, -1, sizeof(::milvus::grpc::DeleteByIDParam)},
-  { 154, -1, sizeof(::milvus::grpc::SegmentStat)},
-  { 163, -1, sizeof(::milvus::grpc::PartitionStat)},
-  { 171, -1, sizeof(::milvus::grpc::TableInfo)},
-  { 179, -1, sizeof(::milvus::grpc::VectorIdentity)},
-  { 186, -1, sizeof(::milvus::grpc::VectorData)},
-  { 193, -1, sizeof(::milvus::grpc::GetVectorIDsParam)},
+  { 106, -1, sizeof(::milvus::grpc::StringReply)},
+  { 113, -1, sizeof(::milvus::grpc::BoolReply)},
+  { 120, -1, sizeof(::milvus::grpc::TableRowCount)},
+  { 127, -1, sizeof(::milvus::grpc::Command)},
+  { 133, -1, sizeof(::milvus::grpc::IndexParam)},
+  { 142, -1, sizeof(::milvus::grpc::FlushParam)},
+  { 148, -1, sizeof(::milvus::grpc::DeleteByIDParam)},
+  { 155, -1, sizeof(::milvus::grpc::SegmentStat)},
+  { 166, -1, sizeof(::milvus::grpc::PartitionStat)},
+  { 174, -1, sizeof(::milvus::grpc::TableInfo)},
+  { 182, -1, sizeof(::milvus::grpc::VectorIdentity)},
+  { 189, -1, sizeof(::milvus::grpc::VectorData)},
+  { 196, -1, sizeof(::milvus::grpc::GetVectorIDsParam)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -811,75 +815,78 @@ const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "table_name\030\001 \001(\t\022\033\n\023partition_tag_array\030"
   "\002 \003(\t\022\n\n\002id\030\003 \001(\003\022\014\n\004topk\030\004 \001(\003\022/\n\014extra"
   "_params\030\005 \003(\0132\031.milvus.grpc.KeyValuePair"
-  "\"g\n\017TopKQueryResult\022#\n\006status\030\001 \001(\0132\023.mi"
-  "lvus.grpc.Status\022\017\n\007row_num\030\002 \001(\003\022\013\n\003ids"
-  "\030\003 \003(\003\022\021\n\tdistances\030\004 \003(\002\"H\n\013StringReply"
-  "\022#\n\006status\030\001 \001(\0132\023.milvus.grpc.Status\022\024\n"
-  "\014string_reply\030\002 \001(\t\"D\n\tBoolReply\022#\n\006stat"
-  "us\030\001 \001(\0132\023.milvus.grpc.Status\022\022\n\nbool_re"
-  "ply\030\002 \001(\010\"M\n\rTableRowCount\022#\n\006status\030\001 \001"
-  "(\0132\023.milvus.grpc.Status\022\027\n\017table_row_cou"
-  "nt\030\002 \001(\003\"\026\n\007Command\022\013\n\003cmd\030\001 \001(\t\"\212\001\n\nInd"
-  "exParam\022#\n\006status\030\001 \001(\0132\023.milvus.grpc.St"
-  "atus\022\022\n\ntable_name\030\002 \001(\t\022\022\n\nindex_type\030\003"
-  " \001(\005\022/\n\014extra_params\030\004 \003(\0132\031.milvus.grpc"
-  ".KeyValuePair\"&\n\nFlushParam\022\030\n\020table_nam"
-  "e_array\030\001 \003(\t\"7\n\017DeleteByIDParam\022\022\n\ntabl"
-  "e_name\030\001 \001(\t\022\020\n\010id_array\030\002 \003(\003\"]\n\013Segmen"
-  "tStat\022\024\n\014segment_name\030\001 \001(\t\022\021\n\trow_count"
-  "\030\002 \001(\003\022\022\n\nindex_name\030\003 \001(\t\022\021\n\tdata_size\030"
-  "\004 \001(\003\"f\n\rPartitionStat\022\013\n\003tag\030\001 \001(\t\022\027\n\017t"
-  "otal_row_count\030\002 \001(\003\022/\n\rsegments_stat\030\003 "
-  "\003(\0132\030.milvus.grpc.SegmentStat\"~\n\tTableIn"
-  "fo\022#\n\006status\030\001 \001(\0132\023.milvus.grpc.Status\022"
-  "\027\n\017total_row_count\030\002 \001(\003\0223\n\017partitions_s"
-  "tat\030\003 \003(\0132\032.milvus.grpc.PartitionStat\"0\n"
-  "\016VectorIdentity\022\022\n\ntable_name\030\001 \001(\t\022\n\n\002i"
-  "d\030\002 \001(\003\"^\n\nVectorData\022#\n\006status\030\001 \001(\0132\023."
-  "milvus.grpc.Status\022+\n\013vector_data\030\002 \001(\0132"
-  "\026.milvus.grpc.RowRecord\"=\n\021GetVectorIDsP"
-  "aram\022\022\n\ntable_name\030\001 \001(\t\022\024\n\014segment_name"
-  "\030\002 \001(\t2\313\014\n\rMilvusService\022>\n\013CreateTable\022"
-  "\030.milvus.grpc.TableSchema\032\023.milvus.grpc."
-  "Status\"\000\022<\n\010HasTable\022\026.milvus.grpc.Table"
-  "Name\032\026.milvus.grpc.BoolReply\"\000\022C\n\rDescri"
-  "beTable\022\026.milvus.grpc.TableName\032\030.milvus"
-  ".grpc.TableSchema\"\000\022B\n\nCountTable\022\026.milv"
-  "us.grpc.TableName\032\032.milvus.grpc.TableRow"
-  "Count\"\000\022@\n\nShowTables\022\024.milvus.grpc.Comm"
-  "and\032\032.milvus.grpc.TableNameList\"\000\022A\n\rSho"
-  "wTableInfo\022\026.milvus.grpc.TableName\032\026.mil"
-  "vus.grpc.TableInfo\"\000\022:\n\tDropTable\022\026.milv"
-  "us.grpc.TableName\032\023.milvus.grpc.Status\"\000"
-  "\022=\n\013CreateIndex\022\027.milvus.grpc.IndexParam"
-  "\032\023.milvus.grpc.Status\"\000\022B\n\rDescribeIndex"
-  "\022\026.milvus.grpc.TableName\032\027.milvus.grpc.I"
-  "ndexParam\"\000\022:\n\tDropIndex\022\026.milvus.grpc.T"
-  "ableName\032\023.milvus.grpc.Status\"\000\022E\n\017Creat"
-  "ePartition\022\033.milvus.grpc.PartitionParam\032"
-  "\023.milvus.grpc.Status\"\000\022F\n\016ShowPartitions"
-  "\022\026.milvus.grpc.TableName\032\032.milvus.grpc.P"
-  "artitionList\"\000\022C\n\rDropPartition\022\033.milvus"
-  ".grpc.PartitionParam\032\023.milvus.grpc.Statu"
-  "s\"\000\022<\n\006Insert\022\030.milvus.grpc.InsertParam\032"
-  "\026.milvus.grpc.VectorIds\"\000\022G\n\rGetVectorBy"
-  "ID\022\033.milvus.grpc.VectorIdentity\032\027.milvus"
-  ".grpc.VectorData\"\000\022H\n\014GetVectorIDs\022\036.mil"
-  "vus.grpc.GetVectorIDsParam\032\026.milvus.grpc"
-  ".VectorIds\"\000\022B\n\006Search\022\030.milvus.grpc.Sea"
-  "rchParam\032\034.milvus.grpc.TopKQueryResult\"\000"
-  "\022J\n\nSearchByID\022\034.milvus.grpc.SearchByIDP"
-  "aram\032\034.milvus.grpc.TopKQueryResult\"\000\022P\n\r"
-  "SearchInFiles\022\037.milvus.grpc.SearchInFile"
-  "sParam\032\034.milvus.grpc.TopKQueryResult\"\000\0227"
-  "\n\003Cmd\022\024.milvus.grpc.Command\032\030.milvus.grp"
-  "c.StringReply\"\000\022A\n\nDeleteByID\022\034.milvus.g"
-  "rpc.DeleteByIDParam\032\023.milvus.grpc.Status"
-  "\"\000\022=\n\014PreloadTable\022\026.milvus.grpc.TableNa"
-  "me\032\023.milvus.grpc.Status\"\000\0227\n\005Flush\022\027.mil"
-  "vus.grpc.FlushParam\032\023.milvus.grpc.Status"
-  "\"\000\0228\n\007Compact\022\026.milvus.grpc.TableName\032\023."
-  "milvus.grpc.Status\"\000b\006proto3"
+  "\"\230\001\n\017TopKQueryResult\022#\n\006status\030\001 \001(\0132\023.m"
+  "ilvus.grpc.Status\022\017\n\007row_num\030\002 \001(\003\022\013\n\003id"
+  "s\030\003 \003(\003\022\021\n\tdistances\030\004 \003(\002\022/\n\014extra_para"
+  "ms\030\005 \003(\0132\031.milvus.grpc.KeyValuePair\"H\n\013S"
+  "tringReply\022#\n\006status\030\001 \001(\0132\023.milvus.grpc"
+  ".Status\022\024\n\014string_reply\030\002 \001(\t\"D\n\tBoolRep"
+  "ly\022#\n\006status\030\001 \001(\0132\023.milvus.grpc.Status\022"
+  "\022\n\nbool_reply\030\002 \001(\010\"M\n\rTableRowCount\022#\n\006"
+  "status\030\001 \001(\0132\023.milvus.grpc.Status\022\027\n\017tab"
+  "le_row_count\030\002 \001(\003\"\026\n\007Command\022\013\n\003cmd\030\001 \001"
+  "(\t\"\212\001\n\nIndexParam\022#\n\006status\030\001 \001(\0132\023.milv"
+  "us.grpc.Status\022\022\n\ntable_name\030\002 \001(\t\022\022\n\nin"
+  "dex_type\030\003 \001(\005\022/\n\014extra_params\030\004 \003(\0132\031.m"
+  "ilvus.grpc.KeyValuePair\"&\n\nFlushParam\022\030\n"
+  "\020table_name_array\030\001 \003(\t\"7\n\017DeleteByIDPar"
+  "am\022\022\n\ntable_name\030\001 \001(\t\022\020\n\010id_array\030\002 \003(\003"
+  "\"\207\001\n\013SegmentStat\022\024\n\014segment_name\030\001 \001(\t\022\021"
+  "\n\trow_count\030\002 \001(\003\022\022\n\nindex_name\030\003 \001(\t\022\021\n"
+  "\tdata_size\030\004 \001(\003\022\023\n\013build_stage\030\005 \001(\t\022\023\n"
+  "\013built_count\030\006 \001(\003\"f\n\rPartitionStat\022\013\n\003t"
+  "ag\030\001 \001(\t\022\027\n\017total_row_count\030\002 \001(\003\022/\n\rseg"
+  "ments_stat\030\003 \003(\0132\030.milvus.grpc.SegmentSt"
+  "at\"~\n\tTableInfo\022#\n\006status\030\001 \001(\0132\023.milvus"
+  ".grpc.Status\022\027\n\017total_row_count\030\002 \001(\003\0223\n"
+  "\017partitions_stat\030\003 \003(\0132\032.milvus.grpc.Par"
+  "titionStat\"0\n\016VectorIdentity\022\022\n\ntable_na"
+  "me\030\001 \001(\t\022\n\n\002id\030\002 \001(\003\"^\n\nVectorData\022#\n\006st"
+  "atus\030\001 \001(\0132\023.milvus.grpc.Status\022+\n\013vecto"
+  "r_data\030\002 \001(\0132\026.milvus.grpc.RowRecord\"=\n\021"
+  "GetVectorIDsParam\022\022\n\ntable_name\030\001 \001(\t\022\024\n"
+  "\014segment_name\030\002 \001(\t2\313\014\n\rMilvusService\022>\n"
+  "\013CreateTable\022\030.milvus.grpc.TableSchema\032\023"
+  ".milvus.grpc.Status\"\000\022<\n\010HasTable\022\026.milv"
+  "us.grpc.TableName\032\026.milvus.grpc.BoolRepl"
+  "y\"\000\022C\n\rDescribeTable\022\026.milvus.grpc.Table"
+  "Name\032\030.milvus.grpc.TableSchema\"\000\022B\n\nCoun"
+  "tTable\022\026.milvus.grpc.TableName\032\032.milvus."
+  "grpc.TableRowCount\"\000\022@\n\nShowTables\022\024.mil"
+  "vus.grpc.Command\032\032.milvus.grpc.TableName"
+  "List\"\000\022A\n\rShowTableInfo\022\026.milvus.grpc.Ta"
+  "bleName\032\026.milvus.grpc.TableInfo\"\000\022:\n\tDro"
+  "pTable\022\026.milvus.grpc.TableName\032\023.milvus."
+  "grpc.Status\"\000\022=\n\013CreateIndex\022\027.milvus.gr"
+  "pc.IndexParam\032\023.milvus.grpc.Status\"\000\022B\n\r"
+  "DescribeIndex\022\026.milvus.grpc.TableName\032\027."
+  "milvus.grpc.IndexParam\"\000\022:\n\tDropIndex\022\026."
+  "milvus.grpc.TableName\032\023.milvus.grpc.Stat"
+  "us\"\000\022E\n\017CreatePartition\022\033.milvus.grpc.Pa"
+  "rtitionParam\032\023.milvus.grpc.Status\"\000\022F\n\016S"
+  "howPartitions\022\026.milvus.grpc.TableName\032\032."
+  "milvus.grpc.PartitionList\"\000\022C\n\rDropParti"
+  "tion\022\033.milvus.grpc.PartitionParam\032\023.milv"
+  "us.grpc.Status\"\000\022<\n\006Insert\022\030.milvus.grpc"
+  ".InsertParam\032\026.milvus.grpc.VectorIds\"\000\022G"
+  "\n\rGetVectorByID\022\033.milvus.grpc.VectorIden"
+  "tity\032\027.milvus.grpc.VectorData\"\000\022H\n\014GetVe"
+  "ctorIDs\022\036.milvus.grpc.GetVectorIDsParam\032"
+  "\026.milvus.grpc.VectorIds\"\000\022B\n\006Search\022\030.mi"
+  "lvus.grpc.SearchParam\032\034.milvus.grpc.TopK"
+  "QueryResult\"\000\022J\n\nSearchByID\022\034.milvus.grp"
+  "c.SearchByIDParam\032\034.milvus.grpc.TopKQuer"
+  "yResult\"\000\022P\n\rSearchInFiles\022\037.milvus.grpc"
+  ".SearchInFilesParam\032\034.milvus.grpc.TopKQu"
+  "eryResult\"\000\0227\n\003Cmd\022\024.milvus.grpc.Command"
+  "\032\030.milvus.grpc.StringReply\"\000\022A\n\nDeleteBy"
+  "ID\022\034.milvus.grpc.DeleteByIDParam\032\023.milvu"
+  "s.grpc.Status\"\000\022=\n\014PreloadTable\022\026.milvus"
+  ".grpc.TableName\032\023.milvus.grpc.Status\"\000\0227"
+  "\n\005Flush\022\027.milvus.grpc.FlushParam\032\023.milvu"
+  "s.grpc.Status\"\000\0228\n\007Compact\022\026.milvus.grpc"
+  ".TableName\032\023.milvus.grpc.Status\"\000b\006proto"
+  "3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_milvus_2eproto_deps[1] = {
   &::descriptor_table_status_2eproto,
@@ -915,7 +922,7 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_mil
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_milvus_2eproto_once;
 static bool descriptor_table_milvus_2eproto_initialized = false;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_milvus_2eproto = {
-  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 3988,
+  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 4081,
   &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 26, 1,
   schemas, file_default_instances, TableStruct_milvus_2eproto::offsets,
   file_level_metadata_milvus_2eproto, 26, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
@@ -5534,7 +5541,8 @@ TopKQueryResult::TopKQueryResult(const TopKQueryResult& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _internal_metadata_(nullptr),
       ids_(from.ids_),
-      distances_(from.distances_) {
+      distances_(from.distances_),
+      extra_params_(from.extra_params_) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_status()) {
     status_ = new ::milvus::grpc::Status(*from.status_);
@@ -5578,6 +5586,7 @@ void TopKQueryResult::Clear() {
 
   ids_.Clear();
   distances_.Clear();
+  extra_params_.Clear();
   if (GetArenaNoVirtual() == nullptr && status_ != nullptr) {
     delete status_;
   }
@@ -5628,6 +5637,18 @@ const char* TopKQueryResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
           ptr += sizeof(float);
         } else goto handle_unusual;
         continue;
+      // repeated .milvus.grpc.KeyValuePair extra_params = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(add_extra_params(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 42);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -5714,6 +5735,17 @@ bool TopKQueryResult::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated .milvus.grpc.KeyValuePair extra_params = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_extra_params()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -5772,6 +5804,15 @@ void TopKQueryResult::SerializeWithCachedSizes(
       this->distances().data(), this->distances_size(), output);
   }
 
+  // repeated .milvus.grpc.KeyValuePair extra_params = 5;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->extra_params_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5,
+      this->extra_params(static_cast<int>(i)),
+      output);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
         _internal_metadata_.unknown_fields(), output);
@@ -5823,6 +5864,14 @@ void TopKQueryResult::SerializeWithCachedSizes(
       WriteFloatNoTagToArray(this->distances_, target);
   }
 
+  // repeated .milvus.grpc.KeyValuePair extra_params = 5;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->extra_params_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        5, this->extra_params(static_cast<int>(i)), target);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields(), target);
@@ -5874,6 +5923,17 @@ size_t TopKQueryResult::ByteSizeLong() const {
     total_size += data_size;
   }
 
+  // repeated .milvus.grpc.KeyValuePair extra_params = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->extra_params_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->extra_params(static_cast<int>(i)));
+    }
+  }
+
   // .milvus.grpc.Status status = 1;
   if (this->has_status()) {
     total_size += 1 +
@@ -5917,6 +5977,7 @@ void TopKQueryResult::MergeFrom(const TopKQueryResult& from) {
 
   ids_.MergeFrom(from.ids_);
   distances_.MergeFrom(from.distances_);
+  extra_params_.MergeFrom(from.extra_params_);
   if (from.has_status()) {
     mutable_status()->::milvus::grpc::Status::MergeFrom(from.status());
   }
@@ -5948,6 +6009,7 @@ void TopKQueryResult::InternalSwap(TopKQueryResult* other) {
   _internal_metadata_.Swap(&other->_internal_metadata_);
   ids_.InternalSwap(&other->ids_);
   distances_.InternalSwap(&other->distances_);
+  CastToBase(&extra_params_)->InternalSwap(CastToBase(&other->extra_params_));
   swap(status_, other->status_);
   swap(row_num_, other->row_num_);
 }
@@ -8257,9 +8319,13 @@ SegmentStat::SegmentStat(const SegmentStat& from)
   if (!from.index_name().empty()) {
     index_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.index_name_);
   }
+  build_stage_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.build_stage().empty()) {
+    build_stage_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.build_stage_);
+  }
   ::memcpy(&row_count_, &from.row_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&data_size_) -
-    reinterpret_cast<char*>(&row_count_)) + sizeof(data_size_));
+    static_cast<size_t>(reinterpret_cast<char*>(&built_count_) -
+    reinterpret_cast<char*>(&row_count_)) + sizeof(built_count_));
   // @@protoc_insertion_point(copy_constructor:milvus.grpc.SegmentStat)
 }
 
@@ -8267,9 +8333,10 @@ void SegmentStat::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SegmentStat_milvus_2eproto.base);
   segment_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   index_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  build_stage_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   ::memset(&row_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&data_size_) -
-      reinterpret_cast<char*>(&row_count_)) + sizeof(data_size_));
+      reinterpret_cast<char*>(&built_count_) -
+      reinterpret_cast<char*>(&row_count_)) + sizeof(built_count_));
 }
 
 SegmentStat::~SegmentStat() {
@@ -8280,6 +8347,7 @@ SegmentStat::~SegmentStat() {
 void SegmentStat::SharedDtor() {
   segment_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   index_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  build_stage_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 void SegmentStat::SetCachedSize(int size) const {
@@ -8299,9 +8367,10 @@ void SegmentStat::Clear() {
 
   segment_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   index_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  build_stage_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   ::memset(&row_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&data_size_) -
-      reinterpret_cast<char*>(&row_count_)) + sizeof(data_size_));
+      reinterpret_cast<char*>(&built_count_) -
+      reinterpret_cast<char*>(&row_count_)) + sizeof(built_count_));
   _internal_metadata_.Clear();
 }
 
@@ -8341,6 +8410,20 @@ const char* SegmentStat::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // string build_stage = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_build_stage(), ptr, ctx, "milvus.grpc.SegmentStat.build_stage");
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 built_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          built_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -8427,6 +8510,34 @@ bool SegmentStat::MergePartialFromCodedStream(
         break;
       }
 
+      // string build_stage = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_build_stage()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->build_stage().data(), static_cast<int>(this->build_stage().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.SegmentStat.build_stage"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 built_count = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (48 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &built_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -8484,6 +8595,21 @@ void SegmentStat::SerializeWithCachedSizes(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(4, this->data_size(), output);
   }
 
+  // string build_stage = 5;
+  if (this->build_stage().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->build_stage().data(), static_cast<int>(this->build_stage().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.SegmentStat.build_stage");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      5, this->build_stage(), output);
+  }
+
+  // int64 built_count = 6;
+  if (this->built_count() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(6, this->built_count(), output);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
         _internal_metadata_.unknown_fields(), output);
@@ -8529,6 +8655,22 @@ void SegmentStat::SerializeWithCachedSizes(
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(4, this->data_size(), target);
   }
 
+  // string build_stage = 5;
+  if (this->build_stage().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->build_stage().data(), static_cast<int>(this->build_stage().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.SegmentStat.build_stage");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        5, this->build_stage(), target);
+  }
+
+  // int64 built_count = 6;
+  if (this->built_count() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(6, this->built_count(), target);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields(), target);
@@ -8564,6 +8706,13 @@ size_t SegmentStat::ByteSizeLong() const {
         this->index_name());
   }
 
+  // string build_stage = 5;
+  if (this->build_stage().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->build_stage());
+  }
+
   // int64 row_count = 2;
   if (this->row_count() != 0) {
     total_size += 1 +
@@ -8578,6 +8727,13 @@ size_t SegmentStat::ByteSizeLong() const {
         this->data_size());
   }
 
+  // int64 built_count = 6;
+  if (this->built_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->built_count());
+  }
+
   int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -8613,12 +8769,19 @@ void SegmentStat::MergeFrom(const SegmentStat& from) {
 
     index_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.index_name_);
   }
+  if (from.build_stage().size() > 0) {
+
+    build_stage_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.build_stage_);
+  }
   if (from.row_count() != 0) {
     set_row_count(from.row_count());
   }
   if (from.data_size() != 0) {
     set_data_size(from.data_size());
   }
+  if (from.built_count() != 0) {
+    set_built_count(from.built_count());
+  }
 }
 
 void SegmentStat::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -8646,8 +8809,11 @@ void SegmentStat::InternalSwap(SegmentStat* other) {
     GetArenaNoVirtual());
   index_name_.Swap(&other->index_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
+  build_stage_.Swap(&other->build_stage_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
   swap(row_count_, other->row_count_);
   swap(data_size_, other->data_size_);
+  swap(built_count_, other->built_count_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SegmentStat::GetMetadata() const {
@@ -2223,6 +2223,7 @@ class TopKQueryResult :
   enum : int {
     kIdsFieldNumber = 3,
     kDistancesFieldNumber = 4,
+    kExtraParamsFieldNumber = 5,
     kStatusFieldNumber = 1,
     kRowNumFieldNumber = 2,
   };
@@ -2248,6 +2249,17 @@ class TopKQueryResult :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
       mutable_distances();
 
+  // repeated .milvus.grpc.KeyValuePair extra_params = 5;
+  int extra_params_size() const;
+  void clear_extra_params();
+  ::milvus::grpc::KeyValuePair* mutable_extra_params(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
+      mutable_extra_params();
+  const ::milvus::grpc::KeyValuePair& extra_params(int index) const;
+  ::milvus::grpc::KeyValuePair* add_extra_params();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
+      extra_params() const;
+
   // .milvus.grpc.Status status = 1;
   bool has_status() const;
   void clear_status();
@@ -2270,6 +2282,7 @@ class TopKQueryResult :
   mutable std::atomic<int> _ids_cached_byte_size_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > distances_;
   mutable std::atomic<int> _distances_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair > extra_params_;
   ::milvus::grpc::Status* status_;
   ::PROTOBUF_NAMESPACE_ID::int64 row_num_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
@@ -3419,8 +3432,10 @@ class SegmentStat :
   enum : int {
     kSegmentNameFieldNumber = 1,
     kIndexNameFieldNumber = 3,
+    kBuildStageFieldNumber = 5,
     kRowCountFieldNumber = 2,
     kDataSizeFieldNumber = 4,
+    kBuiltCountFieldNumber = 6,
   };
   // string segment_name = 1;
   void clear_segment_name();
@@ -3444,6 +3459,17 @@ class SegmentStat :
   std::string* release_index_name();
   void set_allocated_index_name(std::string* index_name);
 
+  // string build_stage = 5;
+  void clear_build_stage();
+  const std::string& build_stage() const;
+  void set_build_stage(const std::string& value);
+  void set_build_stage(std::string&& value);
+  void set_build_stage(const char* value);
+  void set_build_stage(const char* value, size_t size);
+  std::string* mutable_build_stage();
+  std::string* release_build_stage();
+  void set_allocated_build_stage(std::string* build_stage);
+
   // int64 row_count = 2;
   void clear_row_count();
   ::PROTOBUF_NAMESPACE_ID::int64 row_count() const;
@@ -3454,6 +3480,11 @@ class SegmentStat :
   ::PROTOBUF_NAMESPACE_ID::int64 data_size() const;
   void set_data_size(::PROTOBUF_NAMESPACE_ID::int64 value);
 
+  // int64 built_count = 6;
+  void clear_built_count();
+  ::PROTOBUF_NAMESPACE_ID::int64 built_count() const;
+  void set_built_count(::PROTOBUF_NAMESPACE_ID::int64 value);
+
   // @@protoc_insertion_point(class_scope:milvus.grpc.SegmentStat)
  private:
   class _Internal;
@@ -3461,8 +3492,10 @@ class SegmentStat :
   ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr segment_name_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr build_stage_;
   ::PROTOBUF_NAMESPACE_ID::int64 row_count_;
   ::PROTOBUF_NAMESPACE_ID::int64 data_size_;
+  ::PROTOBUF_NAMESPACE_ID::int64 built_count_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_milvus_2eproto;
 };
@@ -5864,6 +5897,36 @@ TopKQueryResult::mutable_distances() {
   return &distances_;
 }
 
+// repeated .milvus.grpc.KeyValuePair extra_params = 5;
+inline int TopKQueryResult::extra_params_size() const {
+  return extra_params_.size();
+}
+inline void TopKQueryResult::clear_extra_params() {
+  extra_params_.Clear();
+}
+inline ::milvus::grpc::KeyValuePair* TopKQueryResult::mutable_extra_params(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.TopKQueryResult.extra_params)
+  return extra_params_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
+TopKQueryResult::mutable_extra_params() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.TopKQueryResult.extra_params)
+  return &extra_params_;
+}
+inline const ::milvus::grpc::KeyValuePair& TopKQueryResult::extra_params(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.TopKQueryResult.extra_params)
+  return extra_params_.Get(index);
+}
+inline ::milvus::grpc::KeyValuePair* TopKQueryResult::add_extra_params() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.TopKQueryResult.extra_params)
+  return extra_params_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
+TopKQueryResult::extra_params() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.TopKQueryResult.extra_params)
+  return extra_params_;
+}
+
 // -------------------------------------------------------------------
 
 // StringReply
@@ -6577,6 +6640,71 @@ inline void SegmentStat::set_data_size(::PROTOBUF_NAMESPACE_ID::int64 value) {
   // @@protoc_insertion_point(field_set:milvus.grpc.SegmentStat.data_size)
 }
 
+// string build_stage = 5;
+inline void SegmentStat::clear_build_stage() {
+  build_stage_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& SegmentStat::build_stage() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SegmentStat.build_stage)
+  return build_stage_.GetNoArena();
+}
+inline void SegmentStat::set_build_stage(const std::string& value) {
+  
+  build_stage_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.SegmentStat.build_stage)
+}
+inline void SegmentStat::set_build_stage(std::string&& value) {
+  
+  build_stage_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.SegmentStat.build_stage)
+}
+inline void SegmentStat::set_build_stage(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  build_stage_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.SegmentStat.build_stage)
+}
+inline void SegmentStat::set_build_stage(const char* value, size_t size) {
+  
+  build_stage_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.SegmentStat.build_stage)
+}
+inline std::string* SegmentStat::mutable_build_stage() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.SegmentStat.build_stage)
+  return build_stage_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* SegmentStat::release_build_stage() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.SegmentStat.build_stage)
+  
+  return build_stage_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void SegmentStat::set_allocated_build_stage(std::string* build_stage) {
+  if (build_stage != nullptr) {
+    
+  } else {
+    
+  }
+  build_stage_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), build_stage);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.SegmentStat.build_stage)
+}
+
+// int64 built_count = 6;
+inline void SegmentStat::clear_built_count() {
+  built_count_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 SegmentStat::built_count() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SegmentStat.built_count)
+  return built_count_;
+}
+inline void SegmentStat::set_built_count(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  built_count_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.SegmentStat.built_count)
+}
+
 // -------------------------------------------------------------------
 
 // PartitionStat
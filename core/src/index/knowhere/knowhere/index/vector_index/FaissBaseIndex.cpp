@@ -11,7 +11,10 @@
 
 #include <faiss/index_io.h>
 #include <fiu-local.h>
+#include <algorithm>
+#include <limits>
 #include <utility>
+#include <vector>
 
 #include "knowhere/common/Exception.h"
 #include "knowhere/common/Log.h"
@@ -53,6 +56,8 @@ FaissBaseIndex::LoadImpl(const BinarySet& index_binary) {
     MemoryIOReader reader;
     reader.total = binary->size;
     reader.data_ = binary->data.get();
+    // inverted lists reference the binary in place, it stays alive as long as the index
+    reader.owner_ = binary->data;
 
     faiss::Index* index = faiss::read_index(&reader);
 
@@ -75,4 +80,39 @@ FaissBaseIndex::SealImpl() {
 #endif
 }
 
+DatasetPtr
+FaissBaseIndex::RangeResultToDataset(const faiss::RangeSearchResult& result, int64_t k,
+                                     const faiss::ConcurrentBitsetPtr& bitset) {
+    bool ascending = (index_->metric_type != faiss::METRIC_INNER_PRODUCT);
+    float padding = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    int64_t nq = result.nq;
+    auto p_id = (int64_t*)malloc(sizeof(int64_t) * nq * k);
+    auto p_dist = (float*)malloc(sizeof(float) * nq * k);
+
+    std::vector<std::pair<float, int64_t>> hits;
+    for (int64_t i = 0; i < nq; ++i) {
+        hits.clear();
+        for (size_t j = result.lims[i]; j < result.lims[i + 1]; ++j) {
+            if (bitset == nullptr || !bitset->test(result.labels[j])) {
+                hits.emplace_back(result.distances[j], result.labels[j]);
+            }
+        }
+
+        auto count = std::min<int64_t>(k, hits.size());
+        auto compare = [ascending](const std::pair<float, int64_t>& a, const std::pair<float, int64_t>& b) {
+            return ascending ? a < b : a > b;
+        };
+        std::partial_sort(hits.begin(), hits.begin() + count, hits.end(), compare);
+        for (int64_t j = 0; j < k; ++j) {
+            p_id[i * k + j] = j < count ? hits[j].second : -1;
+            p_dist[i * k + j] = j < count ? hits[j].first : padding;
+        }
+    }
+
+    auto ret_ds = std::make_shared<Dataset>();
+    ret_ds->Set(meta::IDS, p_id);
+    ret_ds->Set(meta::DISTANCE, p_dist);
+    return ret_ds;
+}
+
 }  // namespace knowhere
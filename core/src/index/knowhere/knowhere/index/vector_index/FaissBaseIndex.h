@@ -14,8 +14,11 @@
 #include <memory>
 
 #include <faiss/Index.h>
+#include <faiss/impl/AuxIndexStructures.h>
+#include <faiss/utils/ConcurrentBitset.h>
 
 #include "knowhere/common/BinarySet.h"
+#include "knowhere/common/Dataset.h"
 
 namespace knowhere {
 
@@ -32,6 +35,10 @@ class FaissBaseIndex {
     virtual void
     SealImpl();
 
+    // keep at most k results per query which are not in bitset, nearest first, padded with -1
+    DatasetPtr
+    RangeResultToDataset(const faiss::RangeSearchResult& result, int64_t k, const faiss::ConcurrentBitsetPtr& bitset);
+
  public:
     std::shared_ptr<faiss::Index> index_ = nullptr;
 };
@@ -51,7 +51,8 @@ BinaryIDMAP::Search(const DatasetPtr& dataset, const Config& config) {
     auto p_id = (int64_t*)malloc(p_id_size);
     auto p_dist = (float*)malloc(p_dist_size);
 
-    search_impl(rows, (uint8_t*)p_data, config[meta::TOPK].get<int64_t>(), p_dist, p_id, Config());
+    auto bitset = SearchBitset(dataset, bitset_);
+    search_impl(rows, (uint8_t*)p_data, config[meta::TOPK].get<int64_t>(), p_dist, p_id, Config(), bitset);
 
     auto ret_ds = std::make_shared<Dataset>();
     if (index_->metric_type == faiss::METRIC_Hamming) {
@@ -72,9 +73,9 @@ BinaryIDMAP::Search(const DatasetPtr& dataset, const Config& config) {
 
 void
 BinaryIDMAP::search_impl(int64_t n, const uint8_t* data, int64_t k, float* distances, int64_t* labels,
-                         const Config& cfg) {
+                         const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset) {
     int32_t* pdistances = (int32_t*)distances;
-    index_->search(n, (uint8_t*)data, k, pdistances, labels, bitset_);
+    index_->search(n, (uint8_t*)data, k, pdistances, labels, bitset);
 }
 
 void
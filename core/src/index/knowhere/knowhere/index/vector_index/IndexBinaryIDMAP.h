@@ -77,7 +77,8 @@ class BinaryIDMAP : public VectorIndex, public FaissBaseBinaryIndex {
 
  protected:
     virtual void
-    search_impl(int64_t n, const uint8_t* data, int64_t k, float* distances, int64_t* labels, const Config& cfg);
+    search_impl(int64_t n, const uint8_t* data, int64_t k, float* distances, int64_t* labels,
+                const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset);
 
  protected:
     std::mutex mutex_;
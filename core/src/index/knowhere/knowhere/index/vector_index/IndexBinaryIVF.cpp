@@ -57,7 +57,8 @@ BinaryIVF::Search(const DatasetPtr& dataset, const Config& config) {
         auto p_id = (int64_t*)malloc(p_id_size);
         auto p_dist = (float*)malloc(p_dist_size);
 
-        search_impl(rows, (uint8_t*)p_data, config[meta::TOPK].get<int64_t>(), p_dist, p_id, config);
+        auto bitset = SearchBitset(dataset, bitset_);
+        search_impl(rows, (uint8_t*)p_data, config[meta::TOPK].get<int64_t>(), p_dist, p_id, config, bitset);
 
         auto ret_ds = std::make_shared<Dataset>();
         if (index_->metric_type == faiss::METRIC_Hamming) {
@@ -83,23 +84,22 @@ BinaryIVF::Search(const DatasetPtr& dataset, const Config& config) {
 
 void
 BinaryIVF::search_impl(int64_t n, const uint8_t* data, int64_t k, float* distances, int64_t* labels,
-                       const Config& cfg) {
+                       const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset) {
+    // parameters and stats belong to this call, the shared index is not modified
     auto params = GenParams(cfg);
+    faiss::IndexIVFStats stats;
+    params->stats = &stats;
     auto ivf_index = dynamic_cast<faiss::IndexBinaryIVF*>(index_.get());
-    ivf_index->nprobe = params->nprobe;
     int32_t* pdistances = (int32_t*)distances;
     stdclock::time_point before = stdclock::now();
 
-    // todo: remove static cast (zhiru)
-    static_cast<faiss::IndexBinary*>(index_.get())->search(n, (uint8_t*)data, k, pdistances, labels, bitset_);
+    ivf_index->search_with_parameters(n, (uint8_t*)data, k, pdistances, labels, params.get(), bitset);
 
     stdclock::time_point after = stdclock::now();
     double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
-    KNOWHERE_LOG_DEBUG << "IVF search cost: " << search_cost
-                       << ", quantization cost: " << faiss::indexIVF_stats.quantization_time
-                       << ", data search cost: " << faiss::indexIVF_stats.search_time;
-    faiss::indexIVF_stats.quantization_time = 0;
-    faiss::indexIVF_stats.search_time = 0;
+    KNOWHERE_LOG_DEBUG << "IVF search cost: " << search_cost << ", quantization cost: " << stats.quantization_time
+                       << ", data search cost: " << stats.search_time << ", lists scanned: " << stats.nlist
+                       << ", distances computed: " << stats.ndis;
 }
 
 std::shared_ptr<faiss::IVFSearchParameters>
@@ -72,7 +72,8 @@ class BinaryIVF : public VectorIndex, public FaissBaseBinaryIndex {
     GenParams(const Config& config);
 
     virtual void
-    search_impl(int64_t n, const uint8_t* data, int64_t k, float* distances, int64_t* labels, const Config& cfg);
+    search_impl(int64_t n, const uint8_t* data, int64_t k, float* distances, int64_t* labels,
+                const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset);
 
  protected:
     std::mutex mutex_;
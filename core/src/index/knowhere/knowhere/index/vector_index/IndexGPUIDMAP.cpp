@@ -118,7 +118,8 @@ GPUIDMAP::GetRawIds() {
 }
 
 void
-GPUIDMAP::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) {
+GPUIDMAP::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                      const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset) {
     ResScope rs(res_, gpu_id_);
     index_->search(n, (float*)data, k, distances, labels);
 }
@@ -144,7 +145,7 @@ GPUIDMAP::GenGraph(const float* data, const int64_t& k, Graph& graph, const Conf
         res.resize(K * b_size);
 
         auto xq = data + batch_size * dim * i;
-        search_impl(b_size, (float*)xq, K, res_dis.data(), res.data(), config);
+        search_impl(b_size, (float*)xq, K, res_dis.data(), res.data(), config, nullptr);
 
         for (int j = 0; j < b_size; ++j) {
             auto& node = graph[batch_size * i + j];
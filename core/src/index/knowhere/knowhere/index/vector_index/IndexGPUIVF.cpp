@@ -39,7 +39,10 @@ GPUIVF::Train(const DatasetPtr& dataset, const Config& config) {
         idx_config.device = gpu_id_;
         faiss::gpu::GpuIndexIVFFlat device_index(temp_resource->faiss_res.get(), dim, config[IndexParams::nlist],
                                                  GetMetricType(config[Metric::TYPE].get<std::string>()), idx_config);
-        device_index.train(rows, (float*)p_data);
+        int64_t train_rows = 0;
+        std::vector<float> buffer;
+        auto train_data = GetTrainData(dataset, config, train_rows, buffer);
+        device_index.train(train_rows, train_data);
 
         std::shared_ptr<faiss::Index> host_index = nullptr;
         host_index.reset(faiss::gpu::index_gpu_to_cpu(&device_index));
@@ -117,7 +120,8 @@ GPUIVF::LoadImpl(const BinarySet& index_binary) {
 }
 
 void
-GPUIVF::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& config) {
+GPUIVF::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                    const Config& config, const faiss::ConcurrentBitsetPtr& bitset) {
     std::lock_guard<std::mutex> lk(mutex_);
 
     auto device_index = std::dynamic_pointer_cast<faiss::gpu::GpuIndexIVF>(index_);
@@ -74,7 +74,8 @@ class GPUIVF : public IVF, public GPUIndex {
 
  protected:
     void
-    search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) override;
+    search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset) override;
 
     BinarySet
     SerializeImpl() override;
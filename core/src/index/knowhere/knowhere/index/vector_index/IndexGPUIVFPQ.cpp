@@ -21,6 +21,7 @@
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/IndexGPUIVFPQ.h"
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/helpers/TrainSampler.h"
 
 namespace knowhere {
 
@@ -36,7 +37,12 @@ GPUIVFPQ::Train(const DatasetPtr& dataset, const Config& config) {
             temp_resource->faiss_res.get(), dim, config[IndexParams::nlist].get<int64_t>(), config[IndexParams::m],
             config[IndexParams::nbits],
             GetMetricType(config[Metric::TYPE].get<std::string>()));  // IP not support
-        device_index->train(rows, (float*)p_data);
+        int64_t train_rows = 0;
+        std::vector<float> buffer;
+        auto centroids = PQTrainCentroids(config[IndexParams::nlist].get<int64_t>(),
+                                          config[IndexParams::nbits].get<int64_t>());
+        auto train_data = GetTrainData(dataset, config, train_rows, buffer, centroids);
+        device_index->train(train_rows, train_data);
         std::shared_ptr<faiss::Index> host_index = nullptr;
         host_index.reset(faiss::gpu::index_gpu_to_cpu(device_index));
         return std::make_shared<IVFIndexModel>(host_index);
@@ -37,7 +37,10 @@ GPUIVFSQ::Train(const DatasetPtr& dataset, const Config& config) {
     if (temp_resource != nullptr) {
         ResScope rs(temp_resource, gpu_id_, true);
         auto device_index = faiss::gpu::index_cpu_to_gpu(temp_resource->faiss_res.get(), gpu_id_, build_index);
-        device_index->train(rows, (float*)p_data);
+        int64_t train_rows = 0;
+        std::vector<float> buffer;
+        auto train_data = GetTrainData(dataset, config, train_rows, buffer);
+        device_index->train(train_rows, train_data);
 
         std::shared_ptr<faiss::Index> host_index = nullptr;
         host_index.reset(faiss::gpu::index_gpu_to_cpu(device_index));
@@ -63,6 +63,8 @@ IndexHNSW::Load(const BinarySet& index_binary) {
         MemoryIOReader reader;
         reader.total = binary->size;
         reader.data_ = binary->data.get();
+        // graph and vectors reference the binary in place, it stays alive as long as the index
+        reader.owner_ = binary->data;
 
         hnswlib::SpaceInterface<float>* space;
         index_ = std::make_shared<hnswlib::HierarchicalNSW<float>>(space);
@@ -86,7 +88,8 @@ IndexHNSW::Search(const DatasetPtr& dataset, const Config& config) {
     auto p_id = (int64_t*)malloc(id_size * rows);
     auto p_dist = (float*)malloc(dist_size * rows);
 
-    index_->setEf(config[IndexParams::ef]);
+    // ef is passed per query, the shared index is not modified
+    size_t ef = config[IndexParams::ef].get<int64_t>();
 
     using P = std::pair<float, int64_t>;
     auto compare = [](const P& v1, const P& v2) { return v1.first < v2.first; };
@@ -102,7 +105,7 @@ IndexHNSW::Search(const DatasetPtr& dataset, const Config& config) {
         // } else {
         //     ret = index_->searchKnn((float*)single_query, config[meta::TOPK].get<int64_t>(), compare);
         // }
-        ret = index_->searchKnn((float*)single_query, config[meta::TOPK].get<int64_t>(), compare);
+        ret = index_->searchKnnWithEf((float*)single_query, config[meta::TOPK].get<int64_t>(), ef, compare);
 
         while (ret.size() < config[meta::TOPK]) {
             ret.push_back(std::make_pair(-1, -1));
@@ -68,7 +68,8 @@ IDMAP::Search(const DatasetPtr& dataset, const Config& config) {
     auto p_id = (int64_t*)malloc(p_id_size);
     auto p_dist = (float*)malloc(p_dist_size);
 
-    search_impl(rows, (float*)p_data, config[meta::TOPK].get<int64_t>(), p_dist, p_id, Config());
+    auto bitset = SearchBitset(dataset, bitset_);
+    search_impl(rows, (float*)p_data, config[meta::TOPK].get<int64_t>(), p_dist, p_id, Config(), bitset);
 
     auto ret_ds = std::make_shared<Dataset>();
     ret_ds->Set(meta::IDS, p_id);
@@ -76,9 +77,30 @@ IDMAP::Search(const DatasetPtr& dataset, const Config& config) {
     return ret_ds;
 }
 
+bool
+IDMAP::SupportRangeSearch() {
+    // the flat index inside is moved to gpu by CopyCpuToGpu, gpu indexes have no range search
+    auto id_map = dynamic_cast<faiss::IndexIDMap*>(index_.get());
+    return id_map != nullptr && dynamic_cast<faiss::IndexFlat*>(id_map->index) != nullptr;
+}
+
+DatasetPtr
+IDMAP::RangeSearch(const DatasetPtr& dataset, const Config& config) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    GETTENSOR(dataset)
+
+    // labels of the id map are the offsets of rows, the same as bitset positions
+    faiss::RangeSearchResult result(rows);
+    index_->range_search(rows, (float*)p_data, config[meta::RADIUS].get<float>(), &result);
+    return RangeResultToDataset(result, config[meta::TOPK].get<int64_t>(), SearchBitset(dataset, bitset_));
+}
+
 void
-IDMAP::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) {
-    index_->search(n, (float*)data, k, distances, labels, bitset_);
+IDMAP::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                   const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset) {
+    index_->search(n, (float*)data, k, distances, labels, bitset);
 }
 
 void
@@ -39,6 +39,12 @@ class IDMAP : public VectorIndex, public FaissBaseIndex {
     DatasetPtr
     Search(const DatasetPtr& dataset, const Config& config) override;
 
+    bool
+    SupportRangeSearch() override;
+
+    DatasetPtr
+    RangeSearch(const DatasetPtr& dataset, const Config& config) override;
+
     int64_t
     Count() override;
 
@@ -80,7 +86,8 @@ class IDMAP : public VectorIndex, public FaissBaseIndex {
 
  protected:
     virtual void
-    search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg);
+    search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset);
 
  protected:
     std::mutex mutex_;
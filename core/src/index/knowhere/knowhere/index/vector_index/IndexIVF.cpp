@@ -37,6 +37,7 @@
 #include "knowhere/index/vector_index/IndexGPUIVF.h"
 #endif
 #include "knowhere/index/vector_index/IndexIVF.h"
+#include "knowhere/index/vector_index/helpers/TrainSampler.h"
 
 namespace knowhere {
 
@@ -49,12 +50,32 @@ IVF::Train(const DatasetPtr& dataset, const Config& config) {
     faiss::Index* coarse_quantizer = new faiss::IndexFlatL2(dim);
     auto index = std::make_shared<faiss::IndexIVFFlat>(coarse_quantizer, dim, config[IndexParams::nlist].get<int64_t>(),
                                                        GetMetricType(config[Metric::TYPE].get<std::string>()));
-    index->train(rows, (float*)p_data);
+    int64_t train_rows = 0;
+    std::vector<float> buffer;
+    auto train_data = GetTrainData(dataset, config, train_rows, buffer);
+    index->train(train_rows, train_data);
 
     // TODO(linxj): override here. train return model or not.
     return std::make_shared<IVFIndexModel>(index);
 }
 
+const float*
+IVF::GetTrainData(const DatasetPtr& dataset, const Config& config, int64_t& train_rows, std::vector<float>& buffer,
+                  int64_t centroids) {
+    GETTENSOR(dataset)
+
+    if (centroids <= 0) {
+        centroids = config[IndexParams::nlist].get<int64_t>();
+    }
+    auto points_per_centroid =
+        config.value(IndexParams::train_points_per_centroid, DEFAULT_TRAIN_POINTS_PER_CENTROID);
+    train_rows = TrainSampleRows(rows, centroids, points_per_centroid);
+    if (train_rows < rows) {
+        KNOWHERE_LOG_DEBUG << "IVF trains on " << train_rows << " of " << rows << " rows";
+    }
+    return SampleTrainData(p_data, rows, dim, train_rows, buffer);
+}
+
 void
 IVF::Add(const DatasetPtr& dataset, const Config& config) {
     if (!index_ || !index_->is_trained) {
@@ -114,7 +135,8 @@ IVF::Search(const DatasetPtr& dataset, const Config& config) {
         auto p_id = (int64_t*)malloc(p_id_size);
         auto p_dist = (float*)malloc(p_dist_size);
 
-        search_impl(rows, (float*)p_data, config[meta::TOPK].get<int64_t>(), p_dist, p_id, config);
+        auto bitset = SearchBitset(dataset, bitset_);
+        search_impl(rows, (float*)p_data, config[meta::TOPK].get<int64_t>(), p_dist, p_id, config, bitset);
 
         //    std::stringstream ss_res_id, ss_res_dist;
         //    for (int i = 0; i < 10; ++i) {
@@ -150,6 +172,32 @@ IVF::set_index_model(IndexModelPtr model) {
     index_.reset(faiss::clone_index(rel_model->index_.get()));
 }
 
+bool
+IVF::SupportRangeSearch() {
+    return dynamic_cast<faiss::IndexIVF*>(index_.get()) != nullptr;
+}
+
+DatasetPtr
+IVF::RangeSearch(const DatasetPtr& dataset, const Config& config) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+    GETTENSOR(dataset)
+
+    try {
+        auto params = GenParams(config);
+        auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+        faiss::RangeSearchResult result(rows);
+        ivf_index->range_search_with_parameters(rows, (float*)p_data, config[meta::RADIUS].get<float>(), &result,
+                                                params.get());
+        return RangeResultToDataset(result, config[meta::TOPK].get<int64_t>(), SearchBitset(dataset, bitset_));
+    } catch (faiss::FaissException& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
 std::shared_ptr<faiss::IVFSearchParameters>
 IVF::GenParams(const Config& config) {
     auto params = std::make_shared<faiss::IVFSearchParameters>();
@@ -191,7 +239,7 @@ IVF::GenGraph(const float* data, const int64_t& k, Graph& graph, const Config& c
         res.resize(K * b_size);
 
         auto xq = data + batch_size * dim * i;
-        search_impl(b_size, (float*)xq, K, res_dis.data(), res.data(), config);
+        search_impl(b_size, (float*)xq, K, res_dis.data(), res.data(), config, bitset_);
 
         for (int j = 0; j < b_size; ++j) {
             auto& node = graph[batch_size * i + j];
@@ -205,19 +253,20 @@ IVF::GenGraph(const float* data, const int64_t& k, Graph& graph, const Config& c
 }
 
 void
-IVF::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) {
+IVF::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                 const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset) {
+    // parameters and stats belong to this call, the shared index is not modified
     auto params = GenParams(cfg);
+    faiss::IndexIVFStats stats;
+    params->stats = &stats;
     auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
-    ivf_index->nprobe = params->nprobe;
     stdclock::time_point before = stdclock::now();
-    ivf_index->search(n, (float*)data, k, distances, labels, bitset_);
+    ivf_index->search_with_parameters(n, (float*)data, k, distances, labels, params.get(), bitset);
     stdclock::time_point after = stdclock::now();
     double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
-    KNOWHERE_LOG_DEBUG << "IVF search cost: " << search_cost
-                       << ", quantization cost: " << faiss::indexIVF_stats.quantization_time
-                       << ", data search cost: " << faiss::indexIVF_stats.search_time;
-    faiss::indexIVF_stats.quantization_time = 0;
-    faiss::indexIVF_stats.search_time = 0;
+    KNOWHERE_LOG_DEBUG << "IVF search cost: " << search_cost << ", quantization cost: " << stats.quantization_time
+                       << ", data search cost: " << stats.search_time << ", lists scanned: " << stats.nlist
+                       << ", distances computed: " << stats.ndis;
 }
 
 VectorIndexPtr
@@ -51,6 +51,12 @@ class IVF : public VectorIndex, public FaissBaseIndex {
     DatasetPtr
     Search(const DatasetPtr& dataset, const Config& config) override;
 
+    bool
+    SupportRangeSearch() override;
+
+    DatasetPtr
+    RangeSearch(const DatasetPtr& dataset, const Config& config) override;
+
     void
     GenGraph(const float* data, const int64_t& k, Graph& graph, const Config& config);
 
@@ -92,7 +98,14 @@ class IVF : public VectorIndex, public FaissBaseIndex {
     //    Clone_impl(const std::shared_ptr<faiss::Index>& index);
 
     virtual void
-    search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg);
+    search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset);
+
+    // the rows to train `centroids` k-means centroids on (nlist when 0), a uniform sample kept in buffer for large
+    // datasets
+    static const float*
+    GetTrainData(const DatasetPtr& dataset, const Config& config, int64_t& train_rows, std::vector<float>& buffer,
+                 int64_t centroids = 0);
 
  protected:
     std::mutex mutex_;
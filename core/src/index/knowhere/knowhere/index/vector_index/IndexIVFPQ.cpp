@@ -26,6 +26,7 @@
 #include "knowhere/index/vector_index/IndexGPUIVFPQ.h"
 #endif
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/helpers/TrainSampler.h"
 
 namespace knowhere {
 
@@ -37,7 +38,12 @@ IVFPQ::Train(const DatasetPtr& dataset, const Config& config) {
     auto index = std::make_shared<faiss::IndexIVFPQ>(coarse_quantizer, dim, config[IndexParams::nlist].get<int64_t>(),
                                                      config[IndexParams::m].get<int64_t>(),
                                                      config[IndexParams::nbits].get<int64_t>());
-    index->train(rows, (float*)p_data);
+    int64_t train_rows = 0;
+    std::vector<float> buffer;
+    auto centroids = PQTrainCentroids(config[IndexParams::nlist].get<int64_t>(),
+                                      config[IndexParams::nbits].get<int64_t>());
+    auto train_data = GetTrainData(dataset, config, train_rows, buffer, centroids);
+    index->train(train_rows, train_data);
 
     return std::make_shared<IVFIndexModel>(index);
 }
@@ -38,7 +38,10 @@ IVFSQ::Train(const DatasetPtr& dataset, const Config& config) {
                << "SQ" << config[IndexParams::nbits];
     auto build_index =
         faiss::index_factory(dim, index_type.str().c_str(), GetMetricType(config[Metric::TYPE].get<std::string>()));
-    build_index->train(rows, (float*)p_data);
+    int64_t train_rows = 0;
+    std::vector<float> buffer;
+    auto train_data = GetTrainData(dataset, config, train_rows, buffer);
+    build_index->train(train_rows, train_data);
 
     std::shared_ptr<faiss::Index> ret_index;
     ret_index.reset(build_index);
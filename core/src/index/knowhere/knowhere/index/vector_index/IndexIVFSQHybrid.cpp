@@ -44,7 +44,10 @@ IVFSQHybrid::Train(const DatasetPtr& dataset, const Config& config) {
     if (temp_resource != nullptr) {
         ResScope rs(temp_resource, gpu_id_, true);
         auto device_index = faiss::gpu::index_cpu_to_gpu(temp_resource->faiss_res.get(), gpu_id_, build_index);
-        device_index->train(rows, (float*)p_data);
+        int64_t train_rows = 0;
+        std::vector<float> buffer;
+        auto train_data = GetTrainData(dataset, config, train_rows, buffer);
+        device_index->train(train_rows, train_data);
 
         std::shared_ptr<faiss::Index> host_index = nullptr;
         host_index.reset(faiss::gpu::index_gpu_to_cpu(device_index));
@@ -108,23 +111,23 @@ IVFSQHybrid::LoadImpl(const BinarySet& index_binary) {
 
 void
 IVFSQHybrid::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
-                         const Config& cfg) {
+                         const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset) {
     //        std::lock_guard<std::mutex> lk(g_mutex);
     //        static int64_t search_count;
     //        ++search_count;
 
     if (gpu_mode == 2) {
-        GPUIVF::search_impl(n, data, k, distances, labels, cfg);
+        GPUIVF::search_impl(n, data, k, distances, labels, cfg, bitset);
         //        index_->search(n, (float*)data, k, distances, labels);
     } else if (gpu_mode == 1) {  // hybrid
         if (auto res = FaissGpuResourceMgr::GetInstance().GetRes(quantizer_gpu_id_)) {
             ResScope rs(res, quantizer_gpu_id_, true);
-            IVF::search_impl(n, data, k, distances, labels, cfg);
+            IVF::search_impl(n, data, k, distances, labels, cfg, bitset);
         } else {
             KNOWHERE_THROW_MSG("Hybrid Search Error, can't get gpu: " + std::to_string(quantizer_gpu_id_) + "resource");
         }
     } else if (gpu_mode == 0) {
-        IVF::search_impl(n, data, k, distances, labels, cfg);
+        IVF::search_impl(n, data, k, distances, labels, cfg, bitset);
     }
 }
 
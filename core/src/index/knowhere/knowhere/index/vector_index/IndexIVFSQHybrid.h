@@ -80,7 +80,8 @@ class IVFSQHybrid : public GPUIVFSQ {
 
  protected:
     void
-    search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) override;
+    search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                const Config& cfg, const faiss::ConcurrentBitsetPtr& bitset) override;
 
     void
     LoadImpl(const BinarySet& index_binary) override;
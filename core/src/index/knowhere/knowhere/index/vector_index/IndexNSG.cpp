@@ -11,6 +11,8 @@
 
 #include "knowhere/index/vector_index/IndexNSG.h"
 
+#include <algorithm>
+
 #include "knowhere/adapter/VectorAdapter.h"
 #include "knowhere/common/Exception.h"
 #include "knowhere/common/Timer.h"
@@ -27,6 +29,7 @@
 
 #include "knowhere/index/vector_index/IndexIDMAP.h"
 #include "knowhere/index/vector_index/IndexIVF.h"
+#include "knowhere/index/vector_index/nsg/NNDescent.h"
 #include "knowhere/index/vector_index/nsg/NSG.h"
 #include "knowhere/index/vector_index/nsg/NSGIO.h"
 
@@ -96,12 +99,11 @@ NSG::Search(const DatasetPtr& dataset, const Config& config) {
     return ret_ds;
 }
 
-IndexModelPtr
-NSG::Train(const DatasetPtr& dataset, const Config& config) {
+void
+NSG::GenKnnGraphByIVF(const DatasetPtr& dataset, int64_t k, Graph& knng, const Config& config) {
     auto idmap = std::make_shared<IDMAP>();
     idmap->Train(config);
     idmap->AddWithoutId(dataset, config);
-    Graph knng;
     const float* raw_data = idmap->GetRawVectors();
 #ifdef MILVUS_GPU_VERSION
     if (config[knowhere::meta::DEVICEID].get<int64_t>() == -1) {
@@ -109,19 +111,36 @@ NSG::Train(const DatasetPtr& dataset, const Config& config) {
         auto model = preprocess_index->Train(dataset, config);
         preprocess_index->set_index_model(model);
         preprocess_index->AddWithoutIds(dataset, config);
-        preprocess_index->GenGraph(raw_data, config[IndexParams::knng].get<int64_t>(), knng, config);
+        preprocess_index->GenGraph(raw_data, k, knng, config);
     } else {
         auto gpu_idx = cloner::CopyCpuToGpu(idmap, config[knowhere::meta::DEVICEID].get<int64_t>(), config);
         auto gpu_idmap = std::dynamic_pointer_cast<GPUIDMAP>(gpu_idx);
-        gpu_idmap->GenGraph(raw_data, config[IndexParams::knng].get<int64_t>(), knng, config);
+        gpu_idmap->GenGraph(raw_data, k, knng, config);
     }
 #else
     auto preprocess_index = std::make_shared<IVF>();
     auto model = preprocess_index->Train(dataset, config);
     preprocess_index->set_index_model(model);
     preprocess_index->AddWithoutIds(dataset, config);
-    preprocess_index->GenGraph(raw_data, config[IndexParams::knng].get<int64_t>(), knng, config);
+    preprocess_index->GenGraph(raw_data, k, knng, config);
 #endif
+}
+
+IndexModelPtr
+NSG::Train(const DatasetPtr& dataset, const Config& config) {
+    GETTENSOR(dataset)
+    auto knng_k = config[IndexParams::knng].get<int64_t>();
+    Graph knng;
+    if (config.contains(IndexParams::knng_builder) &&
+        config[IndexParams::knng_builder].get<std::string>() == KnngBuilder::NN_DESCENT) {
+        algo::NNDescentParams nnd_params;
+        nnd_params.k = knng_k;
+        nnd_params.pool_size = knng_k + knng_k / 2;
+        nnd_params.sample = std::min<int64_t>(knng_k, 32);
+        algo::BuildKnnGraphByNNDescent(p_data, rows, dim, nnd_params, knng);
+    } else {
+        GenKnnGraphByIVF(dataset, knng_k, knng, config);
+    }
 
     algo::BuildParams b_params;
     b_params.candidate_pool_size = config[IndexParams::candidate];
@@ -130,7 +149,6 @@ NSG::Train(const DatasetPtr& dataset, const Config& config) {
 
     auto p_ids = dataset->Get<const int64_t*>(meta::IDS);
 
-    GETTENSOR(dataset)
     index_ = std::make_shared<algo::NsgIndex>(dim, rows);
     index_->SetKnnGraph(knng);
     index_->Build_with_ids(rows, (float*)p_data, (int64_t*)p_ids, b_params);
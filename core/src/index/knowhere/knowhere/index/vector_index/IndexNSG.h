@@ -48,6 +48,12 @@ class NSG : public VectorIndex {
     void
     Seal() override;
 
+ private:
+    // knn graph of the training data from an IVF index, or brute force on gpu
+    void
+    GenKnnGraphByIVF(const DatasetPtr& dataset, int64_t k, std::vector<std::vector<int64_t>>& knng,
+                     const Config& config);
+
  private:
     std::shared_ptr<algo::NsgIndex> index_;
     int64_t gpu_;
@@ -11,11 +11,14 @@
 
 #pragma once
 
+#include <faiss/utils/ConcurrentBitset.h>
+
 #include <memory>
 #include <vector>
 
 #include "knowhere/common/Config.h"
 #include "knowhere/common/Dataset.h"
+#include "knowhere/common/Exception.h"
 #include "knowhere/index/Index.h"
 #include "knowhere/index/preprocessor/Preprocessor.h"
 #include "knowhere/index/vector_index/helpers/IndexParameter.h"
@@ -48,6 +51,18 @@ class VectorIndex : public Index {
         return nullptr;
     }
 
+    // whether RangeSearch is implemented natively, callers emulate it with growing k search otherwise
+    virtual bool
+    SupportRangeSearch() {
+        return false;
+    }
+
+    // results within meta::RADIUS of each query, at most meta::TOPK per query, sorted and padded with -1 like Search
+    virtual DatasetPtr
+    RangeSearch(const DatasetPtr& dataset, const Config& config) {
+        KNOWHERE_THROW_MSG("range search not supported");
+    }
+
     virtual void
     Add(const DatasetPtr& dataset, const Config& config) = 0;
 
@@ -75,6 +90,16 @@ class VectorIndex : public Index {
         uids_.swap(uids);
     }
 
+ protected:
+    // a bitset passed along with the query under meta::BITSET replaces the blacklist for this search only
+    static faiss::ConcurrentBitsetPtr
+    SearchBitset(const DatasetPtr& dataset, const faiss::ConcurrentBitsetPtr& blacklist) {
+        if (dataset->data().find(meta::BITSET) == dataset->data().end()) {
+            return blacklist;
+        }
+        return dataset->Get<faiss::ConcurrentBitsetPtr>(meta::BITSET);
+    }
+
  private:
     std::vector<milvus::segment::doc_id_t> uids_;
 };
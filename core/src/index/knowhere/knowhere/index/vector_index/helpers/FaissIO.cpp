@@ -58,4 +58,15 @@ MemoryIOReader::operator()(void* ptr, size_t size, size_t nitems) {
     return nitems;
 }
 
+const uint8_t*
+MemoryIOReader::borrow(size_t nbytes, std::shared_ptr<void>& owner) {
+    if (owner_ == nullptr || rp + nbytes > total) {
+        return nullptr;
+    }
+    owner = owner_;
+    auto ptr = data_ + rp;
+    rp += nbytes;
+    return ptr;
+}
+
 }  // namespace knowhere
@@ -13,6 +13,8 @@
 
 #include <faiss/impl/io.h>
 
+#include <memory>
+
 namespace knowhere {
 
 struct MemoryIOWriter : public faiss::IOWriter {
@@ -34,10 +36,15 @@ struct MemoryIOReader : public faiss::IOReader {
     uint8_t* data_;
     size_t rp = 0;
     size_t total = 0;
+    // set to the holder of data_ to let the index reference data_ in place instead of copying it
+    std::shared_ptr<uint8_t> owner_;
 
     size_t
     operator()(void* ptr, size_t size, size_t nitems) override;
 
+    const uint8_t*
+    borrow(size_t nbytes, std::shared_ptr<void>& owner) override;
+
     template <typename T>
     size_t
     read(T* ptr, size_t size, size_t nitems = 1) {
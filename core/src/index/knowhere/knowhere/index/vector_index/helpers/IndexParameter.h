@@ -24,6 +24,8 @@ constexpr const char* IDS = "ids";
 constexpr const char* DISTANCE = "distance";
 constexpr const char* TOPK = "k";
 constexpr const char* DEVICEID = "gpu_id";
+constexpr const char* BITSET = "bitset";
+constexpr const char* RADIUS = "radius";
 };  // namespace meta
 
 namespace IndexParams {
@@ -32,12 +34,14 @@ constexpr const char* nprobe = "nprobe";
 constexpr const char* nlist = "nlist";
 constexpr const char* m = "m";          // PQ
 constexpr const char* nbits = "nbits";  // PQ/SQ
+constexpr const char* train_points_per_centroid = "train_points_per_centroid";  // optional, see TrainSampler
 
 // NSG Params
 constexpr const char* knng = "knng";
 constexpr const char* search_length = "search_length";
 constexpr const char* out_degree = "out_degree";
 constexpr const char* candidate = "candidate_pool_size";
+constexpr const char* knng_builder = "knng_builder";  // optional, see KnngBuilder
 
 // HNSW Params
 constexpr const char* efConstruction = "efConstruction";
@@ -45,6 +49,11 @@ constexpr const char* M = "M";
 constexpr const char* ef = "ef";
 }  // namespace IndexParams
 
+namespace KnngBuilder {
+constexpr const char* IVF = "ivf";                // search an IVF index trained on the data, the default
+constexpr const char* NN_DESCENT = "nn_descent";  // NN-descent on cpu
+}  // namespace KnngBuilder
+
 namespace Metric {
 constexpr const char* TYPE = "metric_type";
 constexpr const char* IP = "IP";
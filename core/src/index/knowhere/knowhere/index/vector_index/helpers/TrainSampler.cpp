@@ -0,0 +1,58 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "knowhere/index/vector_index/helpers/TrainSampler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+namespace knowhere {
+
+namespace {
+constexpr uint32_t TRAIN_SAMPLE_SEED = 1234;
+}
+
+int64_t
+TrainSampleRows(int64_t rows, int64_t centroids, int64_t points_per_centroid) {
+    if (points_per_centroid <= 0) {
+        return rows;
+    }
+    points_per_centroid = std::max(points_per_centroid, MIN_TRAIN_POINTS_PER_CENTROID);
+    return std::min(rows, centroids * points_per_centroid);
+}
+
+int64_t
+PQTrainCentroids(int64_t nlist, int64_t nbits) {
+    return std::max(nlist, static_cast<int64_t>(1) << nbits);
+}
+
+const float*
+SampleTrainData(const float* data, int64_t rows, int64_t dim, int64_t sample_rows, std::vector<float>& buffer) {
+    if (sample_rows >= rows) {
+        return data;
+    }
+
+    // selection sampling, each row is taken with probability (still needed) / (still left)
+    std::mt19937_64 rng(TRAIN_SAMPLE_SEED);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    buffer.resize(sample_rows * dim);
+    int64_t taken = 0;
+    for (int64_t i = 0; i < rows && taken < sample_rows; ++i) {
+        if (uniform(rng) * (rows - i) < sample_rows - taken) {
+            memcpy(buffer.data() + taken * dim, data + i * dim, dim * sizeof(float));
+            ++taken;
+        }
+    }
+    return buffer.data();
+}
+
+}  // namespace knowhere
@@ -0,0 +1,37 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace knowhere {
+
+// faiss k-means warns below 39 points per centroid and subsamples above 256 by default
+constexpr int64_t MIN_TRAIN_POINTS_PER_CENTROID = 39;
+constexpr int64_t DEFAULT_TRAIN_POINTS_PER_CENTROID = 256;
+
+// number of rows to train k-means with the given number of centroids on, all rows when points_per_centroid <= 0
+extern int64_t
+TrainSampleRows(int64_t rows, int64_t centroids, int64_t points_per_centroid);
+
+// IVFPQ trains the nlist coarse centroids and 2^nbits centroids per sub-quantizer on the same rows, the sample must
+// be large enough for the larger of the two
+extern int64_t
+PQTrainCentroids(int64_t nlist, int64_t nbits);
+
+// uniform sample of sample_rows rows without replacement, kept in their original order and the same for the same
+// input, returns data itself when sample_rows >= rows, otherwise the sample copied into buffer
+extern const float*
+SampleTrainData(const float* data, int64_t rows, int64_t dim, int64_t sample_rows, std::vector<float>& buffer);
+
+}  // namespace knowhere
@@ -0,0 +1,189 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "knowhere/index/vector_index/nsg/NNDescent.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+
+#include "knowhere/common/Log.h"
+#include "knowhere/common/Timer.h"
+#include "knowhere/index/vector_index/nsg/Distance.h"
+
+namespace knowhere {
+namespace algo {
+
+namespace {
+
+struct Node {
+    std::mutex mutex;
+    std::vector<Neighbor> pool;  // sorted by distance, has_explored is false until joined once
+    std::vector<node_t> new_neighbors;
+    std::vector<node_t> old_neighbors;
+    std::vector<node_t> reverse_new;
+    std::vector<node_t> reverse_old;
+};
+
+// returns true when nn enters the pool
+bool
+UpdatePool(Node& node, size_t pool_size, const Neighbor& nn) {
+    LockGuard lock(node.mutex);
+    auto& pool = node.pool;
+    if (pool.size() >= pool_size && nn.distance >= pool.back().distance) {
+        return false;
+    }
+    for (auto& neighbor : pool) {
+        if (neighbor.id == nn.id) {
+            return false;
+        }
+    }
+    pool.insert(std::upper_bound(pool.begin(), pool.end(), nn), nn);
+    if (pool.size() > pool_size) {
+        pool.pop_back();
+    }
+    return true;
+}
+
+void
+SampleTo(std::vector<node_t>& ids, size_t sample, std::mt19937& rng) {
+    if (ids.size() > sample) {
+        std::shuffle(ids.begin(), ids.end(), rng);
+        ids.resize(sample);
+    }
+}
+
+void
+MergeUnique(std::vector<node_t>& ids, const std::vector<node_t>& other) {
+    ids.insert(ids.end(), other.begin(), other.end());
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+}  // namespace
+
+void
+BuildKnnGraphByNNDescent(const float* data, size_t n, size_t dim, const NNDescentParams& params,
+                         std::vector<std::vector<node_t>>& knng) {
+    TimeRecorder rc("NNDescent");
+    DistanceL2 distance;
+    size_t pool_size = std::min(std::max(params.pool_size, params.k), n > 0 ? n - 1 : 0);
+    std::vector<Node> nodes(n);
+
+    // random initial neighbors
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t i = 0; i < n; ++i) {
+        std::mt19937 rng(i);
+        std::uniform_int_distribution<node_t> dist(0, n - 1);
+        auto& pool = nodes[i].pool;
+        pool.reserve(pool_size + 1);
+        while (pool.size() < pool_size) {
+            node_t id = dist(rng);
+            auto same = [&](const Neighbor& neighbor) { return neighbor.id == id; };
+            if (id == (node_t)i || std::any_of(pool.begin(), pool.end(), same)) {
+                continue;
+            }
+            pool.emplace_back(id, distance.Compare(data + i * dim, data + id * dim, dim));
+        }
+        std::sort(pool.begin(), pool.end());
+    }
+    rc.RecordSection("init");
+
+    for (size_t iter = 0; iter < params.iterations; ++iter) {
+        // sample new and old neighbors, mark sampled new ones as explored
+#pragma omp parallel for schedule(dynamic, 100)
+        for (size_t i = 0; i < n; ++i) {
+            auto& node = nodes[i];
+            node.new_neighbors.clear();
+            node.old_neighbors.clear();
+            for (auto& neighbor : node.pool) {
+                if (!neighbor.has_explored) {
+                    if (node.new_neighbors.size() < params.sample) {
+                        node.new_neighbors.push_back(neighbor.id);
+                        neighbor.has_explored = true;
+                    }
+                } else if (node.old_neighbors.size() < params.sample) {
+                    node.old_neighbors.push_back(neighbor.id);
+                }
+            }
+        }
+
+        // reverse neighbors
+#pragma omp parallel for schedule(dynamic, 100)
+        for (size_t i = 0; i < n; ++i) {
+            for (auto id : nodes[i].new_neighbors) {
+                LockGuard lock(nodes[id].mutex);
+                nodes[id].reverse_new.push_back(i);
+            }
+            for (auto id : nodes[i].old_neighbors) {
+                LockGuard lock(nodes[id].mutex);
+                nodes[id].reverse_old.push_back(i);
+            }
+        }
+
+        // local join
+        std::atomic<size_t> updates(0);
+#pragma omp parallel for schedule(dynamic, 100)
+        for (size_t i = 0; i < n; ++i) {
+            auto& node = nodes[i];
+            std::mt19937 rng(iter * n + i);
+            SampleTo(node.reverse_new, params.sample, rng);
+            SampleTo(node.reverse_old, params.sample, rng);
+            std::vector<node_t> new_ids, old_ids;
+            {
+                LockGuard lock(node.mutex);
+                new_ids.swap(node.reverse_new);
+                old_ids.swap(node.reverse_old);
+            }
+            MergeUnique(new_ids, node.new_neighbors);
+            MergeUnique(old_ids, node.old_neighbors);
+
+            size_t local_updates = 0;
+            auto join = [&](node_t a, node_t b) {
+                float d = distance.Compare(data + a * dim, data + b * dim, dim);
+                local_updates += UpdatePool(nodes[a], pool_size, Neighbor(b, d));
+                local_updates += UpdatePool(nodes[b], pool_size, Neighbor(a, d));
+            };
+            for (size_t x = 0; x < new_ids.size(); ++x) {
+                for (size_t y = x + 1; y < new_ids.size(); ++y) {
+                    join(new_ids[x], new_ids[y]);
+                }
+                for (auto old_id : old_ids) {
+                    if (old_id != new_ids[x]) {
+                        join(new_ids[x], old_id);
+                    }
+                }
+            }
+            updates += local_updates;
+        }
+
+        KNOWHERE_LOG_DEBUG << "NN-descent iteration " << iter << ", " << updates << " updates";
+        if (updates <= params.delta * n * params.k) {
+            break;
+        }
+    }
+    rc.RecordSection("iterate");
+
+    knng.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        auto& pool = nodes[i].pool;
+        auto& neighbors = knng[i];
+        neighbors.clear();
+        for (size_t j = 0; j < pool.size() && j < params.k; ++j) {
+            neighbors.push_back(pool[j].id);
+        }
+    }
+    rc.ElapseFromBegin("total");
+}
+
+}  // namespace algo
+}  // namespace knowhere
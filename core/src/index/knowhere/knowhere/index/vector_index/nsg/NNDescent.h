@@ -0,0 +1,41 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Neighbor.h"
+
+namespace knowhere {
+namespace algo {
+
+struct NNDescentParams {
+    size_t k = 20;           // out degree of the knn graph
+    size_t pool_size = 30;   // candidates kept per node while iterating, at least k
+    size_t sample = 20;      // new/old neighbors sampled per node in each local join
+    size_t iterations = 10;  // upper bound of iterations
+    float delta = 0.002;     // stop when less than delta * n * k pool updates happened in one iteration
+};
+
+/*
+ * Builds an approximate knn graph with NN-descent (Dong et al. 2011) instead of training and searching
+ * an IVF index: neighbors of neighbors are likely neighbors, so every iteration compares the sampled
+ * new neighbors of each node against each other and against its old neighbors, in both directions.
+ * Uses the same L2 distance as NsgIndex. knng[i] holds at most k ids sorted by distance, i excluded.
+ */
+void
+BuildKnnGraphByNNDescent(const float* data, size_t n, size_t dim, const NNDescentParams& params,
+                         std::vector<std::vector<node_t>>& knng);
+
+}  // namespace algo
+}  // namespace knowhere
@@ -148,19 +148,28 @@ void IndexBinaryIVF::make_direct_map(bool new_maintain_direct_map) {
 
 void IndexBinaryIVF::search(idx_t n, const uint8_t *x, idx_t k, int32_t *distances, idx_t *labels,
                             ConcurrentBitsetPtr bitset) const {
+  search_with_parameters(n, x, k, distances, labels, nullptr, bitset);
+}
+
+void IndexBinaryIVF::search_with_parameters(idx_t n, const uint8_t *x, idx_t k, int32_t *distances, idx_t *labels,
+                                            const IVFSearchParameters *params,
+                                            ConcurrentBitsetPtr bitset) const {
+  long nprobe = params ? params->nprobe : this->nprobe;
+  IndexIVFStats & stats = get_ivf_stats(params);
+
   std::unique_ptr<idx_t[]> idx(new idx_t[n * nprobe]);
   std::unique_ptr<int32_t[]> coarse_dis(new int32_t[n * nprobe]);
 
   double t0 = getmillisecs();
   quantizer->search(n, x, nprobe, coarse_dis.get(), idx.get());
-  indexIVF_stats.quantization_time += getmillisecs() - t0;
+  stats.quantization_time += getmillisecs() - t0;
 
   t0 = getmillisecs();
   invlists->prefetch_lists(idx.get(), n * nprobe);
 
   search_preassigned(n, x, k, idx.get(), coarse_dis.get(),
-                     distances, labels, false, nullptr, bitset);
-  indexIVF_stats.search_time += getmillisecs() - t0;
+                     distances, labels, false, params, bitset);
+  stats.search_time += getmillisecs() - t0;
 }
 
 void IndexBinaryIVF::get_vector_by_id(idx_t n, const idx_t *xid, uint8_t *x, ConcurrentBitsetPtr bitset) {
@@ -612,10 +621,11 @@ void search_knn_hamming_heap(const IndexBinaryIVF& ivf,
         } // parallel for
     } // parallel
 
-    indexIVF_stats.nq += n;
-    indexIVF_stats.nlist += nlistv;
-    indexIVF_stats.ndis += ndis;
-    indexIVF_stats.nheap_updates += nheap;
+    IndexIVFStats & stats = get_ivf_stats(params);
+    stats.nq += n;
+    stats.nlist += nlistv;
+    stats.ndis += ndis;
+    stats.nheap_updates += nheap;
 
 }
 
@@ -696,10 +706,11 @@ void search_knn_jaccard_heap(const IndexBinaryIVF& ivf,
         } // parallel for
     } // parallel
 
-    indexIVF_stats.nq += n;
-    indexIVF_stats.nlist += nlistv;
-    indexIVF_stats.ndis += ndis;
-    indexIVF_stats.nheap_updates += nheap;
+    IndexIVFStats & stats = get_ivf_stats(params);
+    stats.nq += n;
+    stats.nlist += nlistv;
+    stats.ndis += ndis;
+    stats.nheap_updates += nheap;
 
 }
 
@@ -791,9 +802,10 @@ void search_knn_hamming_count(const IndexBinaryIVF& ivf,
     }
   }
 
-  indexIVF_stats.nq += nx;
-  indexIVF_stats.nlist += nlistv;
-  indexIVF_stats.ndis += ndis;
+  IndexIVFStats & stats = get_ivf_stats(params);
+  stats.nq += nx;
+  stats.nlist += nlistv;
+  stats.ndis += ndis;
 }
 
 
@@ -868,6 +880,7 @@ void IndexBinaryIVF::search_preassigned(idx_t n, const uint8_t *x, idx_t k,
                                         const IVFSearchParameters *params,
                                         ConcurrentBitsetPtr bitset
                                         ) const {
+    long nprobe = params ? params->nprobe : this->nprobe;
 
     if (metric_type == METRIC_Jaccard || metric_type == METRIC_Tanimoto) {
         if (use_heap) {
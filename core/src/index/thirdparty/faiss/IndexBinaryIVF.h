@@ -119,6 +119,12 @@ struct IndexBinaryIVF : IndexBinary {
     void search(idx_t n, const uint8_t *x, idx_t k, int32_t *distances, idx_t *labels,
                 ConcurrentBitsetPtr bitset = nullptr) const override;
 
+    /** same as search, but with per-call parameters overriding the
+     * object's ones, so concurrent calls don't need to modify the index */
+    void search_with_parameters(idx_t n, const uint8_t *x, idx_t k, int32_t *distances, idx_t *labels,
+                                const IVFSearchParameters *params,
+                                ConcurrentBitsetPtr bitset = nullptr) const;
+
     /** get raw vectors by ids */
     void get_vector_by_id(idx_t n, const idx_t *xid, uint8_t *x, ConcurrentBitsetPtr bitset = nullptr) override;
 
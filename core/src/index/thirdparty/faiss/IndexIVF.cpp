@@ -299,19 +299,29 @@ void IndexIVF::make_direct_map (bool new_maintain_direct_map)
 
 void IndexIVF::search (idx_t n, const float *x, idx_t k, float *distances, idx_t *labels,
                        ConcurrentBitsetPtr bitset) const {
+    search_with_parameters (n, x, k, distances, labels, nullptr, bitset);
+}
+
+void IndexIVF::search_with_parameters (idx_t n, const float *x, idx_t k,
+                                       float *distances, idx_t *labels,
+                                       const IVFSearchParameters *params,
+                                       ConcurrentBitsetPtr bitset) const {
+    long nprobe = params ? params->nprobe : this->nprobe;
+    IndexIVFStats & stats = get_ivf_stats (params);
+
     std::unique_ptr<idx_t[]> idx(new idx_t[n * nprobe]);
     std::unique_ptr<float[]> coarse_dis(new float[n * nprobe]);
 
     double t0 = getmillisecs();
     quantizer->search (n, x, nprobe, coarse_dis.get(), idx.get());
-    indexIVF_stats.quantization_time += getmillisecs() - t0;
+    stats.quantization_time += getmillisecs() - t0;
 
     t0 = getmillisecs();
     invlists->prefetch_lists (idx.get(), n * nprobe);
 
     search_preassigned (n, x, k, idx.get(), coarse_dis.get(),
-                        distances, labels, false, nullptr,bitset);
-    indexIVF_stats.search_time += getmillisecs() - t0;
+                        distances, labels, false, params, bitset);
+    stats.search_time += getmillisecs() - t0;
 }
 
 void IndexIVF::get_vector_by_id (idx_t n, const idx_t *xid, float *x, ConcurrentBitsetPtr bitset) {
@@ -532,10 +542,11 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
         FAISS_THROW_MSG ("computation interrupted");
     }
 
-    indexIVF_stats.nq += n;
-    indexIVF_stats.nlist += nlistv;
-    indexIVF_stats.ndis += ndis;
-    indexIVF_stats.nheap_updates += nheap;
+    IndexIVFStats & stats = get_ivf_stats (params);
+    stats.nq += n;
+    stats.nlist += nlistv;
+    stats.ndis += ndis;
+    stats.nheap_updates += nheap;
 
 }
 
@@ -545,6 +556,14 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 void IndexIVF::range_search (idx_t nx, const float *x, float radius,
                              RangeSearchResult *result) const
 {
+    range_search_with_parameters (nx, x, radius, result, nullptr);
+}
+
+void IndexIVF::range_search_with_parameters (idx_t nx, const float *x, float radius,
+                                             RangeSearchResult *result,
+                                             const IVFSearchParameters *params) const
+{
+    long nprobe = params ? params->nprobe : this->nprobe;
     std::unique_ptr<idx_t[]> keys (new idx_t[nx * nprobe]);
     std::unique_ptr<float []> coarse_dis (new float[nx * nprobe]);
 
@@ -556,7 +575,7 @@ void IndexIVF::range_search (idx_t nx, const float *x, float radius,
     invlists->prefetch_lists (keys.get(), nx * nprobe);
 
     range_search_preassigned (nx, x, radius, keys.get (), coarse_dis.get (),
-                              result);
+                              result, params);
 
     indexIVF_stats.search_time += getmillisecs() - t0;
 }
@@ -564,8 +583,10 @@ void IndexIVF::range_search (idx_t nx, const float *x, float radius,
 void IndexIVF::range_search_preassigned (
          idx_t nx, const float *x, float radius,
          const idx_t *keys, const float *coarse_dis,
-         RangeSearchResult *result) const
+         RangeSearchResult *result,
+         const IVFSearchParameters *params) const
 {
+    long nprobe = params ? params->nprobe : this->nprobe;
 
     size_t nlistv = 0, ndis = 0;
     bool store_pairs = false;
@@ -65,9 +65,13 @@ struct Level1Quantizer {
 
 
 
+struct IndexIVFStats;
+
 struct IVFSearchParameters {
     size_t nprobe;            ///< number of probes at query time
     size_t max_codes;         ///< max nb of codes to visit to do a query
+    IndexIVFStats *stats;     ///< if set, stats of the call go here instead of indexIVF_stats
+    IVFSearchParameters (): nprobe(1), max_codes(0), stats(nullptr) {}
     virtual ~IVFSearchParameters () {}
 };
 
@@ -186,6 +190,16 @@ struct IndexIVF: Index, Level1Quantizer {
     void search (idx_t n, const float *x, idx_t k, float *distances, idx_t *labels,
                  ConcurrentBitsetPtr bitset = nullptr) const override;
 
+    /** same as search, but with per-call parameters overriding the
+     * object's ones, so concurrent calls don't need to modify the index
+     *
+     * @param params   may be nullptr, then the object's parameters are used
+     */
+    void search_with_parameters (idx_t n, const float *x, idx_t k,
+                                 float *distances, idx_t *labels,
+                                 const IVFSearchParameters *params,
+                                 ConcurrentBitsetPtr bitset = nullptr) const;
+
     /** get raw vectors by ids */
     void get_vector_by_id (idx_t n, const idx_t *xid, float *x, ConcurrentBitsetPtr bitset = nullptr) override;
 
@@ -195,9 +209,17 @@ struct IndexIVF: Index, Level1Quantizer {
     void range_search (idx_t n, const float* x, float radius,
                        RangeSearchResult* result) const override;
 
+    /** same as range_search, but with per-call parameters, see
+     * search_with_parameters
+     */
+    void range_search_with_parameters (idx_t n, const float* x, float radius,
+                                       RangeSearchResult* result,
+                                       const IVFSearchParameters *params) const;
+
     void range_search_preassigned(idx_t nx, const float *x, float radius,
                                   const idx_t *keys, const float *coarse_dis,
-                                  RangeSearchResult *result) const;
+                                  RangeSearchResult *result,
+                                  const IVFSearchParameters *params = nullptr) const;
 
     /// get a scanner for this index (store_pairs means ignore labels)
     virtual InvertedListScanner *get_InvertedListScanner (
@@ -364,6 +386,11 @@ struct IndexIVFStats {
 // global var that collects them all
 extern IndexIVFStats indexIVF_stats;
 
+// stats to update by a search call with these parameters
+inline IndexIVFStats & get_ivf_stats (const IVFSearchParameters *params) {
+    return params && params->stats ? *params->stats : indexIVF_stats;
+}
+
 
 } // namespace faiss
 
@@ -364,6 +364,9 @@ size_t ReadOnlyArrayInvertedLists::list_size(size_t list_no) const
 const uint8_t * ReadOnlyArrayInvertedLists::get_codes (size_t list_no) const
 {
     FAISS_ASSERT(list_no < nlist && valid);
+    if (mapped_codes) {
+        return mapped_codes + readonly_offset[list_no] * code_size;
+    }
 #ifdef USE_CPU
     return readonly_codes.data() + readonly_offset[list_no] * code_size;
 #else
@@ -375,6 +378,9 @@ const uint8_t * ReadOnlyArrayInvertedLists::get_codes (size_t list_no) const
 const InvertedLists::idx_t* ReadOnlyArrayInvertedLists::get_ids (size_t list_no) const
 {
     FAISS_ASSERT(list_no < nlist && valid);
+    if (mapped_ids) {
+        return mapped_ids + readonly_offset[list_no];
+    }
 #ifdef USE_CPU
     return readonly_ids.data() + readonly_offset[list_no];
 #else
@@ -385,6 +391,9 @@ const InvertedLists::idx_t* ReadOnlyArrayInvertedLists::get_ids (size_t list_no)
 
 const InvertedLists::idx_t* ReadOnlyArrayInvertedLists::get_all_ids() const {
     FAISS_ASSERT(valid);
+    if (mapped_ids) {
+        return mapped_ids;
+    }
 #ifdef USE_CPU
     return readonly_ids.data();
 #else
@@ -394,6 +403,9 @@ const InvertedLists::idx_t* ReadOnlyArrayInvertedLists::get_all_ids() const {
 
 const uint8_t* ReadOnlyArrayInvertedLists::get_all_codes() const {
     FAISS_ASSERT(valid);
+    if (mapped_codes) {
+        return mapped_codes;
+    }
 #ifdef USE_CPU
     return readonly_codes.data();
 #else
@@ -247,6 +247,13 @@ struct ReadOnlyArrayInvertedLists: InvertedLists {
     std::vector <size_t> readonly_offset;
     bool valid;
 
+    // codes and ids referenced in place from the memory the lists were
+    // read from (eg. a mapped index file), kept alive by mapped_owner.
+    // When set they take precedence over the copies above
+    std::shared_ptr<void> mapped_owner;
+    const uint8_t *mapped_codes = nullptr;
+    const idx_t *mapped_ids = nullptr;
+
     ReadOnlyArrayInvertedLists(size_t nlist, size_t code_size, const std::vector<size_t>& list_length);
     explicit ReadOnlyArrayInvertedLists(const ArrayInvertedLists& other);
 
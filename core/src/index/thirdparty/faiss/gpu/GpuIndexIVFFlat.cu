@@ -92,8 +92,8 @@ GpuIndexIVFFlat::copyFrom(const faiss::IndexIVFFlat* index) {
   InvertedLists *ivf = index->invlists;
 
     if (ReadOnlyArrayInvertedLists* rol = dynamic_cast<ReadOnlyArrayInvertedLists*>(ivf)) {
-        index_->copyCodeVectorsFromCpu((const float* )(rol->pin_readonly_codes->data),
-                                       (const long *)(rol->pin_readonly_ids->data), rol->readonly_length);
+        index_->copyCodeVectorsFromCpu((const float* )(rol->get_all_codes()),
+                                       (const long *)(rol->get_all_ids()), rol->readonly_length);
         /* double t0 = getmillisecs(); */
         /* std::cout << "Readonly Takes " << getmillisecs() - t0 << " ms" << std::endl; */
     } else {
@@ -109,8 +109,8 @@ GpuIndexIVFSQHybrid::copyFrom(
 
     InvertedLists* ivf = index->invlists;
     if(ReadOnlyArrayInvertedLists* rol = dynamic_cast<ReadOnlyArrayInvertedLists*>(ivf)) {
-        index_->copyCodeVectorsFromCpu((const float* )(rol->pin_readonly_codes->data),
-                                       (const long *)(rol->pin_readonly_ids->data), rol->readonly_length);
+        index_->copyCodeVectorsFromCpu((const float* )(rol->get_all_codes()),
+                                       (const long *)(rol->get_all_ids()), rol->readonly_length);
     } else {
         for (size_t i = 0; i < ivf->nlist; ++i) {
             auto numVecs = ivf->list_size(i);
@@ -172,8 +172,8 @@ GpuIndexIVFSQHybrid::copyFrom(
 
   InvertedLists* ivf = index->invlists;
   if(ReadOnlyArrayInvertedLists* rol = dynamic_cast<ReadOnlyArrayInvertedLists*>(ivf)) {
-      index_->copyCodeVectorsFromCpu((const float* )(rol->pin_readonly_codes->data),
-                                     (const long *)(rol->pin_readonly_ids->data), rol->readonly_length);
+      index_->copyCodeVectorsFromCpu((const float* )(rol->get_all_codes()),
+                                     (const long *)(rol->get_all_ids()), rol->readonly_length);
   } else {
       for (size_t i = 0; i < ivf->nlist; ++i) {
           auto numVecs = ivf->list_size(i);
@@ -11,6 +11,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <sys/mman.h>
 #include <sys/types.h>
@@ -211,6 +212,28 @@ InvertedLists *read_InvertedLists (IOReader *f, int io_flags) {
         auto ails = new ReadOnlyArrayInvertedLists(nlist, code_size, list_length);
         size_t n;
         READ1(n);
+        // reference ids and codes in place if the reader can lend its memory,
+        // ids are copied when misaligned
+        std::shared_ptr<void> owner;
+        auto ids = f->borrow(n * sizeof(InvertedLists::idx_t), owner);
+        if (ids != nullptr) {
+            auto codes = f->borrow(n * code_size, owner);
+            FAISS_THROW_IF_NOT_MSG(codes, "read_InvertedLists: could not borrow codes");
+            ails->mapped_owner = owner;
+            ails->mapped_codes = codes;
+            if (reinterpret_cast<uintptr_t>(ids) % alignof(InvertedLists::idx_t) == 0) {
+                ails->mapped_ids = (const InvertedLists::idx_t *) ids;
+                return ails;
+            }
+#ifdef USE_CPU
+            ails->readonly_ids.resize(n);
+            memcpy(ails->readonly_ids.data(), ids, n * sizeof(InvertedLists::idx_t));
+#else
+            ails->pin_readonly_ids = std::make_shared<PageLockMemory>(n * sizeof(InvertedLists::idx_t));
+            memcpy(ails->pin_readonly_ids->data, ids, n * sizeof(InvertedLists::idx_t));
+#endif
+            return ails;
+        }
 #ifdef USE_CPU
         ails->readonly_ids.resize(n);
         ails->readonly_codes.resize(n*code_size);
@@ -27,6 +27,11 @@ int IOReader::fileno ()
     FAISS_THROW_MSG ("IOReader does not support memory mapping");
 }
 
+const uint8_t *IOReader::borrow (size_t, std::shared_ptr<void> &)
+{
+    return nullptr;
+}
+
 int IOWriter::fileno ()
 {
     FAISS_THROW_MSG ("IOWriter does not support memory mapping");
@@ -15,6 +15,7 @@
 
 #include <string>
 #include <cstdio>
+#include <memory>
 #include <vector>
 
 #include <faiss/Index.h>
@@ -33,6 +34,11 @@ struct IOReader {
     // return a file number that can be memory-mapped
     virtual int fileno ();
 
+    // reference the next nbytes in place instead of copying them, owner
+    // keeps the memory alive. Returns nullptr if the reader cannot lend
+    // its memory, the read position is unchanged then
+    virtual const uint8_t *borrow (size_t nbytes, std::shared_ptr<void> &owner);
+
     virtual ~IOReader() {}
 };
 
@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <unordered_set>
 #include <list>
+#include <memory>
 
 #include "knowhere/index/vector_index/helpers/FaissIO.h"
 
@@ -87,10 +88,12 @@ namespace hnswlib {
 
         ~HierarchicalNSW() {
 
-            free(data_level0_memory_);
-            for (tableint i = 0; i < cur_element_count; i++) {
-                if (element_levels_[i] > 0)
-                    free(linkLists_[i]);
+            if (memory_owner_ == nullptr) {
+                free(data_level0_memory_);
+                for (tableint i = 0; i < cur_element_count; i++) {
+                    if (element_levels_[i] > 0)
+                        free(linkLists_[i]);
+                }
             }
             free(linkLists_);
             delete visited_list_pool_;
@@ -130,6 +133,8 @@ namespace hnswlib {
 
         char *data_level0_memory_;
         char **linkLists_;
+        // holder of level0 and link lists when they reference the loaded binary instead of owned memory
+        std::shared_ptr<void> memory_owner_;
         std::vector<int> element_levels_;
 
         size_t data_size_;
@@ -687,10 +692,17 @@ namespace hnswlib {
 //            input.seekg(pos,input.beg);
 
 
-            data_level0_memory_ = (char *) malloc(max_elements * size_data_per_element_);
-            if (data_level0_memory_ == nullptr)
-                throw std::runtime_error("Not enough memory: loadIndex failed to allocate level0");
-            input.read(data_level0_memory_, cur_element_count * size_data_per_element_);
+            // a loaded index that can't grow references level0 and link lists in place when the reader lends its memory
+            data_level0_memory_ = nullptr;
+            if (max_elements == cur_element_count) {
+                data_level0_memory_ = (char *) input.borrow(cur_element_count * size_data_per_element_, memory_owner_);
+            }
+            if (data_level0_memory_ == nullptr) {
+                data_level0_memory_ = (char *) malloc(max_elements * size_data_per_element_);
+                if (data_level0_memory_ == nullptr)
+                    throw std::runtime_error("Not enough memory: loadIndex failed to allocate level0");
+                input.read(data_level0_memory_, cur_element_count * size_data_per_element_);
+            }
 
 
 
@@ -721,6 +733,12 @@ namespace hnswlib {
                     linkLists_[i] = nullptr;
                 } else {
                     element_levels_[i] = linkListSize / size_links_per_element_;
+                    if (memory_owner_ != nullptr) {
+                        linkLists_[i] = (char *) input.borrow(linkListSize, memory_owner_);
+                        if (linkLists_[i] == nullptr)
+                            throw std::runtime_error("loadIndex failed to borrow linklist");
+                        continue;
+                    }
                     linkLists_[i] = (char *) malloc(linkListSize);
                     if (linkLists_[i] == nullptr)
                         throw std::runtime_error("Not enough memory: loadIndex failed to allocate linklist");
@@ -1084,6 +1102,12 @@ namespace hnswlib {
 
         std::priority_queue<std::pair<dist_t, labeltype >>
         searchKnn(const void *query_data, size_t k) const {
+            return searchKnnWithEf(query_data, k, ef_);
+        };
+
+        // ef is given by the caller instead of ef_, so concurrent searches don't need setEf
+        std::priority_queue<std::pair<dist_t, labeltype >>
+        searchKnnWithEf(const void *query_data, size_t k, size_t ef) const {
             std::priority_queue<std::pair<dist_t, labeltype >> result;
             if (cur_element_count == 0) return result;
 
@@ -1117,12 +1141,12 @@ namespace hnswlib {
             std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> top_candidates;
             if (has_deletions_) {
                 std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> top_candidates1=searchBaseLayerST<true>(
-                        currObj, query_data, std::max(ef_, k));
+                        currObj, query_data, std::max(ef, k));
                 top_candidates.swap(top_candidates1);
             }
             else{
                 std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> top_candidates1=searchBaseLayerST<false>(
-                        currObj, query_data, std::max(ef_, k));
+                        currObj, query_data, std::max(ef, k));
                 top_candidates.swap(top_candidates1);
             }
             while (top_candidates.size() > k) {
@@ -1154,6 +1178,24 @@ namespace hnswlib {
             return result;
         }
 
+        template <typename Comp>
+        std::vector<std::pair<dist_t, labeltype>>
+        searchKnnWithEf(const void* query_data, size_t k, size_t ef, Comp comp) const {
+            std::vector<std::pair<dist_t, labeltype>> result;
+            if (cur_element_count == 0) return result;
+
+            auto ret = searchKnnWithEf(query_data, k, ef);
+
+            while (!ret.empty()) {
+                result.push_back(ret.top());
+                ret.pop();
+            }
+
+            std::sort(result.begin(), result.end(), comp);
+
+            return result;
+        }
+
     };
 
 }
@@ -51,6 +51,8 @@
 #include <faiss/gpu/GpuIndexIVF.h>
 #endif
 
+#include "knowhere/index/vector_index/helpers/TrainSampler.h"
+
 /*****************************************************
  * To run this test, please download the HDF5 from
  *  https://support.hdfgroup.org/ftp/HDF5/releases/
@@ -541,6 +543,74 @@ test_ann_hdf5(const std::string& ann_test_name, const std::string& cluster_type,
     delete[] gt;
 }
 
+void
+test_build_hdf5(const std::string& ann_test_name, const std::string& index_key, size_t nprobe,
+                const std::vector<int64_t>& points_per_centroids) {
+    double t0 = elapsed();
+
+    const size_t NQ = 1000;
+    const size_t K = 10;
+    const size_t GK = 100;  // topk of ground truth
+
+    faiss::MetricType metric_type;
+    size_t dim;
+    if (!parse_ann_test_name(ann_test_name, dim, metric_type)) {
+        printf("Invalid ann test name: %s\n", ann_test_name.c_str());
+        return;
+    }
+
+    size_t nb, d;
+    const std::string ann_file_name = ann_test_name + HDF5_POSTFIX;
+    printf("[%.3f s] Loading HDF5 file: %s\n", elapsed() - t0, ann_file_name.c_str());
+    float* xb = (float*)hdf5_read(ann_file_name, HDF5_DATASET_TRAIN, H5T_FLOAT, d, nb);
+    assert(d == dim || !"dataset does not have correct dimension");
+    if (metric_type == faiss::METRIC_INNER_PRODUCT) {
+        normalize(xb, nb, d);
+    }
+
+    size_t nq, k;
+    faiss::Index::distance_t* xq;
+    faiss::Index::idx_t* gt;
+    load_query_data(xq, nq, ann_test_name, metric_type, dim);
+    load_ground_truth(gt, k, ann_test_name, nq);
+    nq = std::min(nq, NQ);
+
+    std::vector<faiss::Index::idx_t> I(nq * K);
+    std::vector<faiss::Index::distance_t> D(nq * K);
+
+    printf("\n%s | %s | nprobe=%lu\n", ann_test_name.c_str(), index_key.c_str(), nprobe);
+    printf("======================================================================================\n");
+    for (auto points_per_centroid : points_per_centroids) {
+        faiss::Index* index = faiss::index_factory(d, index_key.c_str(), metric_type);
+        auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index);
+        assert(ivf_index != nullptr || !"build benchmark needs an IVF index");
+
+        double t_start = elapsed();
+        std::vector<float> buffer;
+        int64_t train_rows = knowhere::TrainSampleRows(nb, ivf_index->nlist, points_per_centroid);
+        const float* train_data = knowhere::SampleTrainData(xb, nb, d, train_rows, buffer);
+        index->train(train_rows, train_data);
+        double t_train = elapsed() - t_start;
+
+        t_start = elapsed();
+        index->add(nb, xb);
+        double t_add = elapsed() - t_start;
+
+        ivf_index->nprobe = nprobe;
+        index->search(nq, xq, K, D.data(), I.data());
+        int32_t hit = GetResultHitCount(gt, I.data(), GK, K, nq, 1);
+
+        printf("points/centroid = %4ld, train rows = %8ld, train = %.3fs, add = %.3fs, R@%lu = %.4f\n",
+               points_per_centroid, train_rows, t_train, t_add, K, hit / float(nq * K));
+        delete index;
+    }
+    printf("======================================================================================\n");
+
+    delete[] xb;
+    delete[] xq;
+    delete[] gt;
+}
+
 /************************************************************************************
  * https://github.com/erikbern/ann-benchmarks
  *
@@ -598,3 +668,16 @@ TEST(FAISSTEST, BENCHMARK) {
                   SEARCH_LOOPS);
 #endif
 }
+
+TEST(FAISSTEST, BUILD_BENCHMARK) {
+    // 0 trains on the whole data set, the others on a uniform sample of nlist * points_per_centroid rows
+    std::vector<int64_t> points_per_centroids = {0, 256, 39};
+    const size_t NPROBE = 32;
+
+    test_build_hdf5("sift-128-euclidean", "IVF4096,Flat", NPROBE, points_per_centroids);
+    test_build_hdf5("sift-128-euclidean", "IVF4096,SQ8", NPROBE, points_per_centroids);
+    test_build_hdf5("sift-128-euclidean", "IVF4096,PQ32", NPROBE, points_per_centroids);
+
+    test_build_hdf5("glove-200-angular", "IVF4096,Flat", NPROBE, points_per_centroids);
+    test_build_hdf5("glove-200-angular", "IVF4096,SQ8", NPROBE, points_per_centroids);
+}
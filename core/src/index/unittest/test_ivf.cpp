@@ -13,6 +13,7 @@
 
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <atomic>
 #include <iostream>
 #include <thread>
 
@@ -29,6 +30,7 @@
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
 #include "knowhere/index/vector_index/IndexIVFSQ.h"
+#include "knowhere/index/vector_index/helpers/TrainSampler.h"
 
 #ifdef MILVUS_GPU_VERSION
 
@@ -149,6 +151,95 @@ TEST_P(IVFTest, ivf_basic) {
 #endif
 }
 
+TEST_P(IVFTest, ivf_train_sample) {
+    assert(!xb.empty());
+
+    int64_t nlist = conf[knowhere::IndexParams::nlist];
+    ASSERT_EQ(knowhere::TrainSampleRows(nb, nlist, 0), nb);
+    ASSERT_EQ(knowhere::TrainSampleRows(nb, nlist, 1), nlist * knowhere::MIN_TRAIN_POINTS_PER_CENTROID);
+    ASSERT_EQ(knowhere::TrainSampleRows(nb, nlist, nb), nb);
+
+    std::vector<float> buffer1, buffer2;
+    auto sample_rows = knowhere::TrainSampleRows(nb, nlist, knowhere::MIN_TRAIN_POINTS_PER_CENTROID);
+    ASSERT_EQ(knowhere::SampleTrainData(xb.data(), nb, dim, nb, buffer1), xb.data());
+    knowhere::SampleTrainData(xb.data(), nb, dim, sample_rows, buffer1);
+    knowhere::SampleTrainData(xb.data(), nb, dim, sample_rows, buffer2);
+    ASSERT_EQ(buffer1.size(), sample_rows * dim);
+    ASSERT_EQ(buffer1, buffer2);
+
+    // trained on 39 points per centroid, the index still finds every query in the base data
+    conf[knowhere::IndexParams::train_points_per_centroid] = knowhere::MIN_TRAIN_POINTS_PER_CENTROID;
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+    EXPECT_EQ(index_->Count(), nb);
+
+    auto result = index_->Search(query_dataset, conf);
+    AssertAnns(result, nq, conf[knowhere::meta::TOPK]);
+
+    if (parameter_type_ != ParameterType::ivfpq) {
+        return;
+    }
+
+    // with a small nlist the sample is sized for the 2^nbits centroids of the PQ sub-quantizers, 4 * 39 rows would
+    // be too few to train them
+    int64_t small_nlist = 4;
+    int64_t nbits = conf[knowhere::IndexParams::nbits];
+    auto pq_centroids = knowhere::PQTrainCentroids(small_nlist, nbits);
+    ASSERT_EQ(pq_centroids, 1 << nbits);
+    ASSERT_EQ(knowhere::PQTrainCentroids(nlist, 1), nlist);
+    ASSERT_GE(knowhere::TrainSampleRows(nb, pq_centroids, knowhere::MIN_TRAIN_POINTS_PER_CENTROID), 1 << nbits);
+
+    conf[knowhere::IndexParams::nlist] = small_nlist;
+    conf[knowhere::IndexParams::nprobe] = small_nlist;
+    auto pq_index = IndexFactory(index_type);
+    auto pq_model = pq_index->Train(base_dataset, conf);
+    pq_index->set_index_model(pq_model);
+    pq_index->Add(base_dataset, conf);
+    EXPECT_EQ(pq_index->Count(), nb);
+
+    auto pq_result = pq_index->Search(query_dataset, conf);
+    AssertAnns(pq_result, nq, conf[knowhere::meta::TOPK]);
+}
+
+TEST_P(IVFTest, ivf_concurrent_search_params) {
+    if (index_type.find("GPU") != std::string::npos || index_type.find("Hybrid") != std::string::npos) {
+        return;
+    }
+
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+
+    // searches with different nprobe on one index must not affect each other
+    std::vector<knowhere::Config> confs{conf, conf};
+    confs[0][knowhere::IndexParams::nprobe] = 1;
+    confs[1][knowhere::IndexParams::nprobe] = conf[knowhere::IndexParams::nlist];
+
+    std::vector<std::vector<int64_t>> expects;
+    for (auto& search_conf : confs) {
+        auto result = index_->Search(query_dataset, search_conf);
+        auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
+        expects.emplace_back(ids, ids + nq * k);
+    }
+
+    std::vector<std::thread> threads;
+    std::atomic<int> mismatch(0);
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&, i]() {
+            auto result = index_->Search(query_dataset, confs[i % 2]);
+            auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
+            if (std::vector<int64_t>(ids, ids + nq * k) != expects[i % 2]) {
+                ++mismatch;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(mismatch, 0);
+}
+
 TEST_P(IVFTest, ivf_serialize) {
     fiu_init(0);
     auto serialize = [](const std::string& filename, knowhere::BinaryPtr& bin, uint8_t* ret) {
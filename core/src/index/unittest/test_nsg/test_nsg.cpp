@@ -10,10 +10,14 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/FaissBaseIndex.h"
+#include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexNSG.h"
 #ifdef MILVUS_GPU_VERSION
 #include "knowhere/index/vector_index/IndexGPUIDMAP.h"
@@ -22,6 +26,7 @@
 #endif
 
 #include "knowhere/common/Timer.h"
+#include "knowhere/index/vector_index/nsg/NNDescent.h"
 #include "knowhere/index/vector_index/nsg/NSGIO.h"
 
 #include <fiu-control.h>
@@ -116,6 +121,77 @@ TEST_F(NSGInterfaceTest, basic_test) {
     });
 }
 
+TEST_F(NSGInterfaceTest, knng_builder_test) {
+    train_conf[knowhere::meta::DEVICEID] = -1;
+
+    knowhere::TimeRecorder tc("KnngBuilder");
+    auto ivf_index = std::make_shared<knowhere::NSG>();
+    ivf_index->Train(base_dataset, train_conf);
+    double ivf_span = tc.RecordSection("build with ivf knng");
+
+    train_conf[knowhere::IndexParams::knng_builder] = knowhere::KnngBuilder::NN_DESCENT;
+    auto nnd_index = std::make_shared<knowhere::NSG>();
+    nnd_index->Train(base_dataset, train_conf);
+    double nnd_span = tc.RecordSection("build with nn-descent knng");
+    printf("nsg build time: ivf knng %.1f ms, nn-descent knng %.1f ms\n", ivf_span / 1000, nnd_span / 1000);
+
+    auto ivf_result = ivf_index->Search(query_dataset, search_conf);
+    AssertAnns(ivf_result, nq, k);
+    auto nnd_result = nnd_index->Search(query_dataset, search_conf);
+    AssertAnns(nnd_result, nq, k);
+    ASSERT_EQ(nnd_index->Count(), nb);
+}
+
+TEST_F(NSGInterfaceTest, knng_recall_test) {
+    // the same graphs as NSG::Train builds with each builder
+    const int64_t knng_k = train_conf[knowhere::IndexParams::knng].get<int64_t>();
+    knowhere::TimeRecorder tc("KnngRecall");
+    knowhere::algo::NNDescentParams params;
+    params.k = knng_k;
+    params.pool_size = knng_k + knng_k / 2;
+    params.sample = std::min<int64_t>(knng_k, 32);
+    knowhere::algo::Graph nnd_knng;
+    knowhere::algo::BuildKnnGraphByNNDescent(xb.data(), nb, dim, params, nnd_knng);
+    double nnd_span = tc.RecordSection("build nn-descent knng");
+    ASSERT_EQ(nnd_knng.size(), nb);
+
+    auto ivf_index = std::make_shared<knowhere::IVF>();
+    auto model = ivf_index->Train(base_dataset, train_conf);
+    ivf_index->set_index_model(model);
+    ivf_index->AddWithoutIds(base_dataset, train_conf);
+    knowhere::Graph ivf_knng;
+    ivf_index->GenGraph(xb.data(), knng_k, ivf_knng, train_conf);
+    double ivf_span = tc.RecordSection("build ivf knng");
+    ASSERT_EQ(ivf_knng.size(), nb);
+
+    // exact neighbors of a few nodes by brute force
+    knowhere::algo::DistanceL2 distanceL2;
+    const int64_t check_num = 100;
+    int64_t nnd_hit = 0, ivf_hit = 0;
+    for (int64_t i = 0; i < check_num; ++i) {
+        ASSERT_EQ(nnd_knng[i].size(), knng_k);
+        std::vector<std::pair<float, int64_t>> exact;
+        for (int64_t j = 0; j < nb; ++j) {
+            if (j != i) {
+                exact.emplace_back(distanceL2.Compare(xb.data() + i * dim, xb.data() + j * dim, dim), j);
+            }
+        }
+        std::partial_sort(exact.begin(), exact.begin() + knng_k, exact.end());
+        for (int64_t m = 0; m < knng_k; ++m) {
+            nnd_hit += std::count(nnd_knng[i].begin(), nnd_knng[i].end(), exact[m].second);
+            ivf_hit += std::count(ivf_knng[i].begin(), ivf_knng[i].end(), exact[m].second);
+        }
+    }
+    float nnd_recall = (float)nnd_hit / (check_num * knng_k);
+    float ivf_recall = (float)ivf_hit / (check_num * knng_k);
+    printf("knng recall: nn-descent %.3f in %.1f ms, ivf %.3f in %.1f ms\n", nnd_recall, nnd_span / 1000, ivf_recall,
+           ivf_span / 1000);
+
+    // on these uniform random vectors nn-descent reaches about 0.7, ivf with nprobe 8 of 163 lists about 0.2
+    ASSERT_GT(nnd_recall, 0.6);
+    ASSERT_GE(nnd_recall, ivf_recall - 0.05);
+}
+
 TEST_F(NSGInterfaceTest, comparetest) {
     knowhere::algo::DistanceL2 distanceL2;
     knowhere::algo::DistanceIP distanceIP;
@@ -55,10 +55,22 @@ class MetricsBase {
     BuildIndexDurationSecondsHistogramObserve(double value) {
     }
 
+    virtual void
+    BuildIndexQueueDepthGaugeSet(double value) {
+    }
+
+    virtual void
+    BuildIndexRowsTotalIncrement(double value = 1) {
+    }
+
     virtual void
     CpuCacheUsageGaugeSet(double value) {
     }
 
+    virtual void
+    CpuCacheNodeUsageGaugeSet(uint64_t node, double value) {
+    }
+
     virtual void
     GpuCacheUsageGaugeSet() {
     }
@@ -119,6 +131,10 @@ class MetricsBase {
     QueryResponseSummaryObserve(double value) {
     }
 
+    virtual void
+    RequestRejectedIncrement(const std::string& group, const std::string& reason) {
+    }
+
     virtual void
     DiskStoreIOSpeedGaugeSet(double value) {
     }
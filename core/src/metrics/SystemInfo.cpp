@@ -18,7 +18,11 @@
 #include <sys/sysinfo.h>
 #include <sys/times.h>
 #include <unistd.h>
+#include <algorithm>
+#include <fstream>
 #include <map>
+#include <numeric>
+#include <sstream>
 
 #ifdef MILVUS_GPU_VERSION
 
@@ -355,6 +359,65 @@ SystemInfo::Octets() {
     return res;
 }
 
+std::vector<int64_t>
+SystemInfo::ParseCpuList(const std::string& list) {
+    std::vector<int64_t> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || !isdigit(range[0])) {
+            continue;
+        }
+        auto dash = range.find('-');
+        if (dash != std::string::npos && (dash + 1 == range.size() || !isdigit(range[dash + 1]))) {
+            continue;
+        }
+        int64_t first = std::stoll(range.substr(0, dash));
+        int64_t last = dash == std::string::npos ? first : std::stoll(range.substr(dash + 1));
+        for (int64_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+const std::vector<std::vector<int64_t>>&
+SystemInfo::NumaTopology() {
+    std::call_once(numa_flag_, [this] {
+        const std::string node_root = "/sys/devices/system/node/";
+        std::map<int64_t, std::vector<int64_t>> nodes;
+        DIR* dir = opendir(node_root.c_str());
+        if (dir != nullptr) {
+            struct dirent* entry;
+            while ((entry = readdir(dir)) != nullptr) {
+                std::string name = entry->d_name;
+                if (name.compare(0, 4, "node") != 0 || name.size() == 4 || !isdigit(name[4])) {
+                    continue;
+                }
+                std::ifstream cpulist(node_root + name + "/cpulist");
+                std::string list;
+                std::getline(cpulist, list);
+                auto cpus = ParseCpuList(list);
+                if (!cpus.empty()) {
+                    nodes[std::stoll(name.substr(4))] = cpus;
+                }
+            }
+            closedir(dir);
+        }
+
+        for (auto& node : nodes) {
+            numa_nodes_.push_back(node.second);
+        }
+        if (numa_nodes_.empty()) {
+            std::vector<int64_t> cpus(std::max<int64_t>(1, sysconf(_SC_NPROCESSORS_CONF)));
+            std::iota(cpus.begin(), cpus.end(), 0);
+            numa_nodes_.push_back(cpus);
+        }
+        SERVER_LOG_INFO << "Found " << numa_nodes_.size() << " numa node(s)";
+    });
+    return numa_nodes_;
+}
+
 void
 SystemInfo::GetSysInfoJsonStr(std::string& result) {
     std::map<std::string, std::string> sys_info_map;
@@ -371,6 +434,12 @@ SystemInfo::GetSysInfoJsonStr(std::string& result) {
         sys_info_map[key_used] = std::to_string(gpu_mem_used[i]);
     }
 
+    auto& numa_nodes = NumaTopology();
+    sys_info_map["numa_nodes"] = std::to_string(numa_nodes.size());
+    for (size_t i = 0; i < numa_nodes.size(); i++) {
+        sys_info_map["numa" + std::to_string(i) + "_cpus"] = std::to_string(numa_nodes[i].size());
+    }
+
     nlohmann::json sys_info_json(sys_info_map);
     result = sys_info_json.dump();
 }
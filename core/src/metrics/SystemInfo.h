@@ -12,6 +12,7 @@
 #pragma once
 
 #include <chrono>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -33,6 +34,8 @@ class SystemInfo {
     uint64_t in_octets_ = 0;
     uint64_t out_octets_ = 0;
     bool initialized_ = false;
+    std::vector<std::vector<int64_t>> numa_nodes_;
+    std::once_flag numa_flag_;
 
  public:
     static SystemInfo&
@@ -115,6 +118,14 @@ class SystemInfo {
     std::vector<float>
     CPUTemperature();
 
+    // cpu list of the kernel, "0-3,8-11" -> 0 1 2 3 8 9 10 11, malformed ranges are skipped
+    static std::vector<int64_t>
+    ParseCpuList(const std::string& list);
+
+    // cpus of each numa node read from /sys/devices/system/node, one node with all cpus if numa is absent
+    const std::vector<std::vector<int64_t>>&
+    NumaTopology();
+
     void
     GetSysInfoJsonStr(std::string& result);
 };
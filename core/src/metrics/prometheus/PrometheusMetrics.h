@@ -94,6 +94,20 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    BuildIndexQueueDepthGaugeSet(double value) override {
+        if (startup_) {
+            build_index_queue_depth_gauge_.Set(value);
+        }
+    }
+
+    void
+    BuildIndexRowsTotalIncrement(double value = 1) override {
+        if (startup_) {
+            build_index_rows_total_.Increment(value);
+        }
+    }
+
     void
     CpuCacheUsageGaugeSet(double value) override {
         if (startup_) {
@@ -101,6 +115,13 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    CpuCacheNodeUsageGaugeSet(uint64_t node, double value) override {
+        if (startup_) {
+            cpu_cache_node_usage_.Add({{"node", std::to_string(node)}}).Set(value);
+        }
+    }
+
     void
     GpuCacheUsageGaugeSet() override;
 
@@ -202,6 +223,13 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    RequestRejectedIncrement(const std::string& group, const std::string& reason) override {
+        if (startup_) {
+            request_rejected_.Add({{"group", group}, {"reason", reason}}).Increment();
+        }
+    }
+
     void
     DiskStoreIOSpeedGaugeSet(double value) override {
         if (startup_) {
@@ -440,6 +468,19 @@ class PrometheusMetrics : public MetricsBase {
     prometheus::Histogram& all_build_index_duration_seconds_histogram_ =
         all_build_index_duration_seconds_.Add({}, BucketBoundaries{2e6, 4e6, 6e6, 8e6, 1e7});
 
+    // record files waiting for index building and rows indexed, rate of the latter is the build throughput
+    prometheus::Family<prometheus::Gauge>& build_index_queue_depth_ = prometheus::BuildGauge()
+                                                                          .Name("build_index_queue_depth")
+                                                                          .Help("files waiting for index building")
+                                                                          .Register(*registry_);
+    prometheus::Gauge& build_index_queue_depth_gauge_ = build_index_queue_depth_.Add({});
+
+    prometheus::Family<prometheus::Counter>& build_index_rows_ = prometheus::BuildCounter()
+                                                                    .Name("build_index_rows_total")
+                                                                    .Help("the count of rows indexed")
+                                                                    .Register(*registry_);
+    prometheus::Counter& build_index_rows_total_ = build_index_rows_.Add({});
+
     // record duration of merging mem table
     prometheus::Family<prometheus::Histogram>& mem_table_merge_duration_seconds_ =
         prometheus::BuildHistogram()
@@ -548,6 +589,12 @@ class PrometheusMetrics : public MetricsBase {
         prometheus::BuildGauge().Name("cache_usage_bytes").Help("current cache usage by bytes").Register(*registry_);
     prometheus::Gauge& cpu_cache_usage_gauge_ = cpu_cache_usage_.Add({});
 
+    // record CPU cache usage % of each numa partition
+    prometheus::Family<prometheus::Gauge>& cpu_cache_node_usage_ = prometheus::BuildGauge()
+                                                                       .Name("numa_cache_usage_percent")
+                                                                       .Help("cache usage % of each numa node")
+                                                                       .Register(*registry_);
+
     // record GPU cache usage and %
     prometheus::Family<prometheus::Gauge>& gpu_cache_usage_ = prometheus::BuildGauge()
                                                                   .Name("gpu_cache_usage_bytes")
@@ -561,6 +608,12 @@ class PrometheusMetrics : public MetricsBase {
     prometheus::Summary& query_response_summary_ =
         query_response_.Add({}, Quantiles{{0.95, 0.00}, {0.9, 0.05}, {0.8, 0.1}});
 
+    // record requests shed by admission control of RequestScheduler
+    prometheus::Family<prometheus::Counter>& request_rejected_ = prometheus::BuildCounter()
+                                                                     .Name("request_rejected_total")
+                                                                     .Help("the count of rejected requests")
+                                                                     .Register(*registry_);
+
     prometheus::Family<prometheus::Summary>& query_vector_response_ = prometheus::BuildSummary()
                                                                           .Name("query_vector_response_summary")
                                                                           .Help("query each vector response summary")
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <deque>
@@ -26,36 +27,67 @@
 namespace milvus {
 namespace scheduler {
 
+/*
+ * Budget of concurrent index builds on cpu. A build reserves its estimated memory from load until it is executed,
+ * builds are started while both the count limit and the memory budget allow. A build larger than the whole budget
+ * still runs when no other build holds memory, so it can't starve.
+ * The thread budget is split evenly between the builds running at the time a build starts.
+ */
 class BuildMgr {
  public:
-    explicit BuildMgr(int64_t concurrent_limit) : available_(concurrent_limit) {
+    BuildMgr(int64_t concurrent_limit, int64_t memory_budget, int64_t thread_budget)
+        : concurrent_limit_(concurrent_limit), memory_budget_(memory_budget), thread_budget_(thread_budget) {
     }
 
  public:
     void
-    Put() {
+    Put(int64_t memory) {
         std::lock_guard<std::mutex> lock(mutex_);
-        ++available_;
+        --running_;
+        memory_used_ -= memory;
     }
 
+    void
+    Take(int64_t memory) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++running_;
+        memory_used_ += memory;
+    }
+
+    // whether count more builds needing memory bytes in total can be started now
     bool
-    Take() {
+    Fits(int64_t count, int64_t memory) {
         std::lock_guard<std::mutex> lock(mutex_);
-        if (available_ < 1) {
+        if (running_ + count > concurrent_limit_) {
             return false;
-        } else {
-            --available_;
-            return true;
         }
+        return memory_used_ + memory <= memory_budget_ || (running_ == 0 && count == 1);
     }
 
     int64_t
     NumOfAvailable() {
-        return available_;
+        std::lock_guard<std::mutex> lock(mutex_);
+        return concurrent_limit_ - running_;
+    }
+
+    int64_t
+    ConcurrentLimit() const {
+        return concurrent_limit_;
+    }
+
+    int64_t
+    ThreadsPerBuild() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::max<int64_t>(1, thread_budget_ / std::max<int64_t>(1, running_));
     }
 
  private:
-    std::int64_t available_;
+    const int64_t concurrent_limit_;
+    const int64_t memory_budget_;
+    const int64_t thread_budget_;
+
+    int64_t running_ = 0;
+    int64_t memory_used_ = 0;
     std::mutex mutex_;
 };
 
@@ -14,6 +14,7 @@
 #include <src/db/Utils.h>
 #include <src/segment/SegmentReader.h>
 
+#include <algorithm>
 #include <limits>
 #include <utility>
 
@@ -83,11 +84,11 @@ JobMgr::worker_function() {
         // TODO(zhiru): if the job is search by ids, pass any task where the ids don't exist
         auto search_job = std::dynamic_pointer_cast<SearchJob>(job);
         if (search_job != nullptr) {
-            scheduler::ResultIds ids(search_job->nq() * search_job->topk(), -1);
-            scheduler::ResultDistances distances(search_job->nq() * search_job->topk(),
-                                                 std::numeric_limits<float>::max());
-            search_job->GetResultIds() = ids;
-            search_job->GetResultDistances() = distances;
+            for (auto& group : search_job->groups()) {
+                search_job->GetResultIds(group).assign(search_job->result_nq() * search_job->topk(), -1);
+                search_job->GetResultDistances(group).assign(search_job->result_nq() * search_job->topk(),
+                                                             std::numeric_limits<float>::max());
+            }
 
             if (search_job->vectors().float_data_.empty() && search_job->vectors().binary_data_.empty() &&
                 !search_job->vectors().id_array_.empty()) {
@@ -120,6 +121,8 @@ JobMgr::worker_function() {
                     }
                 }
             }
+
+            tasks = split_search_task(search_job, tasks);
         }
 
         //        for (auto &task : tasks) {
@@ -150,6 +153,35 @@ JobMgr::build_task(const JobPtr& job) {
     return TaskCreator::Create(job);
 }
 
+std::vector<TaskPtr>
+JobMgr::split_search_task(const SearchJobPtr& search_job, const std::vector<TaskPtr>& tasks) {
+    // ids are searched in one piece, only queries given as vectors are split
+    uint64_t slice_count = std::min(SEARCH_MAX_SLICES, search_job->nq() / SEARCH_SLICE_MIN_NQ);
+    if (search_job->vectors().float_data_.empty() && search_job->vectors().binary_data_.empty()) {
+        slice_count = 1;
+    }
+
+    // searches pile up on the files of a hot partition, their slices are labelled one by one by the optimizer,
+    // so they go to different executors while other files are searched as a whole. Searches too small to split
+    // still run side by side with the other searches on the hot file
+    std::vector<TaskPtr> result;
+    for (auto& task : tasks) {
+        auto search_task = std::static_pointer_cast<XSearchTask>(task);
+        if (XSearchTask::QueuedSearches(search_task->GetLocation()) < HOT_SEGMENT_QUEUED_SEARCHES) {
+            result.emplace_back(task);
+            continue;
+        }
+        search_task->hot_ = true;
+        auto slices = XSearchTask::SplitByQueries(search_task, slice_count);
+        result.insert(result.end(), slices.begin(), slices.end());
+    }
+
+    for (auto& task : result) {
+        std::static_pointer_cast<XSearchTask>(task)->MarkQueued();
+    }
+    return result;
+}
+
 void
 JobMgr::calculate_path(const ResourceMgrPtr& res_mgr, const TaskPtr& task) {
     if (task->type_ != TaskType::SearchTask && task->type_ != TaskType::BuildIndexTask) {
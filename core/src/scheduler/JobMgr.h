@@ -24,6 +24,7 @@
 #include "ResourceMgr.h"
 #include "interface/interfaces.h"
 #include "job/Job.h"
+#include "job/SearchJob.h"
 #include "task/Task.h"
 
 namespace milvus {
@@ -53,6 +54,10 @@ class JobMgr : public interface::dumpable {
     static std::vector<TaskPtr>
     build_task(const JobPtr& job);
 
+    // split the searches on hot segment files by queries
+    static std::vector<TaskPtr>
+    split_search_task(const SearchJobPtr& search_job, const std::vector<TaskPtr>& tasks);
+
  public:
     static void
     calculate_path(const ResourceMgrPtr& res_mgr, const TaskPtr& task);
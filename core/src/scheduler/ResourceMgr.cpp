@@ -199,7 +199,7 @@ ResourceMgr::check_resource_valid() {
         if (GetDiskResources().size() != 1) {
             return false;
         }
-        if (GetCpuResources().size() != 1) {
+        if (GetCpuResources().empty()) {
             return false;
         }
     }
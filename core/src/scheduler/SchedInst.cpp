@@ -12,6 +12,7 @@
 #include "scheduler/SchedInst.h"
 #include "ResourceFactory.h"
 #include "Utils.h"
+#include "cache/CpuCacheMgr.h"
 #include "server/Config.h"
 
 #include <fiu-local.h>
@@ -47,6 +48,13 @@ load_simple_config() {
     ResMgrInst::GetInstance()->Add(ResourceFactory::Create("cpu", "CPU", 0));
     ResMgrInst::GetInstance()->Connect("disk", "cpu", io);
 
+    // one more cpu resource for each other numa node when cpu cache is numa aware, device id is the node
+    for (uint64_t node = 1; node < cache::CpuCacheMgr::GetInstance()->NodeCount(); ++node) {
+        std::string name = "cpu" + std::to_string(node);
+        ResMgrInst::GetInstance()->Add(ResourceFactory::Create(name, "CPU", node));
+        ResMgrInst::GetInstance()->Connect("disk", name, io);
+    }
+
 // get resources
 #ifdef MILVUS_GPU_VERSION
     bool enable_gpu = false;
@@ -16,6 +16,7 @@
 #include "ResourceMgr.h"
 #include "Scheduler.h"
 #include "Utils.h"
+#include "db/Constants.h"
 #include "optimizer/BuildIndexPass.h"
 #include "optimizer/FaissFlatPass.h"
 #include "optimizer/FaissIVFFlatPass.h"
@@ -25,7 +26,9 @@
 #include "optimizer/FallbackPass.h"
 #include "optimizer/Optimizer.h"
 #include "server/Config.h"
+#include "utils/CommonUtil.h"
 
+#include <cmath>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -149,7 +152,18 @@ class BuildMgrInst {
         if (instance == nullptr) {
             std::lock_guard<std::mutex> lock(mutex_);
             if (instance == nullptr) {
-                instance = std::make_shared<BuildMgr>(4);
+                server::Config& config = server::Config::GetInstance();
+                int64_t build_concurrency = 4, build_memory_budget = 4, omp_thread_num = 0;
+                config.GetEngineConfigBuildConcurrency(build_concurrency);
+                config.GetEngineConfigBuildMemoryBudget(build_memory_budget);
+                config.GetEngineConfigOmpThreadNum(omp_thread_num);
+                if (omp_thread_num <= 0) {
+                    int64_t sys_thread_cnt = 8;
+                    server::CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+                    omp_thread_num = static_cast<int64_t>(ceil(sys_thread_cnt * 0.5));
+                }
+                instance = std::make_shared<BuildMgr>(build_concurrency, build_memory_budget * engine::ONE_GB,
+                                                      omp_thread_num);
             }
         }
         return instance;
@@ -13,11 +13,14 @@
 #include "Utils.h"
 #include "event/TaskTableUpdatedEvent.h"
 #include "scheduler/SchedInst.h"
+#include "scheduler/task/BuildIndexTask.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
+#include <algorithm>
 #include <ctime>
 #include <sstream>
+#include <tuple>
 #include <vector>
 
 namespace milvus {
@@ -153,8 +156,12 @@ TaskTable::PickToLoad(uint64_t limit) {
     std::vector<uint64_t> indexes;
     bool cross = false;
 
+    // build tasks picked in this round, they must fit into the build budget together
+    int64_t build_count = 0;
+    int64_t build_memory = 0;
+
     uint64_t available_begin = table_.front() + 1;
-    for (uint64_t i = 0, loaded_count = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
+    for (uint64_t i = 0, loaded_count = 0; i < table_.size(); ++i) {
         auto index = available_begin + i;
         if (not table_[index])
             break;
@@ -164,24 +171,28 @@ TaskTable::PickToLoad(uint64_t limit) {
             table_.set_front(index);
         } else if (table_[index]->state == TaskTableItemState::LOADED) {
             cross = true;
-            ++loaded_count;
-            if (loaded_count > 2)
+            // only count loaded tasks in front of the first `limit` candidates, those behind them
+            // never held back loading before candidates were ordered by priority
+            if (indexes.size() < limit && ++loaded_count > 2)
                 return std::vector<uint64_t>();
         } else if (table_[index]->state == TaskTableItemState::START) {
             auto task = table_[index]->task;
 
             // if task is a build index task, limit it
             if (task->Type() == TaskType::BuildIndexTask && task->path().Current() == "cpu") {
-                if (BuildMgrInst::GetInstance()->NumOfAvailable() < 1) {
-                    SERVER_LOG_WARNING << "BuildMgr doesnot have available place for building index";
+                auto memory = std::static_pointer_cast<XBuildIndexTask>(task)->EstimatedMemory();
+                if (!BuildMgrInst::GetInstance()->Fits(build_count + 1, build_memory + memory)) {
+                    SERVER_LOG_DEBUG << "BuildMgr doesnot have available place for building index";
                     continue;
                 }
+                ++build_count;
+                build_memory += memory;
             }
             cross = true;
             indexes.push_back(index);
-            ++pick_count;
         }
     }
+    SelectByPriority(indexes, limit);
     rc.ElapseFromBegin("PickToLoad ");
     return indexes;
 #else
@@ -237,7 +248,7 @@ TaskTable::PickToExecute(uint64_t limit) {
     std::vector<uint64_t> indexes;
     bool cross = false;
     uint64_t available_begin = table_.front() + 1;
-    for (uint64_t i = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
+    for (uint64_t i = 0; i < table_.size(); ++i) {
         uint64_t index = available_begin + i;
         if (not table_[index]) {
             break;
@@ -251,13 +262,42 @@ TaskTable::PickToExecute(uint64_t limit) {
         } else if (table_[index]->state == TaskTableItemState::LOADED) {
             cross = true;
             indexes.push_back(index);
-            ++pick_count;
         }
     }
+    SelectByPriority(indexes, limit);
     rc.ElapseFromBegin("PickToExecute ");
     return indexes;
 }
 
+void
+TaskTable::SelectByPriority(std::vector<uint64_t>& indexes, uint64_t limit) {
+    // cancelled jobs go first so that their tasks are dropped instead of occupying the queue
+    using Key = std::tuple<bool, int, JobDeadline>;
+    auto key_of = [&](uint64_t index) {
+        auto job = table_[index]->task->job_.lock();
+        if (job == nullptr) {
+            return Key(true, -static_cast<int>(JobPriority::NORMAL), JobDeadline::max());
+        }
+        return Key(!job->Cancelled(), -static_cast<int>(job->priority()), job->deadline());
+    };
+
+    std::vector<std::pair<Key, uint64_t>> keyed;
+    keyed.reserve(indexes.size());
+    for (auto index : indexes) {
+        keyed.emplace_back(key_of(index), index);
+    }
+    // stable sort keeps tasks of the same priority and deadline in FIFO order
+    std::stable_sort(keyed.begin(), keyed.end(),
+                     [](const std::pair<Key, uint64_t>& a, const std::pair<Key, uint64_t>& b) {
+                         return a.first < b.first;
+                     });
+
+    indexes.clear();
+    for (uint64_t i = 0; i < keyed.size() && i < limit; ++i) {
+        indexes.push_back(keyed[i].second);
+    }
+}
+
 void
 TaskTable::Put(TaskPtr task, TaskTableItemPtr from) {
     auto item = std::make_shared<TaskTableItem>(std::move(from));
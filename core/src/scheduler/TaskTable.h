@@ -119,6 +119,7 @@ class TaskTable : public interface::dumpable {
     size_t
     TaskToExecute();
 
+    // candidates are picked by job priority, then earliest deadline, then FIFO
     std::vector<uint64_t>
     PickToLoad(uint64_t limit);
 
@@ -210,6 +211,11 @@ class TaskTable : public interface::dumpable {
         return table_[index]->Moved();
     }
 
+ private:
+    // order candidates and keep the first limit of them
+    void
+    SelectByPriority(std::vector<uint64_t>& indexes, uint64_t limit);
+
  private:
     std::uint64_t id_ = 0;
     CircleQueue<TaskTableItemPtr> table_;
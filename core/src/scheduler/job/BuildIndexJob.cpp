@@ -19,6 +19,8 @@ namespace scheduler {
 
 BuildIndexJob::BuildIndexJob(engine::meta::MetaPtr meta_ptr, engine::DBOptions options)
     : Job(JobType::BUILD), meta_ptr_(std::move(meta_ptr)), options_(std::move(options)) {
+    // one task per segment, searches waiting between two segments are picked first
+    set_priority(JobPriority::LOW);
     SetIdentity("BuildIndexJob");
     AddCacheInsertDataListener();
 }
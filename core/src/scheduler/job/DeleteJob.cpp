@@ -21,6 +21,7 @@ DeleteJob::DeleteJob(std::string table_id, engine::meta::MetaPtr meta_ptr, uint6
       table_id_(std::move(table_id)),
       meta_ptr_(std::move(meta_ptr)),
       num_resource_(num_resource) {
+    set_priority(JobPriority::HIGH);
 }
 
 void
@@ -24,11 +24,22 @@ Job::Job(JobType type) : type_(type) {
     id_ = unique_job_id++;
 }
 
+bool
+Job::Expired() const {
+    return deadline_ != JobDeadline::max() && std::chrono::system_clock::now() > deadline_;
+}
+
+bool
+Job::Cancelled() const {
+    return Expired();
+}
+
 json
 Job::Dump() const {
     json ret{
         {"id", id_},
         {"type", type_},
+        {"priority", priority_},
     };
     return ret;
 }
@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <list>
@@ -35,7 +36,15 @@ enum class JobType {
     BUILD,
 };
 
+// tasks of a higher priority job are loaded and executed first
+enum class JobPriority {
+    LOW = 0,     // index building
+    NORMAL = 1,  // batch search
+    HIGH = 2,    // small search, delete
+};
+
 using JobId = std::uint64_t;
+using JobDeadline = std::chrono::system_clock::time_point;
 
 class Job : public interface::dumpable {
  public:
@@ -49,6 +58,34 @@ class Job : public interface::dumpable {
         return type_;
     }
 
+    inline JobPriority
+    priority() const {
+        return priority_;
+    }
+
+    inline void
+    set_priority(JobPriority priority) {
+        priority_ = priority;
+    }
+
+    // JobDeadline::max() if the job has no deadline
+    inline const JobDeadline&
+    deadline() const {
+        return deadline_;
+    }
+
+    inline void
+    set_deadline(const JobDeadline& deadline) {
+        deadline_ = deadline;
+    }
+
+    bool
+    Expired() const;
+
+    // nobody waits for the result anymore, tasks of a cancelled job are dropped
+    virtual bool
+    Cancelled() const;
+
     json
     Dump() const override;
 
@@ -58,6 +95,8 @@ class Job : public interface::dumpable {
  private:
     JobId id_ = 0;
     JobType type_;
+    JobPriority priority_ = JobPriority::NORMAL;
+    JobDeadline deadline_ = JobDeadline::max();
 };
 
 using JobPtr = std::shared_ptr<Job>;
@@ -11,6 +11,8 @@
 
 #include "scheduler/job/SearchJob.h"
 
+#include <algorithm>
+
 #include "utils/Log.h"
 
 namespace milvus {
@@ -19,10 +21,28 @@ namespace scheduler {
 SearchJob::SearchJob(const std::shared_ptr<server::Context>& context, uint64_t topk, const milvus::json& extra_params,
                      const engine::VectorsData& vectors)
     : Job(JobType::SEARCH), context_(context), topk_(topk), extra_params_(extra_params), vectors_(vectors) {
+    set_priority(nq() <= HIGH_PRIORITY_MAX_NQ ? JobPriority::HIGH : JobPriority::NORMAL);
+    if (context_ != nullptr) {
+        set_deadline(context_->GetDeadline());
+    }
+
+    // already validated by the request
+    auto status = engine::QueryGroups::Parse(extra_params_, nq(), query_groups_);
+    if (!status.ok()) {
+        SERVER_LOG_ERROR << "SearchJob ignore query groups: " << status.message();
+    }
+}
+
+uint64_t
+SearchJob::search_k() const {
+    if (query_groups_ == nullptr) {
+        return topk_;
+    }
+    return std::max(topk_, std::min(topk_ * QUERY_GROUPS_CANDIDATE_FACTOR, QUERY_GROUPS_MAX_CANDIDATES));
 }
 
 bool
-SearchJob::AddIndexFile(const TableFileSchemaPtr& index_file) {
+SearchJob::AddIndexFile(const TableFileSchemaPtr& index_file, const std::string& group) {
     std::unique_lock<std::mutex> lock(mutex_);
     if (index_file == nullptr || index_files_.find(index_file->id_) != index_files_.end()) {
         return false;
@@ -31,6 +51,10 @@ SearchJob::AddIndexFile(const TableFileSchemaPtr& index_file) {
     SERVER_LOG_DEBUG << "SearchJob " << id() << " add index file: " << index_file->id_;
 
     index_files_[index_file->id_] = index_file;
+    file_groups_[index_file->id_] = group;
+    if (std::find(groups_.begin(), groups_.end(), group) == groups_.end()) {
+        groups_.push_back(group);
+    }
     return true;
 }
 
@@ -53,13 +77,13 @@ SearchJob::SearchDone(size_t index_id) {
 }
 
 ResultIds&
-SearchJob::GetResultIds() {
-    return result_ids_;
+SearchJob::GetResultIds(const std::string& group) {
+    return result_ids_[group];
 }
 
 ResultDistances&
-SearchJob::GetResultDistances() {
-    return result_distances_;
+SearchJob::GetResultDistances(const std::string& group) {
+    return result_distances_[group];
 }
 
 Status&
@@ -73,12 +97,18 @@ SearchJob::Dump() const {
         {"topk", topk_},
         {"nq", vectors_.vector_count_},
         {"extra_params", extra_params_.dump()},
+        {"groups", groups_},
     };
     auto base = Job::Dump();
     ret.insert(base.begin(), base.end());
     return ret;
 }
 
+bool
+SearchJob::Cancelled() const {
+    return Job::Cancelled() || (context_ != nullptr && context_->IsCancelled());
+}
+
 const std::shared_ptr<server::Context>&
 SearchJob::GetContext() const {
     return context_;
@@ -24,6 +24,7 @@
 
 #include "Job.h"
 #include "db/Types.h"
+#include "db/engine/QueryGroups.h"
 #include "db/meta/MetaTypes.h"
 
 #include "server/context/Context.h"
@@ -38,14 +39,23 @@ using Id2IndexMap = std::unordered_map<size_t, TableFileSchemaPtr>;
 using ResultIds = engine::ResultIds;
 using ResultDistances = engine::ResultDistances;
 
+// a multi-vector search fetches more candidates per query so ids hit by several queries of a group are kept
+static constexpr uint64_t QUERY_GROUPS_CANDIDATE_FACTOR = 4;
+static constexpr uint64_t QUERY_GROUPS_MAX_CANDIDATES = 2048;
+
+// searches with no more queries than this are latency sensitive and run before batch searches
+static constexpr uint64_t HIGH_PRIORITY_MAX_NQ = 16;
+
 class SearchJob : public Job {
  public:
     SearchJob(const std::shared_ptr<server::Context>& context, uint64_t topk, const milvus::json& extra_params,
               const engine::VectorsData& vectors);
 
  public:
+    // results are reduced per group, the group is the table which the file is searched for,
+    // so one job could search several tables
     bool
-    AddIndexFile(const TableFileSchemaPtr& index_file);
+    AddIndexFile(const TableFileSchemaPtr& index_file, const std::string& group);
 
     void
     WaitResult();
@@ -54,10 +64,10 @@ class SearchJob : public Job {
     SearchDone(size_t index_id);
 
     ResultIds&
-    GetResultIds();
+    GetResultIds(const std::string& group);
 
     ResultDistances&
-    GetResultDistances();
+    GetResultDistances(const std::string& group);
 
     Status&
     GetStatus();
@@ -65,6 +75,10 @@ class SearchJob : public Job {
     json
     Dump() const override;
 
+    // the deadline has passed or the client has gone
+    bool
+    Cancelled() const override;
+
  public:
     const std::shared_ptr<server::Context>&
     GetContext() const;
@@ -79,6 +93,21 @@ class SearchJob : public Job {
         return vectors_.vector_count_;
     }
 
+    // k searched per query, larger than topk for a multi-vector search
+    uint64_t
+    search_k() const;
+
+    // rows of the result, one row per group for a multi-vector search
+    uint64_t
+    result_nq() const {
+        return query_groups_ == nullptr ? nq() : query_groups_->GroupCount();
+    }
+
+    const engine::QueryGroupsPtr&
+    query_groups() const {
+        return query_groups_;
+    }
+
     const milvus::json&
     extra_params() const {
         return extra_params_;
@@ -94,6 +123,18 @@ class SearchJob : public Job {
         return index_files_;
     }
 
+    const std::vector<std::string>&
+    groups() const {
+        return groups_;
+    }
+
+    const std::string&
+    file_group(size_t index_id) const {
+        static const std::string empty;
+        auto iter = file_groups_.find(index_id);
+        return iter == file_groups_.end() ? empty : iter->second;
+    }
+
     std::mutex&
     mutex() {
         return mutex_;
@@ -106,11 +147,14 @@ class SearchJob : public Job {
     milvus::json extra_params_;
     // TODO: smart pointer
     const engine::VectorsData& vectors_;
+    engine::QueryGroupsPtr query_groups_;
 
     Id2IndexMap index_files_;
+    std::unordered_map<size_t, std::string> file_groups_;
+    std::vector<std::string> groups_;
     // TODO: column-base better ?
-    ResultIds result_ids_;
-    ResultDistances result_distances_;
+    std::unordered_map<std::string, ResultIds> result_ids_;
+    std::unordered_map<std::string, ResultDistances> result_distances_;
     Status status_;
 
     std::mutex mutex_;
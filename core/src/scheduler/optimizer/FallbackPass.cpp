@@ -10,12 +10,40 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "scheduler/optimizer/FallbackPass.h"
+#include "cache/CpuCacheMgr.h"
 #include "scheduler/SchedInst.h"
+#include "scheduler/task/SearchTask.h"
 #include "scheduler/tasklabel/SpecResLabel.h"
 
 namespace milvus {
 namespace scheduler {
 
+namespace {
+
+// a search task goes to the cpu resource of the numa node its segment is cached on, unless that resource
+// is far busier than the idlest one
+constexpr uint64_t NUMA_STEAL_SLACK = 8;
+
+}  // namespace
+
+ResourcePtr
+FallbackPass::PickCpuResource(const std::vector<ResourceWPtr>& cpus, uint64_t node) {
+    ResourcePtr local = cpus[0].lock(), idlest = local;
+    for (auto& weak_cpu : cpus) {
+        auto cpu = weak_cpu.lock();
+        if (cpu->device_id() == node) {
+            local = cpu;
+        }
+        if (cpu->NumOfTaskToExec() < idlest->NumOfTaskToExec()) {
+            idlest = cpu;
+        }
+    }
+    if (local->NumOfTaskToExec() > 2 * idlest->NumOfTaskToExec() + NUMA_STEAL_SLACK) {
+        return idlest;
+    }
+    return local;
+}
+
 void
 FallbackPass::Init() {
 }
@@ -28,7 +56,12 @@ FallbackPass::Run(const TaskPtr& task) {
     }
     // NEVER be empty
     SERVER_LOG_DEBUG << "FallbackPass!";
-    auto cpu = ResMgrInst::GetInstance()->GetCpuResources()[0];
+    auto cpus = ResMgrInst::GetInstance()->GetCpuResources();
+    ResourcePtr cpu = cpus[0].lock();
+    if (cpus.size() > 1 && task_type == TaskType::SearchTask) {
+        auto search_task = std::static_pointer_cast<XSearchTask>(task);
+        cpu = PickCpuResource(cpus, cache::CpuCacheMgr::GetInstance()->NodeOf(search_task->GetLocation()));
+    }
     auto label = std::make_shared<SpecResLabel>(cpu);
     task->label() = label;
     return true;
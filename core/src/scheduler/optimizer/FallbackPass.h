@@ -12,8 +12,10 @@
 
 #include <bits/stdc++.h>
 #include <memory>
+#include <vector>
 
 #include "Pass.h"
+#include "scheduler/resource/Resource.h"
 
 namespace milvus {
 namespace scheduler {
@@ -28,6 +30,10 @@ class FallbackPass : public Pass {
 
     bool
     Run(const TaskPtr& task) override;
+
+    // cpu resource of the numa node, unless its backlog is far larger than the idlest one's
+    static ResourcePtr
+    PickCpuResource(const std::vector<ResourceWPtr>& cpus, uint64_t node);
 };
 
 }  // namespace scheduler
@@ -10,7 +10,12 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "scheduler/resource/CpuResource.h"
+#include "cache/CpuCacheMgr.h"
+#include "metrics/SystemInfo.h"
+#include "utils/Log.h"
 
+#include <pthread.h>
+#include <sched.h>
 #include <utility>
 
 namespace milvus {
@@ -36,5 +41,30 @@ CpuResource::Process(TaskPtr task) {
     task->Execute();
 }
 
+void
+CpuResource::InitThread() {
+    if (cache::CpuCacheMgr::GetInstance()->NodeCount() <= 1) {
+        return;
+    }
+
+    auto& numa_nodes = server::SystemInfo::GetInstance().NumaTopology();
+    if (device_id_ >= numa_nodes.size()) {
+        return;
+    }
+
+    // omp threads started by this thread inherit the affinity, memory first touched here is on the node
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto cpu : numa_nodes[device_id_]) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret != 0) {
+        SERVER_LOG_WARNING << name() << " failed to bind to numa node " << device_id_ << ", error " << ret;
+    } else {
+        SERVER_LOG_DEBUG << name() << " thread bound to numa node " << device_id_;
+    }
+}
+
 }  // namespace scheduler
 }  // namespace milvus
@@ -31,6 +31,10 @@ class CpuResource : public Resource {
 
     void
     Process(TaskPtr task) override;
+
+    // with numa aware cpu cache, the resource of numa node device_id runs on the cpus of that node
+    void
+    InitThread() override;
 };
 
 }  // namespace scheduler
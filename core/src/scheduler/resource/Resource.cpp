@@ -12,7 +12,12 @@
 #include "scheduler/resource/Resource.h"
 #include "scheduler/SchedInst.h"
 #include "scheduler/Utils.h"
+#include "scheduler/task/BuildIndexTask.h"
+#include "scheduler/task/SearchTask.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -58,6 +63,14 @@ Resource::Start() {
     running_ = true;
     loader_thread_ = std::thread(&Resource::loader_function, this);
     if (enable_executor_) {
+        // every cpu resource runs searches side by side, index builds only run on "cpu"
+        if (type() == ResourceType::CPU) {
+            search_pool_ = std::make_shared<ThreadPool>(SEARCH_MAX_SLICES);
+            search_threads_ = std::max(1, omp_get_max_threads() / static_cast<int>(SEARCH_MAX_SLICES));
+        }
+        if (name() == "cpu") {
+            build_pool_ = std::make_shared<ThreadPool>(BuildMgrInst::GetInstance()->ConcurrentLimit());
+        }
         executor_thread_ = std::thread(&Resource::executor_function, this);
     }
 }
@@ -70,6 +83,9 @@ Resource::Stop() {
     if (enable_executor_) {
         WakeupExecutor();
         executor_thread_.join();
+        // wait for the index builds and search slices still running
+        build_pool_ = nullptr;
+        search_pool_ = nullptr;
     }
 }
 
@@ -98,8 +114,8 @@ Resource::Dump() const {
         {"name", name_},
         {"type", ToString(type_)},
         {"task_average_cost", TaskAvgCost()},
-        {"task_total_cost", total_cost_},
-        {"total_tasks", total_task_},
+        {"task_total_cost", total_cost_.load()},
+        {"total_tasks", total_task_.load()},
         {"running", running_},
         {"enable_executor", enable_executor_},
     };
@@ -153,6 +169,7 @@ Resource::pick_task_execute() {
 
 void
 Resource::loader_function() {
+    InitThread();
     while (running_) {
         std::unique_lock<std::mutex> lock(load_mutex_);
         load_cv_.wait(lock, [&] { return load_flag_; });
@@ -164,7 +181,8 @@ Resource::loader_function() {
                 break;
             }
             if (task_item->task->Type() == TaskType::BuildIndexTask && name() == "cpu") {
-                BuildMgrInst::GetInstance()->Take();
+                auto build_task = std::static_pointer_cast<XBuildIndexTask>(task_item->task);
+                BuildMgrInst::GetInstance()->Take(build_task->EstimatedMemory());
                 SERVER_LOG_DEBUG << name() << " load BuildIndexTask";
             }
             LoadFile(task_item->task);
@@ -181,8 +199,32 @@ Resource::loader_function() {
     }
 }
 
+void
+Resource::ExecuteTask(const TaskTableItemPtr& task_item) {
+    auto start = get_current_timestamp();
+    Process(task_item->task);
+    auto finish = get_current_timestamp();
+    ++total_task_;
+    total_cost_ += finish - start;
+
+    task_item->Executed();
+
+    if (task_item->task->Type() == TaskType::BuildIndexTask) {
+        auto build_task = std::static_pointer_cast<XBuildIndexTask>(task_item->task);
+        BuildMgrInst::GetInstance()->Put(build_task->EstimatedMemory());
+        ResMgrInst::GetInstance()->GetResource("cpu")->WakeupLoader();
+        ResMgrInst::GetInstance()->GetResource("disk")->WakeupLoader();
+    }
+
+    if (subscriber_) {
+        auto event = std::make_shared<FinishTaskEvent>(shared_from_this(), task_item);
+        subscriber_(std::static_pointer_cast<Event>(event));
+    }
+}
+
 void
 Resource::executor_function() {
+    InitThread();
     if (subscriber_) {
         auto event = std::make_shared<StartUpEvent>(shared_from_this());
         subscriber_(std::static_pointer_cast<Event>(event));
@@ -197,23 +239,24 @@ Resource::executor_function() {
             if (task_item == nullptr) {
                 break;
             }
-            auto start = get_current_timestamp();
-            Process(task_item->task);
-            auto finish = get_current_timestamp();
-            ++total_task_;
-            total_cost_ += finish - start;
-
-            task_item->Executed();
-
-            if (task_item->task->Type() == TaskType::BuildIndexTask) {
-                BuildMgrInst::GetInstance()->Put();
-                ResMgrInst::GetInstance()->GetResource("cpu")->WakeupLoader();
-                ResMgrInst::GetInstance()->GetResource("disk")->WakeupLoader();
-            }
-
-            if (subscriber_) {
-                auto event = std::make_shared<FinishTaskEvent>(shared_from_this(), task_item);
-                subscriber_(std::static_pointer_cast<Event>(event));
+            // index builds on cpu run side by side in the build pool, the thread budget is split between them
+            if (task_item->task->Type() == TaskType::BuildIndexTask && build_pool_ != nullptr) {
+                build_pool_->enqueue([this, task_item]() {
+                    InitThread();
+                    omp_set_num_threads(BuildMgrInst::GetInstance()->ThreadsPerBuild());
+                    ExecuteTask(task_item);
+                });
+            } else if (task_item->task->Type() == TaskType::SearchTask && search_pool_ != nullptr &&
+                       std::static_pointer_cast<XSearchTask>(task_item->task)->IsHot()) {
+                // searches and slices of searches on a hot segment file run side by side, each with a share of the
+                // omp threads
+                search_pool_->enqueue([this, task_item]() {
+                    InitThread();
+                    omp_set_num_threads(search_threads_);
+                    ExecuteTask(task_item);
+                });
+            } else {
+                ExecuteTask(task_item);
             }
         }
     }
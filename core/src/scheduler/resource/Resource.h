@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -28,6 +29,7 @@
 #include "../task/Task.h"
 #include "Connection.h"
 #include "Node.h"
+#include "utils/ThreadPool.h"
 
 namespace milvus {
 namespace scheduler {
@@ -139,6 +141,13 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     virtual void
     Process(TaskPtr task) = 0;
 
+    /*
+     * Called at the beginning of loader and executor threads;
+     */
+    virtual void
+    InitThread() {
+    }
+
  private:
     /*
      * Pick one task to load;
@@ -167,6 +176,12 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     void
     executor_function();
 
+    /*
+     * Process one picked task and publish the result, called by worker thread, build pool or search pool;
+     */
+    void
+    ExecuteTask(const TaskTableItemPtr& task_item);
+
  protected:
     uint64_t device_id_;
     std::string name_;
@@ -176,8 +191,8 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
 
     TaskTable task_table_;
 
-    uint64_t total_cost_ = 0;
-    uint64_t total_task_ = 0;
+    std::atomic<uint64_t> total_cost_{0};
+    std::atomic<uint64_t> total_task_{0};
 
     std::function<void(EventPtr)> subscriber_ = nullptr;
 
@@ -185,6 +200,9 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     bool enable_executor_ = true;
     std::thread loader_thread_;
     std::thread executor_thread_;
+    std::shared_ptr<ThreadPool> build_pool_ = nullptr;
+    std::shared_ptr<ThreadPool> search_pool_ = nullptr;
+    int search_threads_ = 1;
 
     bool load_flag_ = false;
     bool exec_flag_ = false;
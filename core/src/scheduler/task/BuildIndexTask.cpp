@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "db/Utils.h"
+#include "db/engine/BuildCheckpoint.h"
 #include "db/engine/EngineFactory.h"
 #include "metrics/Metrics.h"
 #include "scheduler/job/BuildIndexJob.h"
@@ -30,6 +31,40 @@
 namespace milvus {
 namespace scheduler {
 
+namespace {
+
+// rough peak memory of building the index of a file: the raw vectors loaded plus the index being built
+int64_t
+EstimateBuildMemory(const TableFileSchema& file, const milvus::json& params) {
+    int64_t rows = file.row_count_;
+    int64_t raw = engine::utils::IsBinaryMetricType(file.metric_type_) ? rows * file.dimension_ / 8
+                                                                        : rows * file.dimension_ * sizeof(float);
+    int64_t ids = rows * sizeof(int64_t);
+    switch ((EngineType)file.engine_type_) {
+        case EngineType::FAISS_IVFFLAT:
+        case EngineType::FAISS_BIN_IVFFLAT:
+            return raw + raw + ids;
+        case EngineType::FAISS_IVFSQ8:
+        case EngineType::FAISS_IVFSQ8H:
+            return raw + raw / 4 + ids;
+        case EngineType::FAISS_PQ:
+            return raw + raw / 8 + ids;
+        case EngineType::NSG_MIX:
+            return raw + raw + rows * 128 * sizeof(int64_t);
+        case EngineType::HNSW: {
+            int64_t m = params.contains("M") && params["M"].is_number_integer() ? params["M"].get<int64_t>() : 16;
+            return raw + raw + rows * m * 2 * sizeof(int32_t);
+        }
+        case EngineType::SPTAG_KDT:
+        case EngineType::SPTAG_BKT:
+            return raw * 3;
+        default:
+            return raw + raw;
+    }
+}
+
+}  // namespace
+
 XBuildIndexTask::XBuildIndexTask(TableFileSchemaPtr file, TaskLabelPtr label)
     : Task(TaskType::BuildIndexTask, std::move(label)), file_(file) {
     if (file_) {
@@ -46,6 +81,7 @@ XBuildIndexTask::XBuildIndexTask(TableFileSchemaPtr file, TaskLabelPtr label)
         auto json = milvus::json::parse(file_->index_params_);
         to_index_engine_ = EngineFactory::Build(file_->dimension_, file_->location_, engine_type,
                                                 (MetricType)file_->metric_type_, json);
+        estimated_memory_ = EstimateBuildMemory(*file_, json);
     }
 }
 
@@ -155,6 +191,9 @@ XBuildIndexTask::Execute() {
             status = meta_ptr->UpdateTableFile(table_file);
             ENGINE_LOG_DEBUG << "Build index fail, mark file: " << table_file.file_id_ << " to to_delete";
 
+            // a failed file is not built again, so its checkpoint would only leak on disk
+            engine::BuildCheckpoint::Remove(location);
+
             build_index_job->BuildIndexDone(to_index_id_);
             build_index_job->GetStatus() = Status(DB_ERROR, msg);
             to_index_engine_ = nullptr;
@@ -28,12 +28,19 @@ class XBuildIndexTask : public Task {
     void
     Execute() override;
 
+    // bytes reserved from BuildMgr while the task is loaded or running on cpu
+    int64_t
+    EstimatedMemory() const {
+        return estimated_memory_;
+    }
+
  public:
     TableFileSchemaPtr file_;
     TableFileSchema table_file_;
     size_t to_index_id_ = 0;
     int to_index_type_ = 0;
     ExecutionEnginePtr to_index_engine_ = nullptr;
+    int64_t estimated_memory_ = 0;
 };
 
 }  // namespace scheduler
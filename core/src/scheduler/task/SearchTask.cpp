@@ -11,11 +11,14 @@
 
 #include <fiu-local.h>
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 
+#include "cache/CpuCacheMgr.h"
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
 #include "metrics/Metrics.h"
@@ -33,6 +36,13 @@ namespace scheduler {
 static constexpr size_t PARALLEL_REDUCE_THRESHOLD = 10000;
 static constexpr size_t PARALLEL_REDUCE_BATCH = 1000;
 
+namespace {
+
+std::mutex queued_mutex;
+std::unordered_map<std::string, uint64_t> queued_searches;
+
+}  // namespace
+
 // TODO(wxyu): remove unused code
 // bool
 // NeedParallelReduce(uint64_t nq, uint64_t topk) {
@@ -129,15 +139,30 @@ void
 XSearchTask::Load(LoadType type, uint8_t device_id) {
     auto load_ctx = context_->Follower("XSearchTask::Load " + std::to_string(file_->id_));
 
+    // the client has given up, don't waste io and cache space on it
+    if (auto job = job_.lock()) {
+        if (job->Cancelled()) {
+            auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
+            FinishSearch(*search_job);
+            search_job->GetStatus() = CancelledStatus(*search_job);
+            index_engine_ = nullptr;
+            return;
+        }
+    }
+
     TimeRecorder rc("");
     Status stat = Status::OK();
     std::string error_msg;
     std::string type_str;
+    bool cache_hit = false;
 
     try {
         fiu_do_on("XSearchTask.Load.throw_std_exception", throw std::exception());
         if (type == LoadType::DISK2CPU) {
-            stat = index_engine_->Load();
+            if (context_->GetProfile() != nullptr) {
+                cache_hit = cache::CpuCacheMgr::GetInstance()->ItemExists(file_->location_);
+            }
+            stat = index_engine_->LoadForSearch();
             type_str = "DISK2CPU";
         } else if (type == LoadType::CPU2GPU) {
             bool hybrid = false;
@@ -172,7 +197,7 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
 
         if (auto job = job_.lock()) {
             auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
-            search_job->SearchDone(file_->id_);
+            FinishSearch(*search_job);
             search_job->GetStatus() = s;
         }
 
@@ -185,9 +210,11 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
                        " file type:" + std::to_string(file_->file_type_) + " size:" + std::to_string(file_size) +
                        " bytes from location: " + file_->location_ + " totally cost";
     double span = rc.ElapseFromBegin(info);
-    //    for (auto &context : search_contexts_) {
-    //        context->AccumLoadCost(span);
-    //    }
+    if (context_->GetProfile() != nullptr) {
+        int64_t bytes_read = (type == LoadType::DISK2CPU && !cache_hit) ? file_size : 0;
+        context_->GetProfile()->RecordFileLoad(std::to_string(file_->id_), file_->file_type_, file_->row_count_,
+                                               cache_hit, bytes_read, span);
+    }
 
     CollectFileMetrics(file_->file_type_, file_size);
 
@@ -222,12 +249,17 @@ XSearchTask::Execute() {
         // step 1: allocate memory
         uint64_t nq = search_job->nq();
         uint64_t topk = search_job->topk();
+        uint64_t search_k = search_job->search_k();
         const milvus::json& extra_params = search_job->extra_params();
         ENGINE_LOG_DEBUG << "Search job extra params: " << extra_params.dump();
         const engine::VectorsData& vectors = search_job->vectors();
 
-        output_ids.resize(topk * nq);
-        output_distance.resize(topk * nq);
+        // a slice searches its own range of the queries only
+        uint64_t query_begin = IsSlice() ? query_begin_ : 0;
+        uint64_t query_count = (IsSlice() ? query_end_ : nq) - query_begin;
+
+        output_ids.resize(search_k * query_count);
+        output_distance.resize(search_k * query_count);
         std::string hdr =
             "job " + std::to_string(search_job->id()) + " nq " + std::to_string(nq) + " topk " + std::to_string(topk);
 
@@ -241,13 +273,24 @@ XSearchTask::Execute() {
             }
             Status s;
             if (!vectors.float_data_.empty()) {
-                s = index_engine_->Search(nq, vectors.float_data_.data(), topk, extra_params, output_distance.data(),
-                                          output_ids.data(), hybrid);
+                size_t row_size = vectors.float_data_.size() / nq;
+                auto data = vectors.float_data_.data() + query_begin * row_size;
+                s = SearchInBlocks(*search_job, query_count, [&](uint64_t begin, uint64_t count) {
+                    return index_engine_->Search(count, data + begin * row_size, search_k, extra_params,
+                                                 output_distance.data() + begin * search_k,
+                                                 output_ids.data() + begin * search_k, hybrid);
+                });
             } else if (!vectors.binary_data_.empty()) {
-                s = index_engine_->Search(nq, vectors.binary_data_.data(), topk, extra_params, output_distance.data(),
-                                          output_ids.data(), hybrid);
+                size_t row_size = vectors.binary_data_.size() / nq;
+                auto data = vectors.binary_data_.data() + query_begin * row_size;
+                s = SearchInBlocks(*search_job, query_count, [&](uint64_t begin, uint64_t count) {
+                    return index_engine_->Search(count, data + begin * row_size, search_k, extra_params,
+                                                 output_distance.data() + begin * search_k,
+                                                 output_ids.data() + begin * search_k, hybrid);
+                });
             } else if (!vectors.id_array_.empty()) {
-                s = index_engine_->Search(nq, vectors.id_array_, topk, extra_params, output_distance.data(),
+                // ids missing from this file are skipped by the engine, so they are searched in one piece
+                s = index_engine_->Search(nq, vectors.id_array_, search_k, extra_params, output_distance.data(),
                                           output_ids.data(), hybrid);
             }
 
@@ -255,35 +298,57 @@ XSearchTask::Execute() {
 
             if (!s.ok()) {
                 search_job->GetStatus() = s;
-                search_job->SearchDone(index_id_);
+                FinishSearch(*search_job);
                 return;
             }
 
-            double span = rc.RecordSection(hdr + ", do search");
-            //            search_job->AccumSearchCost(span);
+            double search_span = rc.RecordSection(hdr + ", do search");
+
+            if (IsSlice() && !GatherSlice(query_begin * search_k, output_ids, output_distance)) {
+                // other slices are still searching, the last one gathered reduces the whole result
+                FinishSearch(*search_job);
+                index_engine_ = nullptr;
+                return;
+            }
 
             // step 3: pick up topk result
             auto spec_k = file_->row_count_ < topk ? file_->row_count_ : topk;
-            if (search_job->GetResultIds().front() == -1 && search_job->GetResultIds().size() > spec_k) {
-                // initialized results set
-                search_job->GetResultIds().resize(spec_k);
-                search_job->GetResultDistances().resize(spec_k);
+            auto& query_groups = search_job->query_groups();
+            if (query_groups != nullptr) {
+                // an id lives in one file only, so its candidates of all queries in the group are searched here
+                std::vector<int64_t> group_ids;
+                std::vector<float> group_distance;
+                XSearchTask::AggregateGroupsToResultSet(*query_groups, output_ids, output_distance, search_k, topk,
+                                                        ascending_reduce, group_ids, group_distance);
+                output_ids.swap(group_ids);
+                output_distance.swap(group_distance);
+                nq = query_groups->GroupCount();
             }
             {
                 std::unique_lock<std::mutex> lock(search_job->mutex());
+                auto& group = search_job->file_group(file_->id_);
+                auto& result_ids = search_job->GetResultIds(group);
+                auto& result_distances = search_job->GetResultDistances(group);
+                if (!result_ids.empty() && result_ids.front() == -1 && result_ids.size() > spec_k) {
+                    // initialized results set
+                    result_ids.resize(spec_k);
+                    result_distances.resize(spec_k);
+                }
                 XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, ascending_reduce,
-                                                  search_job->GetResultIds(), search_job->GetResultDistances());
+                                                  result_ids, result_distances);
             }
 
-            span = rc.RecordSection(hdr + ", reduce topk");
-            //            search_job->AccumReduceCost(span);
+            double reduce_span = rc.RecordSection(hdr + ", reduce topk");
+            if (context_->GetProfile() != nullptr) {
+                context_->GetProfile()->RecordFileSearch(std::to_string(index_id_), search_span, reduce_span);
+            }
         } catch (std::exception& ex) {
             ENGINE_LOG_ERROR << "SearchTask encounter exception: " << ex.what();
             //            search_job->IndexSearchDone(index_id_);//mark as done avoid dead lock, even search failed
         }
 
         // step 4: notify to send result to client
-        search_job->SearchDone(index_id_);
+        FinishSearch(*search_job);
     }
 
     rc.ElapseFromBegin("totally cost");
@@ -294,6 +359,107 @@ XSearchTask::Execute() {
     execute_ctx->GetTraceContext()->GetSpan()->Finish();
 }
 
+std::vector<TaskPtr>
+XSearchTask::SplitByQueries(const std::shared_ptr<XSearchTask>& task, uint64_t slice_count) {
+    auto search_job = std::static_pointer_cast<SearchJob>(task->job_.lock());
+    if (search_job == nullptr || slice_count <= 1 || search_job->nq() < slice_count) {
+        return {task};
+    }
+
+    uint64_t nq = search_job->nq();
+    auto slices = std::make_shared<SearchSlices>(slice_count, nq * search_job->search_k());
+    std::vector<TaskPtr> tasks;
+    for (uint64_t i = 0; i < slice_count; ++i) {
+        auto slice = std::make_shared<XSearchTask>(task->context_, task->file_, task->label());
+        slice->job_ = task->job_;
+        slice->query_begin_ = nq * i / slice_count;
+        slice->query_end_ = nq * (i + 1) / slice_count;
+        slice->slices_ = slices;
+        tasks.emplace_back(slice);
+    }
+
+    ENGINE_LOG_DEBUG << "Split search of job " << search_job->id() << " on file " << task->file_->id_ << " into "
+                     << slice_count << " slices";
+    return tasks;
+}
+
+uint64_t
+XSearchTask::QueuedSearches(const std::string& location) {
+    std::lock_guard<std::mutex> lock(queued_mutex);
+    auto iter = queued_searches.find(location);
+    return iter == queued_searches.end() ? 0 : iter->second;
+}
+
+void
+XSearchTask::MarkQueued() {
+    if (queued_ || file_ == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(queued_mutex);
+    ++queued_searches[file_->location_];
+    queued_ = true;
+}
+
+void
+XSearchTask::FinishSearch(SearchJob& search_job) {
+    if (queued_) {
+        std::lock_guard<std::mutex> lock(queued_mutex);
+        auto iter = queued_searches.find(file_->location_);
+        if (iter != queued_searches.end() && --iter->second == 0) {
+            queued_searches.erase(iter);
+        }
+        queued_ = false;
+    }
+
+    if (IsSlice()) {
+        std::lock_guard<std::mutex> lock(slices_->mutex);
+        if (slice_done_) {
+            return;
+        }
+        slice_done_ = true;
+        if (--slices_->pending > 0) {
+            return;
+        }
+    }
+    search_job.SearchDone(file_->id_);
+}
+
+bool
+XSearchTask::GatherSlice(uint64_t offset, ResultIds& ids, ResultDistances& distances) {
+    std::lock_guard<std::mutex> lock(slices_->mutex);
+    std::copy(ids.begin(), ids.end(), slices_->ids.begin() + offset);
+    std::copy(distances.begin(), distances.end(), slices_->distances.begin() + offset);
+    if (++slices_->gathered < slices_->count) {
+        return false;
+    }
+    ids.swap(slices_->ids);
+    distances.swap(slices_->distances);
+    return true;
+}
+
+Status
+XSearchTask::SearchInBlocks(const SearchJob& search_job, uint64_t nq,
+                            const std::function<Status(uint64_t begin, uint64_t count)>& search_block) {
+    for (uint64_t begin = 0; begin < nq; begin += SEARCH_QUERY_BLOCK_SIZE) {
+        if (search_job.Cancelled()) {
+            return CancelledStatus(search_job);
+        }
+        auto status = search_block(begin, std::min(SEARCH_QUERY_BLOCK_SIZE, nq - begin));
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
+Status
+XSearchTask::CancelledStatus(const SearchJob& search_job) {
+    if (search_job.Expired()) {
+        return Status(SERVER_DEADLINE_EXCEEDED, "Search deadline exceeded");
+    }
+    return Status(SERVER_REQUEST_CANCELLED, "Search cancelled by client");
+}
+
 void
 XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
                                   size_t src_k, size_t nq, size_t topk, bool ascending, scheduler::ResultIds& tar_ids,
@@ -361,6 +527,65 @@ XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const sch
     tar_distances.swap(buf_distances);
 }
 
+void
+XSearchTask::AggregateGroupsToResultSet(const engine::QueryGroups& groups, const scheduler::ResultIds& src_ids,
+                                        const scheduler::ResultDistances& src_distances, size_t src_k, size_t topk,
+                                        bool ascending, scheduler::ResultIds& tar_ids,
+                                        scheduler::ResultDistances& tar_distances) {
+    using Aggregation = engine::QueryGroups::Aggregation;
+    float padding = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    size_t group_count = groups.GroupCount();
+    tar_ids.assign(group_count * topk, -1);
+    tar_distances.assign(group_count * topk, padding);
+
+    for (size_t g = 0; g < group_count; ++g) {
+        // for sum and weighted, score = base + sum of (weight * (distance - worst)) over the queries which hit the id,
+        // base is the score of an id which no query hit
+        double base = 0;
+        std::unordered_map<int64_t, double> scores;
+        for (uint64_t q = groups.GroupBegin(g); q < groups.GroupBegin(g + 1); ++q) {
+            const int64_t* ids = src_ids.data() + q * src_k;
+            const float* distances = src_distances.data() + q * src_k;
+            size_t hits = std::find(ids, ids + src_k, -1) - ids;
+            if (hits == 0) {
+                continue;
+            }
+
+            float weight = groups.Weight(q);
+            float worst = distances[hits - 1];
+            base += weight * worst;
+            for (size_t i = 0; i < hits; ++i) {
+                if (groups.GetAggregation() != Aggregation::MAX) {
+                    scores[ids[i]] += weight * (distances[i] - worst);
+                    continue;
+                }
+                auto iter = scores.find(ids[i]);
+                if (iter == scores.end()) {
+                    scores.emplace(ids[i], distances[i]);
+                } else if (ascending ? distances[i] < iter->second : distances[i] > iter->second) {
+                    iter->second = distances[i];
+                }
+            }
+        }
+
+        std::vector<std::pair<int64_t, double>> ranking(scores.begin(), scores.end());
+        if (groups.GetAggregation() != Aggregation::MAX) {
+            for (auto& pair : ranking) {
+                pair.second += base;
+            }
+        }
+        size_t count = std::min(topk, ranking.size());
+        auto compare = [&](const std::pair<int64_t, double>& a, const std::pair<int64_t, double>& b) {
+            return ascending ? a.second < b.second : a.second > b.second;
+        };
+        std::partial_sort(ranking.begin(), ranking.begin() + count, ranking.end(), compare);
+        for (size_t i = 0; i < count; ++i) {
+            tar_ids[g * topk + i] = ranking[i].first;
+            tar_distances[g * topk + i] = static_cast<float>(ranking[i].second);
+        }
+    }
+}
+
 const std::string&
 XSearchTask::GetLocation() const {
     return file_->location_;
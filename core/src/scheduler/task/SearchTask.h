@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -22,6 +24,31 @@
 namespace milvus {
 namespace scheduler {
 
+// queries are searched in blocks of this size, cancellation of the job is checked between two blocks
+static constexpr uint64_t SEARCH_QUERY_BLOCK_SIZE = 512;
+
+// a segment file is hot once this many searches are queued on it, searches on a hot file run in the search pool of
+// the executor side by side, and are split by queries when they have enough queries
+static constexpr uint64_t HOT_SEGMENT_QUEUED_SEARCHES = 4;
+// a split search has at most this many slices, every slice has at least SEARCH_SLICE_MIN_NQ queries
+static constexpr uint64_t SEARCH_MAX_SLICES = 4;
+static constexpr uint64_t SEARCH_SLICE_MIN_NQ = 4;
+
+// the slices of a split search fill one result buffer, the last slice gathered reduces it into the job
+struct SearchSlices {
+    SearchSlices(uint64_t count, uint64_t size) : count(count), pending(count), ids(size, -1), distances(size, 0) {
+    }
+
+    std::mutex mutex;
+    uint64_t count;
+    uint64_t gathered = 0;
+    uint64_t pending;  // slices not done, the job is told when it drops to zero
+    ResultIds ids;
+    ResultDistances distances;
+};
+
+using SearchSlicesPtr = std::shared_ptr<SearchSlices>;
+
 // TODO(wxyu): rewrite
 class XSearchTask : public Task {
  public:
@@ -33,12 +60,59 @@ class XSearchTask : public Task {
     void
     Execute() override;
 
+    // split the queries into slices searched by separate tasks, so several executors share one segment file
+    static std::vector<TaskPtr>
+    SplitByQueries(const std::shared_ptr<XSearchTask>& task, uint64_t slice_count);
+
+    // searches queued on the segment file and not done yet
+    static uint64_t
+    QueuedSearches(const std::string& location);
+
+    // count the task in QueuedSearches() until it is done
+    void
+    MarkQueued();
+
+    bool
+    IsSlice() const {
+        return slices_ != nullptr;
+    }
+
+    // searched in the search pool of the executor, besides other searches on the same file
+    bool
+    IsHot() const {
+        return hot_ || IsSlice();
+    }
+
+ private:
+    // tell the job the file is searched, a slice does it only when all slices are done
+    void
+    FinishSearch(SearchJob& search_job);
+
+    // copy the slice result into the shared buffer, the last slice gets the whole result back and returns true
+    bool
+    GatherSlice(uint64_t offset, ResultIds& ids, ResultDistances& distances);
+
+    // search queries [0, nq) by blocks, stop with an error once the job is cancelled
+    static Status
+    SearchInBlocks(const SearchJob& search_job, uint64_t nq,
+                   const std::function<Status(uint64_t begin, uint64_t count)>& search_block);
+
+    static Status
+    CancelledStatus(const SearchJob& search_job);
+
  public:
     static void
     MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
                          size_t src_k, size_t nq, size_t topk, bool ascending, scheduler::ResultIds& tar_ids,
                          scheduler::ResultDistances& tar_distances);
 
+    // aggregate the src_k candidates of every query into one topk list per query group
+    static void
+    AggregateGroupsToResultSet(const engine::QueryGroups& groups, const scheduler::ResultIds& src_ids,
+                               const scheduler::ResultDistances& src_distances, size_t src_k, size_t topk,
+                               bool ascending, scheduler::ResultIds& tar_ids,
+                               scheduler::ResultDistances& tar_distances);
+
     //    static void
     //    MergeTopkArray(std::vector<int64_t>& tar_ids, std::vector<float>& tar_distance, uint64_t& tar_input_k,
     //                   const std::vector<int64_t>& src_ids, const std::vector<float>& src_distance, uint64_t
@@ -62,6 +136,17 @@ class XSearchTask : public Task {
     // distance -- value 0 means two vectors equal, ascending reduce, L2/HAMMING/JACCARD/TONIMOTO ...
     // similarity -- infinity value means two vectors equal, descending reduce, IP
     bool ascending_reduce = true;
+
+    // queries [query_begin_, query_end_) of the job when the task is a slice
+    uint64_t query_begin_ = 0;
+    uint64_t query_end_ = 0;
+    SearchSlicesPtr slices_ = nullptr;
+    // the segment file was hot when the task was created
+    bool hot_ = false;
+
+ private:
+    bool queued_ = false;
+    bool slice_done_ = false;
 };
 
 }  // namespace scheduler
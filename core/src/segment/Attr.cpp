@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/Attr.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace milvus {
+namespace segment {
+
+Attr::Attr(std::vector<uint8_t> data, const std::string& name, AttrType type)
+    : data_(std::move(data)), name_(name), type_(type) {
+}
+
+Attr::Attr(const std::string& name, AttrType type) : name_(name), type_(type) {
+}
+
+void
+Attr::Resize(size_t count) {
+    data_.resize(count * ATTR_VALUE_SIZE, 0);
+}
+
+void
+Attr::SetData(size_t offset, const uint8_t* data, size_t count) {
+    memcpy(data_.data() + offset * ATTR_VALUE_SIZE, data, count * ATTR_VALUE_SIZE);
+}
+
+const std::vector<uint8_t>&
+Attr::GetData() const {
+    return data_;
+}
+
+const std::string&
+Attr::GetName() const {
+    return name_;
+}
+
+AttrType
+Attr::GetType() const {
+    return type_;
+}
+
+size_t
+Attr::GetCount() const {
+    return data_.size() / ATTR_VALUE_SIZE;
+}
+
+int64_t
+Attr::GetInt64(size_t offset) const {
+    int64_t value;
+    memcpy(&value, data_.data() + offset * ATTR_VALUE_SIZE, ATTR_VALUE_SIZE);
+    return value;
+}
+
+double
+Attr::GetDouble(size_t offset) const {
+    double value;
+    memcpy(&value, data_.data() + offset * ATTR_VALUE_SIZE, ATTR_VALUE_SIZE);
+    return value;
+}
+
+void
+Attr::Erase(int32_t offset) {
+    if (offset < 0 || (size_t)offset >= GetCount()) {
+        return;
+    }
+    auto step = offset * ATTR_VALUE_SIZE;
+    data_.erase(data_.begin() + step, data_.begin() + step + ATTR_VALUE_SIZE);
+}
+
+void
+Attr::Erase(const std::vector<int32_t>& offsets) {
+    if (offsets.empty()) {
+        return;
+    }
+
+    size_t count = GetCount();
+    size_t kept = 0;
+    auto skip = offsets.cbegin();
+    for (size_t i = 0; i < count; ++i) {
+        if (skip != offsets.cend() && (size_t)*skip == i) {
+            ++skip;
+            continue;
+        }
+        if (kept != i) {
+            memcpy(data_.data() + kept * ATTR_VALUE_SIZE, data_.data() + i * ATTR_VALUE_SIZE, ATTR_VALUE_SIZE);
+        }
+        ++kept;
+    }
+    data_.resize(kept * ATTR_VALUE_SIZE);
+}
+
+size_t
+Attr::Size() {
+    return data_.size();
+}
+
+}  // namespace segment
+}  // namespace milvus
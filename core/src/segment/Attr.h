@@ -18,13 +18,65 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace milvus {
 namespace segment {
 
+enum class AttrType : int32_t {
+    INT64 = 1,
+    DOUBLE = 2,
+};
+
+// every attribute value takes 8 bytes, int64 or double
+constexpr size_t ATTR_VALUE_SIZE = 8;
+
+/*
+ * One numeric attribute column of a segment, the i-th value belongs to the i-th vector.
+ * Rows without a value hold 0.
+ */
 class Attr {
  public:
-    Attr(void* data, size_t nbytes);
+    Attr(std::vector<uint8_t> data, const std::string& name, AttrType type);
+
+    Attr(const std::string& name, AttrType type);
+
+    // pad with zero values or truncate to count values
+    void
+    Resize(size_t count);
+
+    // overwrite values from offset, the column must be large enough
+    void
+    SetData(size_t offset, const uint8_t* data, size_t count);
+
+    const std::vector<uint8_t>&
+    GetData() const;
+
+    const std::string&
+    GetName() const;
+
+    AttrType
+    GetType() const;
+
+    size_t
+    GetCount() const;
+
+    int64_t
+    GetInt64(size_t offset) const;
+
+    double
+    GetDouble(size_t offset) const;
+
+    void
+    Erase(int32_t offset);
+
+    // offsets must be sorted and unique
+    void
+    Erase(const std::vector<int32_t>& offsets);
+
+    size_t
+    Size();
 
     // No copy and move
     Attr(const Attr&) = delete;
@@ -36,8 +88,9 @@ class Attr {
     operator=(Attr&&) = delete;
 
  private:
-    void* data_;
-    size_t nbytes_;
+    std::vector<uint8_t> data_;
+    std::string name_;
+    AttrType type_;
 };
 
 using AttrPtr = std::shared_ptr<Attr>;
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/Attrs.h"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace milvus {
+namespace segment {
+
+namespace {
+
+template <typename T>
+void
+Append(std::vector<uint8_t>& blob, size_t& pos, const T& value) {
+    memcpy(blob.data() + pos, &value, sizeof(T));
+    pos += sizeof(T);
+}
+
+template <typename T>
+bool
+Fetch(const uint8_t* blob, size_t size, size_t& pos, T& value) {
+    if (pos + sizeof(T) > size) {
+        return false;
+    }
+    memcpy(&value, blob + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+}  // namespace
+
+size_t
+SerializedAttrsSize(const Attrs& attrs, size_t count) {
+    size_t size = sizeof(uint32_t);
+    for (auto& pair : attrs.attrs) {
+        size += sizeof(uint16_t) + pair.first.size() + sizeof(int32_t) + count * ATTR_VALUE_SIZE;
+    }
+    return size;
+}
+
+void
+SerializeAttrs(const Attrs& attrs, size_t offset, size_t count, std::vector<uint8_t>& blob) {
+    blob.resize(SerializedAttrsSize(attrs, count));
+    size_t pos = 0;
+    Append(blob, pos, (uint32_t)attrs.attrs.size());
+    for (auto& pair : attrs.attrs) {
+        auto& attr = pair.second;
+        Append(blob, pos, (uint16_t)pair.first.size());
+        memcpy(blob.data() + pos, pair.first.data(), pair.first.size());
+        pos += pair.first.size();
+        Append(blob, pos, (int32_t)attr->GetType());
+        memcpy(blob.data() + pos, attr->GetData().data() + offset * ATTR_VALUE_SIZE, count * ATTR_VALUE_SIZE);
+        pos += count * ATTR_VALUE_SIZE;
+    }
+}
+
+bool
+DeserializeAttrs(const uint8_t* blob, size_t size, size_t count, Attrs& attrs) {
+    size_t pos = 0;
+    uint32_t attr_num = 0;
+    if (!Fetch(blob, size, pos, attr_num)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < attr_num; ++i) {
+        uint16_t name_length = 0;
+        if (!Fetch(blob, size, pos, name_length) || pos + name_length > size) {
+            return false;
+        }
+        std::string name(reinterpret_cast<const char*>(blob + pos), name_length);
+        pos += name_length;
+
+        int32_t type = 0;
+        size_t nbytes = count * ATTR_VALUE_SIZE;
+        if (!Fetch(blob, size, pos, type) || pos + nbytes > size) {
+            return false;
+        }
+        std::vector<uint8_t> data(blob + pos, blob + pos + nbytes);
+        pos += nbytes;
+        attrs.attrs[name] = std::make_shared<Attr>(std::move(data), name, (AttrType)type);
+    }
+    return true;
+}
+
+}  // namespace segment
+}  // namespace milvus
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Attr.h"
 
@@ -29,5 +31,19 @@ struct Attrs {
     std::unordered_map<std::string, AttrPtr> attrs;
 };
 
+using AttrsPtr = std::shared_ptr<Attrs>;
+
+// Attributes of a row range are carried by wal records in the layout
+// | attr num (uint32) | per attr: name length (uint16) | name | type (int32) | count values |
+size_t
+SerializedAttrsSize(const Attrs& attrs, size_t count);
+
+void
+SerializeAttrs(const Attrs& attrs, size_t offset, size_t count, std::vector<uint8_t>& blob);
+
+// count is the row number of the blob, false if the blob is malformed
+bool
+DeserializeAttrs(const uint8_t* blob, size_t size, size_t count, Attrs& attrs);
+
 }  // namespace segment
 }  // namespace milvus
@@ -46,6 +46,7 @@ SegmentReader::Load() {
         directory_ptr_->Create();
         default_codec.GetVectorsFormat()->read(directory_ptr_, segment_ptr_->vectors_ptr_);
         default_codec.GetDeletedDocsFormat()->read(directory_ptr_, segment_ptr_->deleted_docs_ptr_);
+        default_codec.GetAttrsFormat()->read(directory_ptr_, segment_ptr_->attrs_ptr_);
     } catch (std::exception& e) {
         return Status(DB_ERROR, e.what());
     }
@@ -86,6 +87,21 @@ SegmentReader::GetSegment(SegmentPtr& segment_ptr) {
     return Status::OK();
 }
 
+Status
+SegmentReader::LoadAttrs(segment::AttrsPtr& attrs_ptr) {
+    codec::DefaultCodec default_codec;
+    try {
+        directory_ptr_->Create();
+        attrs_ptr = std::make_shared<Attrs>();
+        default_codec.GetAttrsFormat()->read(directory_ptr_, attrs_ptr);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to load attributes: " + std::string(e.what());
+        ENGINE_LOG_ERROR << err_msg;
+        return Status(DB_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentReader::LoadBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
     codec::DefaultCodec default_codec;
@@ -114,5 +130,19 @@ SegmentReader::LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr) {
     return Status::OK();
 }
 
+Status
+SegmentReader::LoadSummary(segment::SummaryPtr& summary_ptr) {
+    codec::DefaultCodec default_codec;
+    try {
+        directory_ptr_->Create();
+        default_codec.GetSummaryFormat()->read(directory_ptr_, summary_ptr);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to load summary: " + std::string(e.what());
+        ENGINE_LOG_ERROR << err_msg;
+        return Status(DB_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 }  // namespace segment
 }  // namespace milvus
@@ -45,12 +45,19 @@ class SegmentReader {
     Status
     LoadUids(std::vector<doc_id_t>& uids);
 
+    Status
+    LoadAttrs(segment::AttrsPtr& attrs_ptr);
+
     Status
     LoadBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr);
 
     Status
     LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr);
 
+    // summary_ptr is nullptr when the segment has no summary
+    Status
+    LoadSummary(segment::SummaryPtr& summary_ptr);
+
     Status
     GetSegment(SegmentPtr& segment_ptr);
 
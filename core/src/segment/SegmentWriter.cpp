@@ -41,6 +41,47 @@ SegmentWriter::AddVectors(const std::string& name, const std::vector<uint8_t>& d
     segment_ptr_->vectors_ptr_->AddUids(uids);
     segment_ptr_->vectors_ptr_->SetName(name);
 
+    // every attribute column keeps one value per vector
+    for (auto& pair : segment_ptr_->attrs_ptr_->attrs) {
+        pair.second->Resize(VectorCount());
+    }
+
+    return Status::OK();
+}
+
+Status
+SegmentWriter::AddAttrs(const Attrs& attrs, size_t offset, size_t count) {
+    size_t row_count = VectorCount();
+    if (count > row_count) {
+        return Status(DB_ERROR, "More attribute values than vectors");
+    }
+
+    for (auto& pair : attrs.attrs) {
+        auto& source = pair.second;
+        auto& target = segment_ptr_->attrs_ptr_->attrs[pair.first];
+        if (target == nullptr) {
+            target = std::make_shared<Attr>(pair.first, source->GetType());
+            target->Resize(row_count);
+        }
+
+        size_t begin = row_count - count;
+        size_t available = source->GetCount() > offset ? std::min(count, source->GetCount() - offset) : 0;
+        if (source->GetType() == target->GetType()) {
+            target->SetData(begin, source->GetData().data() + offset * ATTR_VALUE_SIZE, available);
+            continue;
+        }
+
+        for (size_t i = 0; i < available; ++i) {
+            if (target->GetType() == AttrType::INT64) {
+                auto value = (int64_t)source->GetDouble(offset + i);
+                target->SetData(begin + i, reinterpret_cast<const uint8_t*>(&value), 1);
+            } else {
+                auto value = (double)source->GetInt64(offset + i);
+                target->SetData(begin + i, reinterpret_cast<const uint8_t*>(&value), 1);
+            }
+        }
+    }
+
     return Status::OK();
 }
 
@@ -68,6 +109,23 @@ SegmentWriter::Serialize() {
     diff = end - start;
     ENGINE_LOG_DEBUG << "Writing vectors and uids took " << diff.count() << " s in total";
 
+    status = WriteSummary();
+    if (!status.ok()) {
+        return status;
+    }
+
+    start = std::chrono::high_resolution_clock::now();
+
+    status = WriteAttrs();
+    if (!status.ok()) {
+        return status;
+    }
+
+    end = std::chrono::high_resolution_clock::now();
+    diff = end - start;
+    ENGINE_LOG_DEBUG << "Writing " << segment_ptr_->attrs_ptr_->attrs.size() << " attributes took " << diff.count()
+                     << " s";
+
     start = std::chrono::high_resolution_clock::now();
 
     // Write an empty deleted doc
@@ -80,6 +138,41 @@ SegmentWriter::Serialize() {
     return status;
 }
 
+void
+SegmentWriter::EnableSummary(int64_t dimension) {
+    summary_dimension_ = dimension;
+}
+
+Status
+SegmentWriter::WriteSummary() {
+    if (summary_dimension_ <= 0) {
+        return Status::OK();
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // a summary is only a search hint, a segment without one is always searched
+    codec::DefaultCodec default_codec;
+    try {
+        auto& data = segment_ptr_->vectors_ptr_->GetData();
+        auto rows = (int64_t)(data.size() / (summary_dimension_ * sizeof(float)));
+        auto summary = Summary::Build(reinterpret_cast<const float*>(data.data()), rows, summary_dimension_);
+        if (summary != nullptr) {
+            directory_ptr_->Create();
+            default_codec.GetSummaryFormat()->write(directory_ptr_, summary);
+        }
+    } catch (std::exception& e) {
+        ENGINE_LOG_WARNING << "Failed to write summary of " << directory_ptr_->GetDirPath() << ": " << e.what();
+        return Status::OK();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> diff = end - start;
+    ENGINE_LOG_DEBUG << "Writing summary took " << diff.count() << " s";
+
+    return Status::OK();
+}
+
 Status
 SegmentWriter::WriteVectors() {
     codec::DefaultCodec default_codec;
@@ -94,6 +187,20 @@ SegmentWriter::WriteVectors() {
     return Status::OK();
 }
 
+Status
+SegmentWriter::WriteAttrs() {
+    codec::DefaultCodec default_codec;
+    try {
+        directory_ptr_->Create();
+        default_codec.GetAttrsFormat()->write(directory_ptr_, segment_ptr_->attrs_ptr_);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to write attributes: " + std::string(e.what());
+        ENGINE_LOG_ERROR << err_msg;
+        return Status(SERVER_WRITE_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentWriter::WriteBloomFilter() {
     codec::DefaultCodec default_codec;
@@ -223,11 +330,15 @@ SegmentWriter::Merge(const std::string& dir_to_merge, const std::string& name) {
 
         // Erase from raw data
         segment_to_merge->vectors_ptr_->Erase(offsets_to_delete);
+        for (auto& pair : segment_to_merge->attrs_ptr_->attrs) {
+            pair.second->Erase(offsets_to_delete);
+        }
     }
 
     start = std::chrono::high_resolution_clock::now();
 
     AddVectors(name, segment_to_merge->vectors_ptr_->GetData(), segment_to_merge->vectors_ptr_->GetUids());
+    AddAttrs(*segment_to_merge->attrs_ptr_, 0, segment_to_merge->vectors_ptr_->GetCount());
 
     end = std::chrono::high_resolution_clock::now();
     diff = end - start;
@@ -243,6 +354,9 @@ size_t
 SegmentWriter::Size() {
     // TODO(zhiru): switch to actual directory size
     size_t ret = segment_ptr_->vectors_ptr_->Size();
+    for (auto& pair : segment_ptr_->attrs_ptr_->attrs) {
+        ret += pair.second->Size();
+    }
     /*
     if (segment_ptr_->id_bloom_filter_ptr_) {
         ret += segment_ptr_->id_bloom_filter_ptr_->Size();
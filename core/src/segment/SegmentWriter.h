@@ -35,12 +35,21 @@ class SegmentWriter {
     Status
     AddVectors(const std::string& name, const std::vector<uint8_t>& data, const std::vector<doc_id_t>& uids);
 
+    // copy rows [offset, offset + count) of attrs to the last count vectors added, call after AddVectors.
+    // values are converted to the type of an existing column of the same name
+    Status
+    AddAttrs(const Attrs& attrs, size_t offset, size_t count);
+
     Status
     WriteBloomFilter(const IdBloomFilterPtr& bloom_filter_ptr);
 
     Status
     WriteDeletedDocs(const DeletedDocsPtr& deleted_docs);
 
+    // vectors are float vectors of dimension floats, Serialize() then writes a summary of them
+    void
+    EnableSummary(int64_t dimension);
+
     Status
     Serialize();
 
@@ -63,15 +72,22 @@ class SegmentWriter {
     Status
     WriteVectors();
 
+    Status
+    WriteAttrs();
+
     Status
     WriteBloomFilter();
 
     Status
     WriteDeletedDocs();
 
+    Status
+    WriteSummary();
+
  private:
     store::DirectoryPtr directory_ptr_;
     SegmentPtr segment_ptr_;
+    int64_t summary_dimension_ = 0;
 };
 
 using SegmentWriterPtr = std::shared_ptr<SegmentWriter>;
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "segment/Summary.h"
+
+#include <faiss/Clustering.h>
+#include <faiss/IndexFlat.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace milvus {
+namespace segment {
+
+Summary::Summary(int64_t dimension, std::vector<float> centroids, std::vector<float> radius)
+    : dimension_(dimension), centroids_(std::move(centroids)), radius_(std::move(radius)) {
+}
+
+SummaryPtr
+Summary::Build(const float* data, int64_t rows, int64_t dimension) {
+    if (rows <= 0 || dimension <= 0) {
+        return nullptr;
+    }
+
+    // small segments take every vector as a centroid, clustering copies them in that case
+    int64_t count = std::min(rows, SUMMARY_CENTROIDS);
+    faiss::Clustering clustering(dimension, count);
+    clustering.verbose = false;
+    clustering.min_points_per_centroid = 1;
+    faiss::IndexFlatL2 index(dimension);
+    clustering.train(rows, data, index);
+
+    std::vector<float> distances(rows);
+    std::vector<faiss::Index::idx_t> labels(rows);
+    index.search(rows, data, 1, distances.data(), labels.data());
+
+    std::vector<float> radius(count, 0.0f);
+    for (int64_t i = 0; i < rows; ++i) {
+        if (labels[i] >= 0 && labels[i] < count) {
+            radius[labels[i]] = std::max(radius[labels[i]], distances[i]);
+        }
+    }
+    for (auto& r : radius) {
+        r = std::sqrt(r);
+    }
+
+    return std::make_shared<Summary>(dimension, std::move(clustering.centroids), std::move(radius));
+}
+
+int64_t
+Summary::GetDimension() const {
+    return dimension_;
+}
+
+int64_t
+Summary::GetCount() const {
+    return radius_.size();
+}
+
+const std::vector<float>&
+Summary::GetCentroids() const {
+    return centroids_;
+}
+
+const std::vector<float>&
+Summary::GetRadius() const {
+    return radius_;
+}
+
+float
+Summary::MinL2Distance(const float* query) const {
+    float result = std::numeric_limits<float>::max();
+    for (int64_t i = 0; i < GetCount(); ++i) {
+        const float* centroid = centroids_.data() + i * dimension_;
+        float distance = 0;
+        for (int64_t j = 0; j < dimension_; ++j) {
+            float diff = query[j] - centroid[j];
+            distance += diff * diff;
+        }
+        result = std::min(result, std::max(0.0f, std::sqrt(distance) - radius_[i]));
+    }
+    return result;
+}
+
+float
+Summary::MaxInnerProduct(const float* query) const {
+    float norm = 0;
+    for (int64_t j = 0; j < dimension_; ++j) {
+        norm += query[j] * query[j];
+    }
+    norm = std::sqrt(norm);
+
+    float result = std::numeric_limits<float>::lowest();
+    for (int64_t i = 0; i < GetCount(); ++i) {
+        const float* centroid = centroids_.data() + i * dimension_;
+        float product = 0;
+        for (int64_t j = 0; j < dimension_; ++j) {
+            product += query[j] * centroid[j];
+        }
+        result = std::max(result, product + norm * radius_[i]);
+    }
+    return result;
+}
+
+size_t
+Summary::Size() const {
+    return (centroids_.size() + radius_.size()) * sizeof(float);
+}
+
+}  // namespace segment
+}  // namespace milvus
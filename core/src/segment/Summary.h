@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace milvus {
+namespace segment {
+
+// number of k-means centroids kept per segment
+constexpr int64_t SUMMARY_CENTROIDS = 8;
+
+class Summary;
+using SummaryPtr = std::shared_ptr<Summary>;
+
+/*
+ * A few k-means centroids of the float vectors of a segment, each with the radius of its cluster.
+ * Every vector of the segment lies within the radius of its centroid, which bounds the distance
+ * between a query and any vector of the segment without reading the segment.
+ */
+class Summary {
+ public:
+    Summary(int64_t dimension, std::vector<float> centroids, std::vector<float> radius);
+
+    // cluster rows vectors of dimension floats each, nullptr if there are no vectors
+    static SummaryPtr
+    Build(const float* data, int64_t rows, int64_t dimension);
+
+    int64_t
+    GetDimension() const;
+
+    int64_t
+    GetCount() const;
+
+    const std::vector<float>&
+    GetCentroids() const;
+
+    const std::vector<float>&
+    GetRadius() const;
+
+    // lower bound of the L2 distance (not squared) between query and any vector of the segment
+    float
+    MinL2Distance(const float* query) const;
+
+    // upper bound of the inner product between query and any vector of the segment
+    float
+    MaxInnerProduct(const float* query) const;
+
+    size_t
+    Size() const;
+
+ private:
+    int64_t dimension_;
+    std::vector<float> centroids_;  // count * dimension
+    std::vector<float> radius_;     // count
+};
+
+}  // namespace segment
+}  // namespace milvus
@@ -19,8 +19,10 @@
 
 #include <memory>
 
+#include "segment/Attrs.h"
 #include "segment/DeletedDocs.h"
 #include "segment/IdBloomFilter.h"
+#include "segment/Summary.h"
 #include "segment/Vectors.h"
 
 namespace milvus {
@@ -30,6 +32,7 @@ typedef int64_t doc_id_t;
 
 struct Segment {
     VectorsPtr vectors_ptr_ = std::make_shared<Vectors>();
+    AttrsPtr attrs_ptr_ = std::make_shared<Attrs>();
     DeletedDocsPtr deleted_docs_ptr_ = nullptr;
     IdBloomFilterPtr id_bloom_filter_ptr_ = nullptr;
 };
@@ -48,6 +48,16 @@ static const char* CONFIG_SERVER_TIME_ZONE = "time_zone";
 static const char* CONFIG_SERVER_TIME_ZONE_DEFAULT = "UTC+8";
 static const char* CONFIG_SERVER_WEB_PORT = "web_port";
 static const char* CONFIG_SERVER_WEB_PORT_DEFAULT = "19121";
+static const char* CONFIG_SERVER_DQL_QUEUE_LIMIT = "dql_queue_limit";
+static const char* CONFIG_SERVER_DQL_QUEUE_LIMIT_DEFAULT = "32";
+static const char* CONFIG_SERVER_DQL_CONCURRENCY = "dql_concurrency";
+static const char* CONFIG_SERVER_DQL_CONCURRENCY_DEFAULT = "1";
+static const char* CONFIG_SERVER_DDL_DML_QUEUE_LIMIT = "ddl_dml_queue_limit";
+static const char* CONFIG_SERVER_DDL_DML_QUEUE_LIMIT_DEFAULT = "32";
+static const char* CONFIG_SERVER_INFO_QUEUE_LIMIT = "info_queue_limit";
+static const char* CONFIG_SERVER_INFO_QUEUE_LIMIT_DEFAULT = "32";
+static const char* CONFIG_SERVER_INFO_CONCURRENCY = "info_concurrency";
+static const char* CONFIG_SERVER_INFO_CONCURRENCY_DEFAULT = "1";
 
 /* db config */
 static const char* CONFIG_DB = "db_config";
@@ -80,6 +90,14 @@ static const char* CONFIG_STORAGE_S3_SECRET_KEY = "s3_secret_key";
 static const char* CONFIG_STORAGE_S3_SECRET_KEY_DEFAULT = "minioadmin";
 static const char* CONFIG_STORAGE_S3_BUCKET = "s3_bucket";
 static const char* CONFIG_STORAGE_S3_BUCKET_DEFAULT = "milvus-bucket";
+static const char* CONFIG_STORAGE_S3_CACHE_PATH = "s3_cache_path";
+static const char* CONFIG_STORAGE_S3_CACHE_PATH_DEFAULT = "";
+static const char* CONFIG_STORAGE_S3_CACHE_CAPACITY = "s3_cache_capacity";
+static const char* CONFIG_STORAGE_S3_CACHE_CAPACITY_DEFAULT = "16";
+static const char* CONFIG_STORAGE_FILE_IO_MODE = "file_io_mode";
+static const char* CONFIG_STORAGE_FILE_IO_MODE_BUFFERED = "buffered";
+static const char* CONFIG_STORAGE_FILE_IO_MODE_DIRECT = "direct";
+static const char* CONFIG_STORAGE_FILE_IO_MODE_DEFAULT = CONFIG_STORAGE_FILE_IO_MODE_BUFFERED;
 
 /* cache config */
 static const char* CONFIG_CACHE = "cache_config";
@@ -91,6 +109,8 @@ static const char* CONFIG_CACHE_INSERT_BUFFER_SIZE = "insert_buffer_size";
 static const char* CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT = "1";
 static const char* CONFIG_CACHE_CACHE_INSERT_DATA = "cache_insert_data";
 static const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT = "false";
+static const char* CONFIG_CACHE_CPU_CACHE_NUMA_AWARE = "cpu_cache_numa_aware";
+static const char* CONFIG_CACHE_CPU_CACHE_NUMA_AWARE_DEFAULT = "false";
 
 /* metric config */
 static const char* CONFIG_METRIC = "metric_config";
@@ -109,6 +129,12 @@ static const char* CONFIG_ENGINE_OMP_THREAD_NUM = "omp_thread_num";
 static const char* CONFIG_ENGINE_OMP_THREAD_NUM_DEFAULT = "0";
 static const char* CONFIG_ENGINE_USE_AVX512 = "use_avx512";
 static const char* CONFIG_ENGINE_USE_AVX512_DEFAULT = "true";
+static const char* CONFIG_ENGINE_BUILD_CONCURRENCY = "build_concurrency";
+static const char* CONFIG_ENGINE_BUILD_CONCURRENCY_DEFAULT = "4";
+static const char* CONFIG_ENGINE_BUILD_MEMORY_BUDGET = "build_memory_budget";
+static const char* CONFIG_ENGINE_BUILD_MEMORY_BUDGET_DEFAULT = "4";
+static const char* CONFIG_ENGINE_TRAIN_POINTS_PER_CENTROID = "train_points_per_centroid";
+static const char* CONFIG_ENGINE_TRAIN_POINTS_PER_CENTROID_DEFAULT = "256";
 static const char* CONFIG_ENGINE_GPU_SEARCH_THRESHOLD = "gpu_search_threshold";
 static const char* CONFIG_ENGINE_GPU_SEARCH_THRESHOLD_DEFAULT = "1000";
 
@@ -209,6 +235,16 @@ class Config {
     CheckServerConfigTimeZone(const std::string& value);
     Status
     CheckServerConfigWebPort(const std::string& value);
+    Status
+    CheckServerConfigDqlQueueLimit(const std::string& value);
+    Status
+    CheckServerConfigDqlConcurrency(const std::string& value);
+    Status
+    CheckServerConfigDdlDmlQueueLimit(const std::string& value);
+    Status
+    CheckServerConfigInfoQueueLimit(const std::string& value);
+    Status
+    CheckServerConfigInfoConcurrency(const std::string& value);
 
     /* db config */
     Status
@@ -239,6 +275,12 @@ class Config {
     CheckStorageConfigS3SecretKey(const std::string& value);
     Status
     CheckStorageConfigS3Bucket(const std::string& value);
+    Status
+    CheckStorageConfigS3CachePath(const std::string& value);
+    Status
+    CheckStorageConfigS3CacheCapacity(const std::string& value);
+    Status
+    CheckStorageConfigFileIOMode(const std::string& value);
 
     /* metric config */
     Status
@@ -257,6 +299,8 @@ class Config {
     CheckCacheConfigInsertBufferSize(const std::string& value);
     Status
     CheckCacheConfigCacheInsertData(const std::string& value);
+    Status
+    CheckCacheConfigCpuCacheNumaAware(const std::string& value);
 
     /* engine config */
     Status
@@ -265,6 +309,12 @@ class Config {
     CheckEngineConfigOmpThreadNum(const std::string& value);
     Status
     CheckEngineConfigUseAVX512(const std::string& value);
+    Status
+    CheckEngineConfigBuildConcurrency(const std::string& value);
+    Status
+    CheckEngineConfigBuildMemoryBudget(const std::string& value);
+    Status
+    CheckEngineConfigTrainPointsPerCentroid(const std::string& value);
 
 #ifdef MILVUS_GPU_VERSION
     Status
@@ -320,6 +370,16 @@ class Config {
     GetServerConfigTimeZone(std::string& value);
     Status
     GetServerConfigWebPort(std::string& value);
+    Status
+    GetServerConfigDqlQueueLimit(int64_t& value);
+    Status
+    GetServerConfigDqlConcurrency(int64_t& value);
+    Status
+    GetServerConfigDdlDmlQueueLimit(int64_t& value);
+    Status
+    GetServerConfigInfoQueueLimit(int64_t& value);
+    Status
+    GetServerConfigInfoConcurrency(int64_t& value);
 
     /* db config */
     Status
@@ -350,6 +410,12 @@ class Config {
     GetStorageConfigS3SecretKey(std::string& value);
     Status
     GetStorageConfigS3Bucket(std::string& value);
+    Status
+    GetStorageConfigS3CachePath(std::string& value);
+    Status
+    GetStorageConfigS3CacheCapacity(int64_t& value);
+    Status
+    GetStorageConfigFileIOMode(std::string& value);
 
     /* metric config */
     Status
@@ -368,6 +434,8 @@ class Config {
     GetCacheConfigInsertBufferSize(int64_t& value);
     Status
     GetCacheConfigCacheInsertData(bool& value);
+    Status
+    GetCacheConfigCpuCacheNumaAware(bool& value);
 
     /* engine config */
     Status
@@ -376,6 +444,12 @@ class Config {
     GetEngineConfigOmpThreadNum(int64_t& value);
     Status
     GetEngineConfigUseAVX512(bool& value);
+    Status
+    GetEngineConfigBuildConcurrency(int64_t& value);
+    Status
+    GetEngineConfigBuildMemoryBudget(int64_t& value);
+    Status
+    GetEngineConfigTrainPointsPerCentroid(int64_t& value);
 
 #ifdef MILVUS_GPU_VERSION
     Status
@@ -423,6 +497,16 @@ class Config {
     SetServerConfigTimeZone(const std::string& value);
     Status
     SetServerConfigWebPort(const std::string& value);
+    Status
+    SetServerConfigDqlQueueLimit(const std::string& value);
+    Status
+    SetServerConfigDqlConcurrency(const std::string& value);
+    Status
+    SetServerConfigDdlDmlQueueLimit(const std::string& value);
+    Status
+    SetServerConfigInfoQueueLimit(const std::string& value);
+    Status
+    SetServerConfigInfoConcurrency(const std::string& value);
 
     /* db config */
     Status
@@ -453,6 +537,12 @@ class Config {
     SetStorageConfigS3SecretKey(const std::string& value);
     Status
     SetStorageConfigS3Bucket(const std::string& value);
+    Status
+    SetStorageConfigS3CachePath(const std::string& value);
+    Status
+    SetStorageConfigS3CacheCapacity(const std::string& value);
+    Status
+    SetStorageConfigFileIOMode(const std::string& value);
 
     /* metric config */
     Status
@@ -471,6 +561,8 @@ class Config {
     SetCacheConfigInsertBufferSize(const std::string& value);
     Status
     SetCacheConfigCacheInsertData(const std::string& value);
+    Status
+    SetCacheConfigCpuCacheNumaAware(const std::string& value);
 
     /* engine config */
     Status
@@ -479,6 +571,12 @@ class Config {
     SetEngineConfigOmpThreadNum(const std::string& value);
     Status
     SetEngineConfigUseAVX512(const std::string& value);
+    Status
+    SetEngineConfigBuildConcurrency(const std::string& value);
+    Status
+    SetEngineConfigBuildMemoryBudget(const std::string& value);
+    Status
+    SetEngineConfigTrainPointsPerCentroid(const std::string& value);
 
     /* tracing config */
     Status
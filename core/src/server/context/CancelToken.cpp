@@ -0,0 +1,44 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/context/CancelToken.h"
+
+#include <utility>
+
+namespace milvus {
+namespace server {
+
+void
+CancelToken::Cancel() {
+    cancelled_ = true;
+}
+
+bool
+CancelToken::IsCancelled() const {
+    if (cancelled_) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (source_ != nullptr && source_()) {
+        cancelled_ = true;
+    }
+    return cancelled_;
+}
+
+void
+CancelToken::SetSource(std::function<bool()> source) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    source_ = std::move(source);
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,48 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace milvus {
+namespace server {
+
+/*
+ * Cancellation state of a request, shared by its context and all child contexts.
+ * The source is polled lazily, typically grpc::ServerContext::IsCancelled, so the request is seen as cancelled
+ * as soon as the client disconnects or its deadline passes. The result is sticky once cancelled.
+ */
+class CancelToken {
+ public:
+    void
+    Cancel();
+
+    bool
+    IsCancelled() const;
+
+    // nullptr to stop polling, must be reset before the source is destroyed
+    void
+    SetSource(std::function<bool()> source);
+
+ private:
+    mutable std::atomic<bool> cancelled_{false};
+    mutable std::mutex mutex_;
+    std::function<bool()> source_;
+};
+
+using CancelTokenPtr = std::shared_ptr<CancelToken>;
+
+}  // namespace server
+}  // namespace milvus
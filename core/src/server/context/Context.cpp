@@ -26,10 +26,49 @@ void
 Context::SetTraceContext(const std::shared_ptr<tracing::TraceContext>& trace_context) {
     trace_context_ = trace_context;
 }
+
+const QueryProfilePtr&
+Context::GetProfile() const {
+    return profile_;
+}
+
+void
+Context::SetProfile(const QueryProfilePtr& profile) {
+    profile_ = profile;
+}
+
+void
+Context::SetDeadline(const std::chrono::system_clock::time_point& deadline) {
+    deadline_ = deadline;
+}
+
+const std::chrono::system_clock::time_point&
+Context::GetDeadline() const {
+    return deadline_;
+}
+
+void
+Context::SetCancelToken(const CancelTokenPtr& cancel_token) {
+    cancel_token_ = cancel_token;
+}
+
+const CancelTokenPtr&
+Context::GetCancelToken() const {
+    return cancel_token_;
+}
+
+bool
+Context::IsCancelled() const {
+    return cancel_token_->IsCancelled();
+}
+
 std::shared_ptr<Context>
 Context::Child(const std::string& operation_name) const {
     auto new_context = std::make_shared<Context>(request_id_);
     new_context->SetTraceContext(trace_context_->Child(operation_name));
+    new_context->SetProfile(profile_);
+    new_context->SetDeadline(deadline_);
+    new_context->SetCancelToken(cancel_token_);
     return new_context;
 }
 
@@ -37,6 +76,9 @@ std::shared_ptr<Context>
 Context::Follower(const std::string& operation_name) const {
     auto new_context = std::make_shared<Context>(request_id_);
     new_context->SetTraceContext(trace_context_->Follower(operation_name));
+    new_context->SetProfile(profile_);
+    new_context->SetDeadline(deadline_);
+    new_context->SetCancelToken(cancel_token_);
     return new_context;
 }
 
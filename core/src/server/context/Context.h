@@ -11,10 +11,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
 
+#include "server/context/CancelToken.h"
+#include "server/context/QueryProfile.h"
 #include "tracing/TraceContext.h"
 
 namespace milvus {
@@ -36,9 +39,35 @@ class Context {
     const std::shared_ptr<tracing::TraceContext>&
     GetTraceContext() const;
 
+    void
+    SetProfile(const QueryProfilePtr& profile);
+
+    const QueryProfilePtr&
+    GetProfile() const;
+
+    // deadline of the grpc call, time_point::max() if the client didn't set one
+    void
+    SetDeadline(const std::chrono::system_clock::time_point& deadline);
+
+    const std::chrono::system_clock::time_point&
+    GetDeadline() const;
+
+    // child contexts share the token of their parent
+    void
+    SetCancelToken(const CancelTokenPtr& cancel_token);
+
+    const CancelTokenPtr&
+    GetCancelToken() const;
+
+    bool
+    IsCancelled() const;
+
  private:
     std::string request_id_;
     std::shared_ptr<tracing::TraceContext> trace_context_;
+    QueryProfilePtr profile_;
+    std::chrono::system_clock::time_point deadline_ = std::chrono::system_clock::time_point::max();
+    CancelTokenPtr cancel_token_ = std::make_shared<CancelToken>();
 };
 
 }  // namespace server
@@ -0,0 +1,112 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/context/QueryProfile.h"
+
+namespace milvus {
+namespace server {
+
+namespace {
+
+constexpr double US_PER_MS = 1000.0;
+
+}  // namespace
+
+void
+QueryProfile::RecordStage(const std::string& stage, double cost_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& pair : stages_) {
+        if (pair.first == stage) {
+            pair.second += cost_us;
+            return;
+        }
+    }
+    stages_.emplace_back(stage, cost_us);
+}
+
+void
+QueryProfile::RecordFileLoad(const std::string& file_id, int32_t file_type, int64_t row_count, bool cache_hit,
+                             int64_t bytes_read, double cost_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    FileProfile& file = GetFile(file_id);
+    file.file_type_ = file_type;
+    file.row_count_ = row_count;
+    file.cache_hit_ = cache_hit;
+    file.bytes_read_ += bytes_read;
+    file.load_cost_ += cost_us;
+}
+
+void
+QueryProfile::RecordFileSearch(const std::string& file_id, double search_cost_us, double reduce_cost_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    FileProfile& file = GetFile(file_id);
+    file.search_cost_ += search_cost_us;
+    file.reduce_cost_ += reduce_cost_us;
+}
+
+QueryProfile::FileProfile&
+QueryProfile::GetFile(const std::string& file_id) {
+    FileProfile& file = files_[file_id];
+    file.file_id_ = file_id;
+    return file;
+}
+
+milvus::json
+QueryProfile::Dump() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    milvus::json stages = milvus::json::object();
+    for (auto& pair : stages_) {
+        stages[pair.first] = pair.second / US_PER_MS;
+    }
+
+    int64_t total_bytes = 0;
+    int64_t cache_hit = 0;
+    double total_load = 0.0, total_search = 0.0, total_reduce = 0.0;
+    milvus::json files = milvus::json::array();
+    for (auto& pair : files_) {
+        const FileProfile& file = pair.second;
+        milvus::json file_json;
+        file_json["file_id"] = file.file_id_;
+        file_json["file_type"] = file.file_type_;
+        file_json["row_count"] = file.row_count_;
+        file_json["cache_hit"] = file.cache_hit_;
+        file_json["bytes_read"] = file.bytes_read_;
+        file_json["load_ms"] = file.load_cost_ / US_PER_MS;
+        file_json["search_ms"] = file.search_cost_ / US_PER_MS;
+        file_json["reduce_ms"] = file.reduce_cost_ / US_PER_MS;
+        files.push_back(file_json);
+
+        total_bytes += file.bytes_read_;
+        cache_hit += file.cache_hit_ ? 1 : 0;
+        total_load += file.load_cost_;
+        total_search += file.search_cost_;
+        total_reduce += file.reduce_cost_;
+    }
+
+    milvus::json summary;
+    summary["file_count"] = files_.size();
+    summary["cache_hit"] = cache_hit;
+    summary["cache_miss"] = static_cast<int64_t>(files_.size()) - cache_hit;
+    summary["bytes_read"] = total_bytes;
+    summary["load_ms"] = total_load / US_PER_MS;
+    summary["search_ms"] = total_search / US_PER_MS;
+    summary["reduce_ms"] = total_reduce / US_PER_MS;
+
+    milvus::json profile;
+    profile["stages"] = stages;
+    profile["summary"] = summary;
+    profile["files"] = files;
+    return profile;
+}
+
+}  // namespace server
+}  // namespace milvus
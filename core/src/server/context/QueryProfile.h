@@ -0,0 +1,80 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utils/Json.h"
+
+namespace milvus {
+namespace server {
+
+// key in search extra_params (request) and in result extra_params (response)
+static const char* QUERY_PROFILE_KEY = "profile";
+
+static const char* QUERY_STAGE_QUEUE = "queue";
+static const char* QUERY_STAGE_VALIDATE = "validate";
+static const char* QUERY_STAGE_META = "meta";
+static const char* QUERY_STAGE_FETCH_VECTOR = "fetch_vector";
+static const char* QUERY_STAGE_JOB = "search_job";
+static const char* QUERY_STAGE_ENGINE = "engine";
+static const char* QUERY_STAGE_SERIALIZE = "serialize";
+
+/*
+ * Per-query execution breakdown, collected only when the client asks for it.
+ * All costs are recorded in microseconds (as returned by TimeRecorder) and dumped in milliseconds.
+ * Search tasks of one query run on different executors, so every method is thread-safe.
+ */
+class QueryProfile {
+ public:
+    struct FileProfile {
+        std::string file_id_;
+        int32_t file_type_ = 0;
+        int64_t row_count_ = 0;
+        bool cache_hit_ = false;
+        int64_t bytes_read_ = 0;
+        double load_cost_ = 0.0;
+        double search_cost_ = 0.0;
+        double reduce_cost_ = 0.0;
+    };
+
+    void
+    RecordStage(const std::string& stage, double cost_us);
+
+    void
+    RecordFileLoad(const std::string& file_id, int32_t file_type, int64_t row_count, bool cache_hit,
+                   int64_t bytes_read, double cost_us);
+
+    void
+    RecordFileSearch(const std::string& file_id, double search_cost_us, double reduce_cost_us);
+
+    milvus::json
+    Dump() const;
+
+ private:
+    FileProfile&
+    GetFile(const std::string& file_id);
+
+ private:
+    mutable std::mutex mutex_;
+    std::vector<std::pair<std::string, double>> stages_;
+    std::map<std::string, FileProfile> files_;
+};
+
+using QueryProfilePtr = std::shared_ptr<QueryProfile>;
+
+}  // namespace server
+}  // namespace milvus
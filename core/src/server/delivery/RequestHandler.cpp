@@ -35,6 +35,7 @@
 #include "server/delivery/request/PreloadTableRequest.h"
 #include "server/delivery/request/SearchByIDRequest.h"
 #include "server/delivery/request/SearchRequest.h"
+#include "server/delivery/request/SearchTablesRequest.h"
 #include "server/delivery/request/ShowPartitionsRequest.h"
 #include "server/delivery/request/ShowTableInfoRequest.h"
 #include "server/delivery/request/ShowTablesRequest.h"
@@ -133,6 +134,17 @@ RequestHandler::Search(const std::shared_ptr<Context>& context, const std::strin
     return request_ptr->status();
 }
 
+Status
+RequestHandler::SearchTables(const std::shared_ptr<Context>& context, const std::vector<std::string>& table_names,
+                             const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+                             const std::vector<std::string>& partition_list, std::vector<TopKQueryResult>& results) {
+    BaseRequestPtr request_ptr =
+        SearchTablesRequest::Create(context, table_names, vectors, topk, extra_params, partition_list, results);
+    RequestScheduler::ExecRequest(request_ptr);
+
+    return request_ptr->status();
+}
+
 Status
 RequestHandler::SearchByID(const std::shared_ptr<Context>& context, const std::string& table_name, int64_t vector_id,
                            int64_t topk, const milvus::json& extra_params,
@@ -63,6 +63,11 @@ class RequestHandler {
            int64_t topk, const milvus::json& extra_params, const std::vector<std::string>& partition_list,
            const std::vector<std::string>& file_id_list, TopKQueryResult& result);
 
+    Status
+    SearchTables(const std::shared_ptr<Context>& context, const std::vector<std::string>& table_names,
+                 const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+                 const std::vector<std::string>& partition_list, std::vector<TopKQueryResult>& results);
+
     Status
     SearchByID(const std::shared_ptr<Context>& context, const std::string& table_name, int64_t vector_id, int64_t topk,
                const milvus::json& extra_params, const std::vector<std::string>& partition_list,
@@ -10,10 +10,14 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "server/delivery/RequestScheduler.h"
+#include "metrics/Metrics.h"
+#include "server/Config.h"
 #include "utils/Log.h"
 
 #include <fiu-local.h>
 #include <unistd.h>
+#include <algorithm>
+#include <chrono>
 #include <utility>
 
 namespace milvus {
@@ -61,8 +65,10 @@ RequestScheduler::Stop() {
     {
         std::lock_guard<std::mutex> lock(queue_mtx_);
         for (auto& iter : request_groups_) {
-            if (iter.second != nullptr) {
-                iter.second->Put(nullptr);
+            if (iter.second.queue_ != nullptr) {
+                for (int64_t i = 0; i < iter.second.concurrency_; ++i) {
+                    iter.second.queue_->Put(nullptr);
+                }
             }
         }
     }
@@ -99,7 +105,7 @@ RequestScheduler::ExecuteRequest(const BaseRequestPtr& request_ptr) {
 }
 
 void
-RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
+RequestScheduler::TakeToExecute(std::string group_name, RequestQueuePtr request_queue) {
     if (request_queue == nullptr) {
         return;
     }
@@ -111,6 +117,7 @@ RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
             break;  // stop the thread
         }
 
+        auto begin = std::chrono::steady_clock::now();
         try {
             fiu_do_on("RequestScheduler.TakeToExecute.throw_std_exception1", throw std::exception());
             auto status = request->Execute();
@@ -122,6 +129,22 @@ RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
         } catch (std::exception& ex) {
             SERVER_LOG_ERROR << "Request failed to execute: " << ex.what();
         }
+        auto execute_time = std::chrono::steady_clock::now() - begin;
+        RequestFinished(request, group_name, std::chrono::duration<double, std::micro>(execute_time).count());
+    }
+}
+
+void
+RequestScheduler::GetGroupLimits(const std::string& group_name, RequestGroup& group) {
+    Config& config = Config::GetInstance();
+    if (group_name == DQL_REQUEST_GROUP) {
+        config.GetServerConfigDqlQueueLimit(group.queue_limit_);
+        config.GetServerConfigDqlConcurrency(group.concurrency_);
+    } else if (group_name == DDL_DML_REQUEST_GROUP) {
+        config.GetServerConfigDdlDmlQueueLimit(group.queue_limit_);
+    } else if (group_name == INFO_REQUEST_GROUP) {
+        config.GetServerConfigInfoQueueLimit(group.queue_limit_);
+        config.GetServerConfigInfoConcurrency(group.concurrency_);
     }
 }
 
@@ -130,24 +153,94 @@ RequestScheduler::PutToQueue(const BaseRequestPtr& request_ptr) {
     std::lock_guard<std::mutex> lock(queue_mtx_);
 
     std::string group_name = request_ptr->RequestGroup();
-    if (request_groups_.count(group_name) > 0) {
-        request_groups_[group_name]->Put(request_ptr);
-    } else {
+    auto iter = request_groups_.find(group_name);
+    if (iter == request_groups_.end()) {
+        RequestGroup group;
+        GetGroupLimits(group_name, group);
+
+        // leave room for the stop signals, Put never blocks since admission checks the queue limit
         RequestQueuePtr queue = std::make_shared<RequestQueue>();
-        queue->Put(request_ptr);
-        request_groups_.insert(std::make_pair(group_name, queue));
+        queue->SetCapacity(group.queue_limit_ + group.concurrency_);
+        group.queue_ = queue;
+        iter = request_groups_.insert(std::make_pair(group_name, group)).first;
         fiu_do_on("RequestScheduler.PutToQueue.null_queue", queue = nullptr);
 
-        // start a thread
-        ThreadPtr thread = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, queue);
+        // start threads
+        for (int64_t i = 0; i < group.concurrency_; ++i) {
+            auto thread = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, group_name, queue);
+
+            fiu_do_on("RequestScheduler.PutToQueue.push_null_thread", execute_threads_.push_back(nullptr));
+            execute_threads_.push_back(thread);
+        }
+        SERVER_LOG_INFO << "Create " << group.concurrency_ << " thread(s) for request group: " << group_name;
+    }
+
+    auto status = Admit(request_ptr, group_name, iter->second);
+    if (!status.ok()) {
+        return status;
+    }
+    iter->second.queue_->Put(request_ptr);
+
+    return Status::OK();
+}
+
+Status
+RequestScheduler::Admit(const BaseRequestPtr& request_ptr, const std::string& group_name, RequestGroup& group) {
+    std::string reason;
+    Status status;
+    if (group.queue_->Size() >= group.queue_limit_) {
+        reason = "queue_full";
+        status = Status(SERVER_REQUEST_REJECTED, "Too many requests in group " + group_name + ", retry later");
+    }
 
-        fiu_do_on("RequestScheduler.PutToQueue.push_null_thread", execute_threads_.push_back(nullptr));
-        execute_threads_.push_back(thread);
-        SERVER_LOG_INFO << "Create new thread for request group: " << group_name;
+    double estimated_time = 0.0;
+    auto rate = cost_rates_.find(request_ptr->CostKey());
+    if (rate != cost_rates_.end()) {
+        estimated_time = rate->second * request_ptr->EstimatedCost();
+    }
+
+    auto& context = request_ptr->context();
+    if (status.ok() && context != nullptr && context->GetDeadline() != std::chrono::system_clock::time_point::max()) {
+        // requests ahead are executed by all threads of the group, the request itself by one of them
+        double wait_time = group.pending_time_ / group.concurrency_ + estimated_time;
+        auto finish = std::chrono::system_clock::now() + std::chrono::microseconds(static_cast<int64_t>(wait_time));
+        if (finish > context->GetDeadline()) {
+            reason = "deadline";
+            status = Status(SERVER_REQUEST_REJECTED, "Request can't finish before its deadline, estimated " +
+                                                         std::to_string(static_cast<int64_t>(wait_time / 1000)) +
+                                                         " ms, retry later");
+        }
+    }
+
+    if (!status.ok()) {
+        SERVER_LOG_WARNING << "Reject request of group " << group_name << ": " << status.message();
+        server::Metrics::GetInstance().RequestRejectedIncrement(group_name, reason);
+        request_ptr->Reject(status);
+        return status;
     }
 
+    request_ptr->SetEstimatedTime(estimated_time);
+    group.pending_time_ += estimated_time;
     return Status::OK();
 }
 
+void
+RequestScheduler::RequestFinished(const BaseRequestPtr& request_ptr, const std::string& group_name,
+                                  double execute_time) {
+    std::lock_guard<std::mutex> lock(queue_mtx_);
+    auto group = request_groups_.find(group_name);
+    if (group != request_groups_.end()) {
+        group->second.pending_time_ = std::max(0.0, group->second.pending_time_ - request_ptr->EstimatedTime());
+    }
+
+    double rate = execute_time / std::max<int64_t>(1, request_ptr->EstimatedCost());
+    auto iter = cost_rates_.find(request_ptr->CostKey());
+    if (iter == cost_rates_.end()) {
+        cost_rates_.insert(std::make_pair(request_ptr->CostKey(), rate));
+    } else {
+        iter->second = (1 - COST_RATE_DECAY) * iter->second + COST_RATE_DECAY * rate;
+    }
+}
+
 }  // namespace server
 }  // namespace milvus
@@ -28,6 +28,18 @@ using RequestQueue = BlockingQueue<BaseRequestPtr>;
 using RequestQueuePtr = std::shared_ptr<RequestQueue>;
 using ThreadPtr = std::shared_ptr<std::thread>;
 
+// weight of the latest execution when updating the cost rate of a cost key
+static constexpr double COST_RATE_DECAY = 0.2;
+
+/*
+ * Requests of a group are queued and executed by the threads of the group. The queue limit and the number of threads
+ * of a group are configured by server_config.<group>_queue_limit and <group>_concurrency, the ddl_dml group always
+ * runs one thread so that its requests are executed in order.
+ * Admission control rejects a request instead of blocking the client when the queue of its group is full, or when
+ * the estimated wait plus execution time exceeds the deadline of the client. Execution time is estimated from
+ * BaseRequest::EstimatedCost() and the cost rate (us per unit of cost) learned from executed requests with the same
+ * cost key.
+ */
 class RequestScheduler {
  public:
     static RequestScheduler&
@@ -53,16 +65,34 @@ class RequestScheduler {
 
     virtual ~RequestScheduler();
 
+    struct RequestGroup {
+        RequestQueuePtr queue_;
+        int64_t queue_limit_ = 32;
+        int64_t concurrency_ = 1;
+        double pending_time_ = 0.0;  // us, estimated execution time of queued and running requests
+    };
+
+    static void
+    GetGroupLimits(const std::string& group_name, RequestGroup& group);
+
     void
-    TakeToExecute(RequestQueuePtr request_queue);
+    TakeToExecute(std::string group_name, RequestQueuePtr request_queue);
 
     Status
     PutToQueue(const BaseRequestPtr& request_ptr);
 
+    // must be called with queue_mtx_ held
+    Status
+    Admit(const BaseRequestPtr& request_ptr, const std::string& group_name, RequestGroup& group);
+
+    void
+    RequestFinished(const BaseRequestPtr& request_ptr, const std::string& group_name, double execute_time);
+
  private:
     mutable std::mutex queue_mtx_;
 
-    std::map<std::string, RequestQueuePtr> request_groups_;
+    std::map<std::string, RequestGroup> request_groups_;
+    std::map<std::string, double> cost_rates_;  // us per unit of cost, by cost key
 
     std::vector<ThreadPtr> execute_threads_;
 
@@ -13,11 +13,44 @@
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
 
+#include <algorithm>
+
 namespace milvus {
 namespace server {
 
+void
+TopKQueryResult::TrimPadding() {
+    if (row_num_ <= 0 || id_list_.empty()) {
+        return;
+    }
+
+    size_t topk = id_list_.size() / row_num_;
+    size_t stride = 0;
+    for (int64_t i = 0; i < row_num_; ++i) {
+        size_t count = 0;
+        while (count < topk && id_list_[i * topk + count] != -1) {
+            ++count;
+        }
+        stride = std::max(stride, count);
+    }
+    if (stride == topk) {
+        return;
+    }
+
+    for (int64_t i = 0; i < row_num_; ++i) {
+        std::copy_n(id_list_.begin() + i * topk, stride, id_list_.begin() + i * stride);
+        std::copy_n(distance_list_.begin() + i * topk, stride, distance_list_.begin() + i * stride);
+    }
+    id_list_.resize(row_num_ * stride);
+    distance_list_.resize(row_num_ * stride);
+}
+
 BaseRequest::BaseRequest(const std::shared_ptr<Context>& context, const std::string& request_group, bool async)
-    : context_(context), request_group_(request_group), async_(async), done_(false) {
+    : context_(context),
+      create_time_(std::chrono::steady_clock::now()),
+      request_group_(request_group),
+      async_(async),
+      done_(false) {
 }
 
 BaseRequest::~BaseRequest() {
@@ -26,6 +59,8 @@ BaseRequest::~BaseRequest() {
 
 Status
 BaseRequest::Execute() {
+    auto wait = std::chrono::steady_clock::now() - create_time_;
+    queue_cost_ = std::chrono::duration<double, std::micro>(wait).count();
     status_ = OnExecute();
     Done();
     return status_;
@@ -37,6 +72,12 @@ BaseRequest::Done() {
     finish_cond_.notify_all();
 }
 
+void
+BaseRequest::Reject(const Status& status) {
+    status_ = status;
+    Done();
+}
+
 Status
 BaseRequest::SetStatus(ErrorCode error_code, const std::string& error_msg) {
     status_ = Status(error_code, error_msg);
@@ -20,6 +20,7 @@
 #include "utils/Json.h"
 #include "utils/Status.h"
 
+#include <chrono>
 #include <condition_variable>
 //#include <gperftools/profiler.h>
 #include <memory>
@@ -59,6 +60,7 @@ struct TopKQueryResult {
     int64_t row_num_;
     engine::ResultIds id_list_;
     engine::ResultDistances distance_list_;
+    QueryProfilePtr profile_;  // only set when profile is requested
 
     TopKQueryResult() {
         row_num_ = 0;
@@ -69,6 +71,10 @@ struct TopKQueryResult {
         id_list_ = id_list;
         distance_list_ = distance_list;
     }
+
+    // cut the trailing -1 padding of all rows, range search usually finds much fewer results than topk
+    void
+    TrimPadding();
 };
 
 struct IndexParam {
@@ -103,6 +109,8 @@ struct SegmentStat {
     int64_t row_num_ = 0;
     std::string index_name_;
     int64_t data_size_ = 0;
+    std::string build_stage_;
+    int64_t built_rows_ = 0;
 };
 
 struct PartitionStat {
@@ -147,6 +155,38 @@ class BaseRequest {
         return async_;
     }
 
+    const std::shared_ptr<Context>&
+    context() const {
+        return context_;
+    }
+
+    // finish the request without executing it, e.g. rejected by admission control
+    void
+    Reject(const Status& status);
+
+    // relative execution cost used by admission control, requests with the same cost key are expected to take
+    // the same time per unit of cost
+    virtual int64_t
+    EstimatedCost() const {
+        return 1;
+    }
+
+    virtual std::string
+    CostKey() const {
+        return request_group_;
+    }
+
+    // time(us) the request is expected to execute, set by RequestScheduler when the request is admitted
+    double
+    EstimatedTime() const {
+        return estimated_time_;
+    }
+
+    void
+    SetEstimatedTime(double estimated_time) {
+        estimated_time_ = estimated_time;
+    }
+
  protected:
     virtual Status
     OnExecute() = 0;
@@ -157,8 +197,19 @@ class BaseRequest {
     std::string
     TableNotExistMsg(const std::string& table_name);
 
+    // time(us) the request waited in RequestScheduler queue before execution
+    double
+    QueueCost() const {
+        return queue_cost_;
+    }
+
  protected:
-    const std::shared_ptr<Context>& context_;
+    // a copy, the scheduler may look at the context after the caller has dropped its own reference
+    const std::shared_ptr<Context> context_;
+
+    std::chrono::steady_clock::time_point create_time_;
+    double queue_cost_ = 0.0;
+    double estimated_time_ = 0.0;
 
     mutable std::mutex finish_mtx_;
     std::condition_variable finish_cond_;
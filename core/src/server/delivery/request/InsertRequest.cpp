@@ -69,6 +69,11 @@ InsertRequest::OnExecute() {
             }
         }
 
+        status = ValidationUtil::ValidateAttrs(vectors_data_.attrs_, vector_count);
+        if (!status.ok()) {
+            return status;
+        }
+
         // step 2: check table existence
         // only process root table, ignore partition table
         engine::meta::TableSchema table_schema;
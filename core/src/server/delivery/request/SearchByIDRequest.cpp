@@ -17,8 +17,10 @@
 
 #include "server/delivery/request/SearchByIDRequest.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "db/engine/ExecutionEngine.h"
 #include "server/Config.h"
 #include "server/DBWrapper.h"
 #include "utils/CommonUtil.h"
@@ -53,6 +55,16 @@ SearchByIDRequest::Create(const std::shared_ptr<Context>& context, const std::st
         new SearchByIDRequest(context, table_name, vector_id, topk, extra_params, partition_list, result));
 }
 
+int64_t
+SearchByIDRequest::EstimatedCost() const {
+    return std::max<int64_t>(1, topk_);
+}
+
+std::string
+SearchByIDRequest::CostKey() const {
+    return RequestGroup() + ":" + table_name_;
+}
+
 Status
 SearchByIDRequest::OnExecute() {
     try {
@@ -122,7 +134,8 @@ SearchByIDRequest::OnExecute() {
         }
 
         // step 4: check search parameter
-        status = ValidationUtil::ValidateSearchTopk(topk_, table_schema);
+        bool range_search = extra_params_.contains(engine::RANGE_RADIUS_KEY);
+        status = ValidationUtil::ValidateSearchTopk(topk_, table_schema, range_search);
         if (!status.ok()) {
             return status;
         }
@@ -162,6 +175,9 @@ SearchByIDRequest::OnExecute() {
         result_.row_num_ = 1;
         result_.distance_list_ = result_distances;
         result_.id_list_ = result_ids;
+        if (extra_params_.contains(engine::RANGE_RADIUS_KEY)) {
+            result_.TrimPadding();
+        }
 
         post_query_ctx->GetTraceContext()->GetSpan()->Finish();
 
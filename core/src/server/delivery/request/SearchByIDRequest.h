@@ -32,6 +32,12 @@ class SearchByIDRequest : public BaseRequest {
     Create(const std::shared_ptr<Context>& context, const std::string& table_name, int64_t vector_id, int64_t topk,
            const milvus::json& extra_params, const std::vector<std::string>& partition_list, TopKQueryResult& result);
 
+    int64_t
+    EstimatedCost() const override;
+
+    std::string
+    CostKey() const override;
+
  protected:
     SearchByIDRequest(const std::shared_ptr<Context>& context, const std::string& table_name, int64_t vector_id,
                       int64_t topk, const milvus::json& extra_params, const std::vector<std::string>& partition_list,
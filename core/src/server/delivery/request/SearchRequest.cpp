@@ -11,6 +11,8 @@
 
 #include "server/delivery/request/SearchRequest.h"
 #include "db/Utils.h"
+#include "db/engine/ExecutionEngine.h"
+#include "db/engine/QueryGroups.h"
 #include "server/DBWrapper.h"
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
@@ -18,6 +20,7 @@
 #include "utils/ValidationUtil.h"
 
 #include <fiu-local.h>
+#include <algorithm>
 #include <memory>
 #ifdef MILVUS_ENABLE_PROFILING
 #include <gperftools/profiler.h>
@@ -49,6 +52,16 @@ SearchRequest::Create(const std::shared_ptr<Context>& context, const std::string
         new SearchRequest(context, table_name, vectors, topk, extra_params, partition_list, file_id_list, result));
 }
 
+int64_t
+SearchRequest::EstimatedCost() const {
+    return std::max<int64_t>(1, vectors_data_.vector_count_ * topk_);
+}
+
+std::string
+SearchRequest::CostKey() const {
+    return RequestGroup() + ":" + table_name_;
+}
+
 Status
 SearchRequest::OnExecute() {
     try {
@@ -61,6 +74,16 @@ SearchRequest::OnExecute() {
 
         TimeRecorder rc(hdr);
 
+        // profile is opt-in, collected on a private copy of the context since the context may be shared
+        std::shared_ptr<Context> query_ctx = context_;
+        if (extra_params_.contains(QUERY_PROFILE_KEY) && extra_params_[QUERY_PROFILE_KEY].is_boolean() &&
+            extra_params_[QUERY_PROFILE_KEY].get<bool>()) {
+            result_.profile_ = std::make_shared<QueryProfile>();
+            result_.profile_->RecordStage(QUERY_STAGE_QUEUE, QueueCost());
+            query_ctx = std::make_shared<Context>(*context_);
+            query_ctx->SetProfile(result_.profile_);
+        }
+
         // step 1: check table name
         auto status = ValidationUtil::ValidateTableName(table_name_);
         if (!status.ok()) {
@@ -91,7 +114,8 @@ SearchRequest::OnExecute() {
         }
 
         // step 3: check search parameter
-        status = ValidationUtil::ValidateSearchTopk(topk_, table_schema);
+        bool range_search = extra_params_.contains(engine::RANGE_RADIUS_KEY);
+        status = ValidationUtil::ValidateSearchTopk(topk_, table_schema, range_search);
         if (!status.ok()) {
             return status;
         }
@@ -101,7 +125,7 @@ SearchRequest::OnExecute() {
                           "The vector array is empty. Make sure you have entered vector records.");
         }
 
-        rc.RecordSection("check validation");
+        double validate_cost = rc.RecordSection("check validation");
 
         // step 4: check metric type
         if (engine::utils::IsBinaryMetricType(table_schema.metric_type_)) {
@@ -130,7 +154,17 @@ SearchRequest::OnExecute() {
             }
         }
 
-        rc.RecordSection("prepare vector data");
+        // query vectors grouped for a multi-vector search, one result row per group
+        engine::QueryGroupsPtr query_groups;
+        status = engine::QueryGroups::Parse(extra_params_, vector_count, query_groups);
+        if (!status.ok()) {
+            return Status(SERVER_INVALID_ARGUMENT, status.message());
+        }
+
+        validate_cost += rc.RecordSection("prepare vector data");
+        if (result_.profile_ != nullptr) {
+            result_.profile_->RecordStage(QUERY_STAGE_VALIDATE, validate_cost);
+        }
 
         // step 5: search vectors
         engine::ResultIds result_ids;
@@ -151,18 +185,21 @@ SearchRequest::OnExecute() {
                 return status;
             }
 
-            status = DBWrapper::DB()->Query(context_, table_name_, partition_list_, (size_t)topk_, extra_params_,
+            status = DBWrapper::DB()->Query(query_ctx, table_name_, partition_list_, (size_t)topk_, extra_params_,
                                             vectors_data_, result_ids, result_distances);
         } else {
-            status = DBWrapper::DB()->QueryByFileID(context_, table_name_, file_id_list_, (size_t)topk_, extra_params_,
-                                                    vectors_data_, result_ids, result_distances);
+            status = DBWrapper::DB()->QueryByFileID(query_ctx, table_name_, file_id_list_, (size_t)topk_,
+                                                    extra_params_, vectors_data_, result_ids, result_distances);
         }
 
 #ifdef MILVUS_ENABLE_PROFILING
         ProfilerStop();
 #endif
 
-        rc.RecordSection("search vectors from engine");
+        double engine_cost = rc.RecordSection("search vectors from engine");
+        if (result_.profile_ != nullptr) {
+            result_.profile_->RecordStage(QUERY_STAGE_ENGINE, engine_cost);
+        }
         fiu_do_on("SearchRequest.OnExecute.query_fail", status = Status(milvus::SERVER_UNEXPECTED_ERROR, ""));
         if (!status.ok()) {
             return status;
@@ -175,9 +212,12 @@ SearchRequest::OnExecute() {
         auto post_query_ctx = context_->Child("Constructing result");
 
         // step 7: construct result array
-        result_.row_num_ = vector_count;
+        result_.row_num_ = query_groups == nullptr ? vector_count : query_groups->GroupCount();
         result_.distance_list_ = result_distances;
         result_.id_list_ = result_ids;
+        if (extra_params_.contains(engine::RANGE_RADIUS_KEY)) {
+            result_.TrimPadding();
+        }
 
         post_query_ctx->GetTraceContext()->GetSpan()->Finish();
 
@@ -27,6 +27,13 @@ class SearchRequest : public BaseRequest {
            int64_t topk, const milvus::json& extra_params, const std::vector<std::string>& partition_list,
            const std::vector<std::string>& file_id_list, TopKQueryResult& result);
 
+    // nq * topk, the file count of the table is folded into the cost rate learned per table
+    int64_t
+    EstimatedCost() const override;
+
+    std::string
+    CostKey() const override;
+
  protected:
     SearchRequest(const std::shared_ptr<Context>& context, const std::string& table_name,
                   const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
@@ -0,0 +1,178 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/delivery/request/SearchTablesRequest.h"
+#include "db/Utils.h"
+#include "db/engine/ExecutionEngine.h"
+#include "db/engine/QueryGroups.h"
+#include "server/DBWrapper.h"
+#include "utils/Log.h"
+#include "utils/TimeRecorder.h"
+#include "utils/ValidationUtil.h"
+
+#include <fiu-local.h>
+#include <memory>
+
+namespace milvus {
+namespace server {
+
+SearchTablesRequest::SearchTablesRequest(const std::shared_ptr<Context>& context,
+                                         const std::vector<std::string>& table_names,
+                                         const engine::VectorsData& vectors, int64_t topk,
+                                         const milvus::json& extra_params,
+                                         const std::vector<std::string>& partition_list,
+                                         std::vector<TopKQueryResult>& results)
+    : BaseRequest(context, DQL_REQUEST_GROUP),
+      table_names_(table_names),
+      vectors_data_(vectors),
+      topk_(topk),
+      extra_params_(extra_params),
+      partition_list_(partition_list),
+      results_(results) {
+}
+
+BaseRequestPtr
+SearchTablesRequest::Create(const std::shared_ptr<Context>& context, const std::vector<std::string>& table_names,
+                            const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+                            const std::vector<std::string>& partition_list, std::vector<TopKQueryResult>& results) {
+    return std::shared_ptr<BaseRequest>(
+        new SearchTablesRequest(context, table_names, vectors, topk, extra_params, partition_list, results));
+}
+
+Status
+SearchTablesRequest::ValidateTable(const std::string& table_name, engine::meta::TableSchema& table_schema) {
+    auto status = ValidationUtil::ValidateTableName(table_name);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // only process root table, ignore partition table
+    table_schema.table_id_ = table_name;
+    status = DBWrapper::DB()->DescribeTable(table_schema);
+    if (!status.ok()) {
+        if (status.code() == DB_NOT_FOUND) {
+            return Status(SERVER_TABLE_NOT_EXIST, TableNotExistMsg(table_name));
+        }
+        return status;
+    }
+    if (!table_schema.owner_table_.empty()) {
+        return Status(SERVER_INVALID_TABLE_NAME, TableNotExistMsg(table_name));
+    }
+
+    status = ValidationUtil::ValidateSearchParams(extra_params_, table_schema, topk_);
+    if (!status.ok()) {
+        return status;
+    }
+
+    return ValidationUtil::ValidateSearchTopk(topk_, table_schema, extra_params_.contains(engine::RANGE_RADIUS_KEY));
+}
+
+Status
+SearchTablesRequest::OnExecute() {
+    try {
+        fiu_do_on("SearchTablesRequest.OnExecute.throw_std_exception", throw std::exception());
+        uint64_t vector_count = vectors_data_.vector_count_;
+        std::string hdr = "SearchTablesRequest(tables=" + std::to_string(table_names_.size()) +
+                          ", nq=" + std::to_string(vector_count) + ", k=" + std::to_string(topk_) +
+                          ", extra_params=" + extra_params_.dump() + ")";
+        TimeRecorder rc(hdr);
+
+        // step 1: check tables, the queries are shared so all tables must have the same dimension and metric
+        if (table_names_.empty()) {
+            return Status(SERVER_INVALID_ARGUMENT, "No table to search.");
+        }
+
+        engine::meta::TableSchema first_schema;
+        for (size_t i = 0; i < table_names_.size(); ++i) {
+            engine::meta::TableSchema table_schema;
+            auto status = ValidateTable(table_names_[i], table_schema);
+            if (!status.ok()) {
+                return status;
+            }
+
+            if (i == 0) {
+                first_schema = table_schema;
+            } else if (table_schema.dimension_ != first_schema.dimension_ ||
+                       table_schema.metric_type_ != first_schema.metric_type_) {
+                std::string msg = "Table " + table_names_[i] + " differs from table " + first_schema.table_id_;
+                return Status(SERVER_INVALID_ARGUMENT, msg + " in dimension or metric type.");
+            }
+        }
+
+        // step 2: check vectors once for all tables
+        if (vectors_data_.float_data_.empty() && vectors_data_.binary_data_.empty()) {
+            return Status(SERVER_INVALID_ROWRECORD_ARRAY,
+                          "The vector array is empty. Make sure you have entered vector records.");
+        }
+
+        if (engine::utils::IsBinaryMetricType(first_schema.metric_type_)) {
+            if (vectors_data_.binary_data_.size() % vector_count != 0 ||
+                vectors_data_.binary_data_.size() * 8 / vector_count != first_schema.dimension_) {
+                return Status(SERVER_INVALID_VECTOR_DIMENSION,
+                              "The vector dimension must be equal to the table dimension.");
+            }
+        } else {
+            if (vectors_data_.float_data_.size() % vector_count != 0 ||
+                vectors_data_.float_data_.size() / vector_count != first_schema.dimension_) {
+                return Status(SERVER_INVALID_VECTOR_DIMENSION,
+                              "The vector dimension must be equal to the table dimension.");
+            }
+        }
+
+        engine::QueryGroupsPtr query_groups;
+        auto status = engine::QueryGroups::Parse(extra_params_, vector_count, query_groups);
+        if (!status.ok()) {
+            return Status(SERVER_INVALID_ARGUMENT, status.message());
+        }
+
+        status = ValidationUtil::ValidatePartitionTags(partition_list_);
+        if (!status.ok()) {
+            return status;
+        }
+
+        rc.RecordSection("check validation");
+
+        // step 3: search all tables with one job
+        std::vector<engine::ResultIds> result_ids;
+        std::vector<engine::ResultDistances> result_distances;
+        status = DBWrapper::DB()->QueryTables(context_, table_names_, partition_list_, (size_t)topk_, extra_params_,
+                                              vectors_data_, result_ids, result_distances);
+        rc.RecordSection("search vectors from engine");
+        fiu_do_on("SearchTablesRequest.OnExecute.query_fail", status = Status(milvus::SERVER_UNEXPECTED_ERROR, ""));
+        if (!status.ok()) {
+            return status;
+        }
+
+        // step 4: construct result of each table, empty tables give empty results
+        results_.clear();
+        for (size_t i = 0; i < table_names_.size(); ++i) {
+            TopKQueryResult result;
+            if (!result_ids[i].empty()) {
+                result.row_num_ = query_groups == nullptr ? vector_count : query_groups->GroupCount();
+                result.id_list_.swap(result_ids[i]);
+                result.distance_list_.swap(result_distances[i]);
+                if (extra_params_.contains(engine::RANGE_RADIUS_KEY)) {
+                    result.TrimPadding();
+                }
+            }
+            results_.emplace_back(std::move(result));
+        }
+
+        rc.ElapseFromBegin("totally cost");
+    } catch (std::exception& ex) {
+        return Status(SERVER_UNEXPECTED_ERROR, ex.what());
+    }
+
+    return Status::OK();
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,56 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include "server/delivery/request/BaseRequest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace server {
+
+// names of more tables to search in search params, the same queries are searched in all of them with one job
+static const char* SEARCH_TABLES_KEY = "tables";
+
+class SearchTablesRequest : public BaseRequest {
+ public:
+    static BaseRequestPtr
+    Create(const std::shared_ptr<Context>& context, const std::vector<std::string>& table_names,
+           const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+           const std::vector<std::string>& partition_list, std::vector<TopKQueryResult>& results);
+
+ protected:
+    SearchTablesRequest(const std::shared_ptr<Context>& context, const std::vector<std::string>& table_names,
+                        const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+                        const std::vector<std::string>& partition_list, std::vector<TopKQueryResult>& results);
+
+    Status
+    OnExecute() override;
+
+ private:
+    Status
+    ValidateTable(const std::string& table_name, engine::meta::TableSchema& table_schema);
+
+ private:
+    const std::vector<std::string> table_names_;
+    const engine::VectorsData& vectors_data_;
+    int64_t topk_;
+    milvus::json extra_params_;
+    const std::vector<std::string> partition_list_;
+
+    std::vector<TopKQueryResult>& results_;
+};
+
+}  // namespace server
+}  // namespace milvus
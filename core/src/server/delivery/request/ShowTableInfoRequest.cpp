@@ -37,6 +37,8 @@ ConstructPartitionStat(const engine::PartitionStat& partition_stat, PartitionSta
         seg_stat.row_num_ = seg.row_count_;
         seg_stat.index_name_ = seg.index_name_;
         seg_stat.data_size_ = seg.data_size_;
+        seg_stat.build_stage_ = seg.build_stage_;
+        seg_stat.built_rows_ = seg.built_rows_;
         req_partition_stat.segments_stat_.emplace_back(seg_stat);
         row_count += seg.row_count_;
     }
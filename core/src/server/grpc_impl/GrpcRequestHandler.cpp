@@ -12,11 +12,14 @@
 #include "server/grpc_impl/GrpcRequestHandler.h"
 
 #include <fiu-local.h>
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
 #include "server/Config.h"
+#include "server/delivery/request/SearchTablesRequest.h"
 #include "tracing/TextMapCarrier.h"
 #include "tracing/TracerUtil.h"
 #include "utils/Log.h"
@@ -108,12 +111,58 @@ CopyRowRecords(const google::protobuf::RepeatedPtrField<::milvus::grpc::RowRecor
     vectors.id_array_.swap(id_array);
 }
 
+// attributes come in extra params as {"attrs": {"name": [value, ...]}}, one value per vector,
+// a column is int64 when all of its values are integers, otherwise double
+Status
+CopyAttrs(const milvus::json& json_params, engine::VectorsData& vectors) {
+    if (!json_params.contains("attrs")) {
+        return Status::OK();
+    }
+
+    auto& json_attrs = json_params["attrs"];
+    if (!json_attrs.is_object()) {
+        return Status(SERVER_INVALID_ARGUMENT, "Attributes must be an object of name and value array");
+    }
+
+    for (auto& item : json_attrs.items()) {
+        auto& values = item.value();
+        if (!values.is_array()) {
+            return Status(SERVER_INVALID_ARGUMENT, "Values of attribute " + item.key() + " must be an array");
+        }
+
+        bool all_integer = true;
+        for (auto& value : values) {
+            if (!value.is_number()) {
+                return Status(SERVER_INVALID_ARGUMENT, "Values of attribute " + item.key() + " must be numbers");
+            }
+            all_integer = all_integer && value.is_number_integer();
+        }
+
+        auto type = all_integer ? segment::AttrType::INT64 : segment::AttrType::DOUBLE;
+        auto attr = std::make_shared<segment::Attr>(item.key(), type);
+        attr->Resize(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (all_integer) {
+                int64_t value = values[i].get<int64_t>();
+                attr->SetData(i, reinterpret_cast<const uint8_t*>(&value), 1);
+            } else {
+                double value = values[i].get<double>();
+                attr->SetData(i, reinterpret_cast<const uint8_t*>(&value), 1);
+            }
+        }
+        vectors.attrs_.attrs[item.key()] = attr;
+    }
+
+    return Status::OK();
+}
+
 void
 ConstructResults(const TopKQueryResult& result, ::milvus::grpc::TopKQueryResult* response) {
     if (!response) {
         return;
     }
 
+    TimeRecorder rc("ConstructResults");
     response->set_row_num(result.row_num_);
 
     response->mutable_ids()->Resize(static_cast<int>(result.id_list_.size()), 0);
@@ -122,6 +171,78 @@ ConstructResults(const TopKQueryResult& result, ::milvus::grpc::TopKQueryResult*
     response->mutable_distances()->Resize(static_cast<int>(result.distance_list_.size()), 0.0);
     memcpy(response->mutable_distances()->mutable_data(), result.distance_list_.data(),
            result.distance_list_.size() * sizeof(float));
+
+    // attach query profile only when client asked for it
+    if (result.profile_ != nullptr) {
+        result.profile_->RecordStage(QUERY_STAGE_SERIALIZE, rc.ElapseFromBegin("copy result"));
+        ::milvus::grpc::KeyValuePair* kv = response->add_extra_params();
+        kv->set_key(QUERY_PROFILE_KEY);
+        kv->set_value(result.profile_->Dump().dump());
+    }
+}
+
+// tables listed in search params are searched after the table of the request, duplicates are ignored
+Status
+CopySearchTables(const milvus::json& json_params, std::vector<std::string>& table_names) {
+    auto& tables = json_params[SEARCH_TABLES_KEY];
+    if (!tables.is_array()) {
+        return Status(SERVER_INVALID_ARGUMENT, "Search params 'tables' must be an array of table names.");
+    }
+    for (auto& table : tables) {
+        if (!table.is_string()) {
+            return Status(SERVER_INVALID_ARGUMENT, "Search params 'tables' must be an array of table names.");
+        }
+        auto table_name = table.get<std::string>();
+        if (std::find(table_names.begin(), table_names.end(), table_name) == table_names.end()) {
+            table_names.emplace_back(table_name);
+        }
+    }
+    return Status::OK();
+}
+
+// results of the tables follow each other in the order given under 'tables' in extra params, all padded with -1
+// to the same number of results per query, row_num is the number of queries (or query groups) times the number
+// of tables
+void
+ConstructTablesResults(const std::vector<std::string>& table_names, int64_t nq,
+                       const std::vector<TopKQueryResult>& results, ::milvus::grpc::TopKQueryResult* response) {
+    if (!response || results.size() != table_names.size()) {
+        return;
+    }
+
+    for (auto& result : results) {
+        if (result.row_num_ > 0) {
+            nq = result.row_num_;
+        }
+    }
+    if (nq <= 0) {
+        return;
+    }
+
+    size_t stride = 0;
+    for (auto& result : results) {
+        stride = std::max(stride, result.id_list_.size() / nq);
+    }
+
+    response->set_row_num(nq * results.size());
+    response->mutable_ids()->Resize(static_cast<int>(nq * stride * results.size()), -1);
+    response->mutable_distances()->Resize(static_cast<int>(nq * stride * results.size()),
+                                          std::numeric_limits<float>::max());
+    int64_t* ids = response->mutable_ids()->mutable_data();
+    float* distances = response->mutable_distances()->mutable_data();
+    for (auto& result : results) {
+        size_t topk = result.id_list_.size() / nq;
+        for (int64_t i = 0; i < nq; ++i) {
+            memcpy(ids + i * stride, result.id_list_.data() + i * topk, topk * sizeof(int64_t));
+            memcpy(distances + i * stride, result.distance_list_.data() + i * topk, topk * sizeof(float));
+        }
+        ids += nq * stride;
+        distances += nq * stride;
+    }
+
+    ::milvus::grpc::KeyValuePair* kv = response->add_extra_params();
+    kv->set_key(SEARCH_TABLES_KEY);
+    kv->set_value(milvus::json(table_names).dump());
 }
 
 void
@@ -139,6 +260,8 @@ ConstructPartitionStat(const PartitionStat& partition_stat, ::milvus::grpc::Part
         grpc_seg_stat->set_segment_name(seg_stat.name_);
         grpc_seg_stat->set_index_name(seg_stat.index_name_);
         grpc_seg_stat->set_data_size(seg_stat.data_size_);
+        grpc_seg_stat->set_build_stage(seg_stat.build_stage_);
+        grpc_seg_stat->set_built_count(seg_stat.built_rows_);
     }
 }
 
@@ -200,6 +323,8 @@ GrpcRequestHandler::OnPostRecvInitialMetaData(
     auto trace_context = std::make_shared<tracing::TraceContext>(span);
     auto context = std::make_shared<Context>(request_id);
     context->SetTraceContext(trace_context);
+    context->SetDeadline(server_context->deadline());
+    context->GetCancelToken()->SetSource([server_context]() { return server_context->IsCancelled(); });
     SetContext(server_rpc_info->server_context(), context);
 }
 
@@ -210,6 +335,8 @@ GrpcRequestHandler::OnPreSendMessage(::grpc::experimental::ServerRpcInfo* server
     context_map_[server_rpc_info->server_context()]->GetTraceContext()->GetSpan()->Finish();
     auto search = context_map_.find(server_rpc_info->server_context());
     if (search != context_map_.end()) {
+        // the server context goes away with the call, tasks still holding the context must not poll it
+        search->second->GetCancelToken()->SetSource(nullptr);
         context_map_.erase(search);
     }
 }
@@ -304,11 +431,23 @@ GrpcRequestHandler::Insert(::grpc::ServerContext* context, const ::milvus::grpc:
     engine::VectorsData vectors;
     CopyRowRecords(request->row_record_array(), request->row_id_array(), vectors);
 
-    // step 2: insert vectors
-    Status status =
-        request_handler_.Insert(context_map_[context], request->table_name(), vectors, request->partition_tag());
+    // step 2: copy attributes
+    milvus::json json_params;
+    for (int i = 0; i < request->extra_params_size(); i++) {
+        const ::milvus::grpc::KeyValuePair& extra = request->extra_params(i);
+        if (extra.key() == EXTRA_PARAM_KEY) {
+            json_params = json::parse(extra.value());
+        }
+    }
+    Status status = CopyAttrs(json_params, vectors);
+
+    // step 3: insert vectors
+    if (status.ok()) {
+        status =
+            request_handler_.Insert(context_map_[context], request->table_name(), vectors, request->partition_tag());
+    }
 
-    // step 3: return id array
+    // step 4: return id array
     response->mutable_vector_id_array()->Resize(static_cast<int>(vectors.id_array_.size()), 0);
     memcpy(response->mutable_vector_id_array()->mutable_data(), vectors.id_array_.data(),
            vectors.id_array_.size() * sizeof(int64_t));
@@ -383,7 +522,24 @@ GrpcRequestHandler::Search(::grpc::ServerContext* context, const ::milvus::grpc:
         }
     }
 
-    // step 4: search vectors
+    // step 4: search vectors, in several tables with one request when search params list more tables
+    if (json_params.contains(SEARCH_TABLES_KEY)) {
+        std::vector<std::string> table_names = {request->table_name()};
+        std::vector<TopKQueryResult> results;
+        Status status = CopySearchTables(json_params, table_names);
+        if (status.ok()) {
+            json_params.erase(SEARCH_TABLES_KEY);
+            status = request_handler_.SearchTables(context_map_[context], table_names, vectors, request->topk(),
+                                                   json_params, partitions, results);
+        }
+
+        ConstructTablesResults(table_names, vectors.vector_count_, results, response);
+
+        SET_RESPONSE(response->mutable_status(), status, context);
+
+        return ::grpc::Status::OK;
+    }
+
     std::vector<std::string> file_ids;
     TopKQueryResult result;
     fiu_do_on("GrpcRequestHandler.Search.not_empty_file_ids", file_ids.emplace_back("test_file_id"));
@@ -141,6 +141,10 @@ WebRequestHandler::ParseSegmentStat(const milvus::server::SegmentStat& seg_stat,
     json["index"] = seg_stat.index_name_;
     json["count"] = seg_stat.row_num_;
     json["size"] = seg_stat.data_size_;
+    if (!seg_stat.build_stage_.empty()) {
+        json["build_stage"] = seg_stat.build_stage_;
+        json["built_count"] = seg_stat.built_rows_;
+    }
 
     return Status::OK();
 }
@@ -542,6 +546,9 @@ WebRequestHandler::Search(const std::string& collection_name, const nlohmann::js
 
     nlohmann::json result_json;
     result_json["num"] = result.row_num_;
+    if (result.profile_ != nullptr) {
+        result_json[QUERY_PROFILE_KEY] = result.profile_->Dump();
+    }
     if (result.row_num_ == 0) {
         result_json["result"] = std::vector<int64_t>();
         result_str = result_json.dump();
@@ -0,0 +1,160 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "storage/file/DirectIOReader.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <vector>
+
+#include "storage/file/DirectIOUtil.h"
+#include "utils/Exception.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace storage {
+
+namespace {
+
+// read [offset, offset + size) into data, stop early at end of file, errno or 0
+int
+ReadFully(int fd, uint8_t* data, size_t size, size_t offset, size_t& read_bytes) {
+    read_bytes = 0;
+    while (read_bytes < size) {
+        ssize_t n = pread(fd, data + read_bytes, size - read_bytes, offset + read_bytes);
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        if (n == 0) {
+            break;
+        }
+        read_bytes += n;
+    }
+    return 0;
+}
+
+// read [begin, end) of file into dst, the range of chunk [chunk_begin, chunk_end) is aligned when direct
+int
+ReadChunk(int fd, bool direct, size_t chunk_begin, size_t chunk_end, size_t begin, size_t end, uint8_t* dst) {
+    size_t lo = std::max(begin, chunk_begin);
+    size_t hi = std::min(end, chunk_end);
+    size_t read_bytes = 0;
+
+    if (!direct) {
+        int err = ReadFully(fd, dst + (lo - begin), hi - lo, lo, read_bytes);
+        if (err == 0 && read_bytes < hi - lo) {
+            err = EIO;
+        }
+        posix_fadvise(fd, lo, hi - lo, POSIX_FADV_DONTNEED);
+        return err;
+    }
+
+    auto buffer = AllocAlignedBuffer(chunk_end - chunk_begin);
+    if (buffer == nullptr) {
+        return ENOMEM;
+    }
+    int err = ReadFully(fd, buffer.get(), chunk_end - chunk_begin, chunk_begin, read_bytes);
+    if (err != 0) {
+        return err;
+    }
+    if (chunk_begin + read_bytes < hi) {
+        return EIO;
+    }
+    memcpy(dst + (lo - begin), buffer.get() + (lo - chunk_begin), hi - lo);
+    return 0;
+}
+
+}  // namespace
+
+DirectIOReader::DirectIOReader(const std::string& name) : IOReader(name) {
+    fd_ = OpenDirect(name_, O_RDONLY, direct_);
+    if (fd_ == -1) {
+        STORAGE_LOG_ERROR << "Failed to open file " << name_ << ": " << strerror(errno);
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd_, &st) == 0) {
+        size_ = st.st_size;
+    }
+}
+
+DirectIOReader::~DirectIOReader() {
+    if (fd_ != -1) {
+        close(fd_);
+    }
+}
+
+void
+DirectIOReader::read(void* ptr, size_t size) {
+    if (size == 0) {
+        return;
+    }
+
+    size_t begin = pos_;
+    size_t end = pos_ + size;
+    auto dst = static_cast<uint8_t*>(ptr);
+
+    std::vector<std::pair<size_t, size_t>> chunks;
+    size_t chunk_begin = direct_ ? AlignDown(begin) : begin;
+    size_t range_end = direct_ ? AlignUp(end) : end;
+    while (chunk_begin < range_end) {
+        size_t chunk_end = std::min(chunk_begin + DIRECT_IO_CHUNK_SIZE, range_end);
+        chunks.emplace_back(chunk_begin, chunk_end);
+        chunk_begin = chunk_end;
+    }
+
+    // the first chunk is read by the caller thread while the others are in the pool
+    int fd = fd_;
+    bool direct = direct_;
+    std::vector<std::future<int>> futures;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        auto chunk = chunks[i];
+        futures.emplace_back(DirectIOThreadPool().enqueue([fd, direct, chunk, begin, end, dst]() {
+            return ReadChunk(fd, direct, chunk.first, chunk.second, begin, end, dst);
+        }));
+    }
+
+    int err = ReadChunk(fd, direct, chunks[0].first, chunks[0].second, begin, end, dst);
+    for (auto& future : futures) {
+        int ret = future.get();
+        err = (err != 0) ? err : ret;
+    }
+    pos_ = end;
+
+    if (err != 0) {
+        std::string msg = "Failed to read file " + name_ + ": " + strerror(err);
+        STORAGE_LOG_ERROR << msg;
+        throw Exception(SERVER_UNEXPECTED_ERROR, msg);
+    }
+}
+
+void
+DirectIOReader::seekg(size_t pos) {
+    pos_ = pos;
+}
+
+size_t
+DirectIOReader::length() {
+    return size_;
+}
+
+}  // namespace storage
+}  // namespace milvus
@@ -0,0 +1,48 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "storage/IOReader.h"
+
+namespace milvus {
+namespace storage {
+
+/*
+ * Reads a file bypassing the page cache. Large reads are split into aligned chunks read concurrently by the
+ * direct io thread pool through aligned bounce buffers, so the destination needs no alignment.
+ * Read errors are thrown as milvus::Exception, length() is 0 if the file can't be opened.
+ */
+class DirectIOReader : public IOReader {
+ public:
+    explicit DirectIOReader(const std::string& name);
+    ~DirectIOReader();
+
+    void
+    read(void* ptr, size_t size) override;
+
+    void
+    seekg(size_t pos) override;
+
+    size_t
+    length() override;
+
+ private:
+    int fd_ = -1;
+    bool direct_ = false;
+    size_t size_ = 0;
+    size_t pos_ = 0;
+};
+
+}  // namespace storage
+}  // namespace milvus
@@ -0,0 +1,59 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "storage/file/DirectIOUtil.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+
+#include <cerrno>
+
+#include "server/Config.h"
+
+namespace milvus {
+namespace storage {
+
+bool
+DirectIOEnabled() {
+    std::string mode;
+    server::Config::GetInstance().GetStorageConfigFileIOMode(mode);
+    return mode == server::CONFIG_STORAGE_FILE_IO_MODE_DIRECT;
+}
+
+std::shared_ptr<uint8_t>
+AllocAlignedBuffer(size_t size) {
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, DIRECT_IO_ALIGNMENT, AlignUp(size)) != 0) {
+        return nullptr;
+    }
+    return std::shared_ptr<uint8_t>(static_cast<uint8_t*>(ptr), [](uint8_t* p) { free(p); });
+}
+
+ThreadPool&
+DirectIOThreadPool() {
+    static ThreadPool pool(DIRECT_IO_THREADS);
+    return pool;
+}
+
+int
+OpenDirect(const std::string& name, int flags, bool& direct) {
+    direct = true;
+    int fd = open(name.c_str(), flags | O_DIRECT, 00664);
+    if (fd == -1 && errno == EINVAL) {
+        // tmpfs and some network file systems reject O_DIRECT
+        direct = false;
+        fd = open(name.c_str(), flags, 00664);
+    }
+    return fd;
+}
+
+}  // namespace storage
+}  // namespace milvus
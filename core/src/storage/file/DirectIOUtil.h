@@ -0,0 +1,55 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "utils/ThreadPool.h"
+
+namespace milvus {
+namespace storage {
+
+// O_DIRECT transfers must be aligned to the logical block size of the device, 4K covers common devices.
+// Large transfers are split into chunks done concurrently by the direct io thread pool.
+static constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+static constexpr size_t DIRECT_IO_CHUNK_SIZE = 4 * 1024 * 1024;
+static constexpr size_t DIRECT_IO_THREADS = 8;
+
+// storage_config.file_io_mode is "direct"
+bool
+DirectIOEnabled();
+
+// buffer aligned to DIRECT_IO_ALIGNMENT, nullptr if allocation failed
+std::shared_ptr<uint8_t>
+AllocAlignedBuffer(size_t size);
+
+ThreadPool&
+DirectIOThreadPool();
+
+// open with O_DIRECT, fall back to buffered io when the file system doesn't support it, direct tells which.
+// returns -1 and sets errno on failure
+int
+OpenDirect(const std::string& name, int flags, bool& direct);
+
+inline size_t
+AlignDown(size_t value) {
+    return value / DIRECT_IO_ALIGNMENT * DIRECT_IO_ALIGNMENT;
+}
+
+inline size_t
+AlignUp(size_t value) {
+    return AlignDown(value + DIRECT_IO_ALIGNMENT - 1);
+}
+
+}  // namespace storage
+}  // namespace milvus
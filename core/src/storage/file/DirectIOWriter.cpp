@@ -0,0 +1,158 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "storage/file/DirectIOWriter.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "storage/file/DirectIOUtil.h"
+#include "utils/Exception.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace storage {
+
+namespace {
+
+// bound the memory held by chunks waiting for the thread pool
+constexpr size_t MAX_PENDING_CHUNKS = DIRECT_IO_THREADS * 2;
+
+int
+WriteFully(int fd, const uint8_t* data, size_t size, size_t offset) {
+    while (size > 0) {
+        ssize_t n = pwrite(fd, data, size, offset);
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        data += n;
+        size -= n;
+        offset += n;
+    }
+    return 0;
+}
+
+}  // namespace
+
+DirectIOWriter::DirectIOWriter(const std::string& name) : IOWriter(name) {
+    fd_ = OpenDirect(name_, O_WRONLY | O_CREAT | O_TRUNC, direct_);
+    if (fd_ == -1) {
+        std::string msg = "Failed to open file " + name_ + ": " + strerror(errno);
+        STORAGE_LOG_ERROR << msg;
+        throw Exception(SERVER_CANNOT_CREATE_FILE, msg);
+    }
+    if (!direct_) {
+        STORAGE_LOG_DEBUG << "O_DIRECT not supported for " << name_ << ", fall back to buffered io";
+    }
+}
+
+DirectIOWriter::~DirectIOWriter() {
+    try {
+        if (buffer_used_ > 0) {
+            Submit();
+        }
+    } catch (std::exception& e) {
+        STORAGE_LOG_ERROR << e.what();
+    }
+
+    int err = 0;
+    while (!pending_.empty()) {
+        int ret = WaitOne();
+        err = (err != 0) ? err : ret;
+    }
+
+    // drop the padding of the tail chunk
+    if (err == 0 && ftruncate(fd_, len_) == -1) {
+        err = errno;
+    }
+    if (!direct_) {
+        fdatasync(fd_);
+        posix_fadvise(fd_, 0, 0, POSIX_FADV_DONTNEED);
+    }
+    close(fd_);
+
+    if (err != 0) {
+        STORAGE_LOG_ERROR << "Failed to write file " << name_ << ": " << strerror(err);
+    }
+}
+
+void
+DirectIOWriter::write(void* ptr, size_t size) {
+    auto src = static_cast<uint8_t*>(ptr);
+    while (size > 0) {
+        if (buffer_ == nullptr) {
+            buffer_ = AllocAlignedBuffer(DIRECT_IO_CHUNK_SIZE);
+            if (buffer_ == nullptr) {
+                throw std::bad_alloc();
+            }
+            buffer_used_ = 0;
+        }
+
+        size_t n = std::min(size, DIRECT_IO_CHUNK_SIZE - buffer_used_);
+        memcpy(buffer_.get() + buffer_used_, src, n);
+        buffer_used_ += n;
+        src += n;
+        size -= n;
+        len_ += n;
+
+        if (buffer_used_ == DIRECT_IO_CHUNK_SIZE) {
+            Submit();
+        }
+    }
+}
+
+size_t
+DirectIOWriter::length() {
+    return len_;
+}
+
+void
+DirectIOWriter::Submit() {
+    while (pending_.size() >= MAX_PENDING_CHUNKS) {
+        int err = WaitOne();
+        if (err != 0) {
+            std::string msg = "Failed to write file " + name_ + ": " + strerror(err);
+            STORAGE_LOG_ERROR << msg;
+            throw Exception(SERVER_WRITE_ERROR, msg);
+        }
+    }
+
+    // O_DIRECT requires whole blocks, pad the tail with zeros
+    size_t bytes = direct_ ? AlignUp(buffer_used_) : buffer_used_;
+    memset(buffer_.get() + buffer_used_, 0, bytes - buffer_used_);
+
+    auto buffer = buffer_;
+    int fd = fd_;
+    size_t offset = buffer_offset_;
+    pending_.emplace_back(DirectIOThreadPool().enqueue(
+        [fd, buffer, bytes, offset]() { return WriteFully(fd, buffer.get(), bytes, offset); }));
+
+    buffer_offset_ += buffer_used_;
+    buffer_ = nullptr;
+    buffer_used_ = 0;
+}
+
+int
+DirectIOWriter::WaitOne() {
+    int err = pending_.front().get();
+    pending_.pop_front();
+    return err;
+}
+
+}  // namespace storage
+}  // namespace milvus
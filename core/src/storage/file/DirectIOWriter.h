@@ -0,0 +1,60 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <future>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "storage/IOWriter.h"
+
+namespace milvus {
+namespace storage {
+
+/*
+ * Writes a file bypassing the page cache, so large index and segment files don't evict hot pages.
+ * Data is staged in aligned chunks which are written by the direct io thread pool while the caller fills
+ * the next one, the unaligned tail is padded and the file truncated to its real length on destruction.
+ * Write errors are thrown as milvus::Exception from write(), errors of the last chunks can only be logged.
+ */
+class DirectIOWriter : public IOWriter {
+ public:
+    explicit DirectIOWriter(const std::string& name);
+    ~DirectIOWriter();
+
+    void
+    write(void* ptr, size_t size) override;
+
+    size_t
+    length() override;
+
+ private:
+    void
+    Submit();
+
+    // wait for the oldest chunk in flight, errno of the failed write or 0
+    int
+    WaitOne();
+
+ private:
+    int fd_ = -1;
+    bool direct_ = false;
+
+    std::shared_ptr<uint8_t> buffer_;
+    size_t buffer_used_ = 0;
+    size_t buffer_offset_ = 0;  // file offset of buffer_
+    std::list<std::future<int>> pending_;
+};
+
+}  // namespace storage
+}  // namespace milvus
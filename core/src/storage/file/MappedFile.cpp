@@ -0,0 +1,58 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "storage/file/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "utils/Log.h"
+
+namespace milvus {
+namespace storage {
+
+MappedFile::~MappedFile() {
+    munmap(data_, size_);
+}
+
+std::shared_ptr<MappedFile>
+MappedFile::Map(const std::string& name) {
+    int fd = open(name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        STORAGE_LOG_ERROR << "Failed to open " << name << ": " << strerror(errno);
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    // private writable mapping: pages are shared with page cache until written, an index touching its
+    // buffers gets a private copy instead of a fault
+    void* addr = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        STORAGE_LOG_ERROR << "Failed to mmap " << name << ": " << strerror(errno);
+        return nullptr;
+    }
+
+    return std::shared_ptr<MappedFile>(new MappedFile(static_cast<uint8_t*>(addr), st.st_size));
+}
+
+}  // namespace storage
+}  // namespace milvus
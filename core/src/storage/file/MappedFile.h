@@ -0,0 +1,54 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace milvus {
+namespace storage {
+
+/*
+ * Read-only private mapping of a whole file. Pages are loaded on first access and evicted by the os
+ * like any page cache, memory handed out from the mapping stays valid as long as the MappedFile lives.
+ */
+class MappedFile {
+ public:
+    ~MappedFile();
+
+    // nullptr if the file can't be opened or mapped
+    static std::shared_ptr<MappedFile>
+    Map(const std::string& name);
+
+    uint8_t*
+    data() const {
+        return data_;
+    }
+
+    size_t
+    size() const {
+        return size_;
+    }
+
+ private:
+    MappedFile(uint8_t* data, size_t size) : data_(data), size_(size) {
+    }
+
+ private:
+    uint8_t* data_;
+    size_t size_;
+};
+
+using MappedFilePtr = std::shared_ptr<MappedFile>;
+
+}  // namespace storage
+}  // namespace milvus
@@ -9,7 +9,11 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <cstdio>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
 
 #include <aws/core/Aws.h>
@@ -18,11 +22,16 @@
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/s3/S3Client.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
 #include <aws/s3/model/CreateBucketRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/PutObjectRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
 
 namespace milvus {
 namespace storage {
@@ -30,7 +39,8 @@ namespace storage {
 /*
  * This is a class that represents a S3 Client which is used to mimic the put/get operations of a actual s3 client.
  * During a put object, the body of the request is stored as well as the metadata of the request. This data is then
- * populated into a get object result when a get operation is called.
+ * populated into a get object result when a get operation is called. Ranged gets and multipart uploads are
+ * supported, operations may be called concurrently.
  */
 class S3ClientMock : public Aws::S3::S3Client {
  public:
@@ -54,7 +64,10 @@ class S3ClientMock : public Aws::S3::S3Client {
     PutObject(const Aws::S3::Model::PutObjectRequest& request) const override {
         Aws::String key = request.GetKey();
         std::shared_ptr<Aws::IOStream> body = request.GetBody();
-        aws_map_[key] = body;
+        Aws::String body_str((Aws::IStreamBufIterator(*body)), Aws::IStreamBufIterator());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        aws_map_[key] = body_str;
 
         Aws::S3::Model::PutObjectResult result;
         return Aws::S3::Model::PutObjectOutcome(std::move(result));
@@ -66,8 +79,20 @@ class S3ClientMock : public Aws::S3::S3Client {
         Aws::Utils::Stream::ResponseStream resp_stream(factory);
 
         try {
-            std::shared_ptr<Aws::IOStream> body = aws_map_.at(request.GetKey());
-            Aws::String body_str((Aws::IStreamBufIterator(*body)), Aws::IStreamBufIterator());
+            Aws::String body_str;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                body_str = aws_map_.at(request.GetKey());
+            }
+            if (request.RangeHasBeenSet()) {
+                // "bytes=<first>-<last>"
+                size_t first = 0, last = 0;
+                if (sscanf(request.GetRange().c_str(), "bytes=%zu-%zu", &first, &last) != 2 || first > last ||
+                    first >= body_str.length()) {
+                    return Aws::S3::Model::GetObjectOutcome();
+                }
+                body_str = body_str.substr(first, last - first + 1);
+            }
 
             resp_stream.GetUnderlyingStream().write(body_str.c_str(), body_str.length());
             resp_stream.GetUnderlyingStream().flush();
@@ -92,13 +117,86 @@ class S3ClientMock : public Aws::S3::S3Client {
     Aws::S3::Model::DeleteObjectOutcome
     DeleteObject(const Aws::S3::Model::DeleteObjectRequest& request) const override {
         Aws::String key = request.GetKey();
+        std::lock_guard<std::mutex> lock(mutex_);
         aws_map_.erase(key);
         Aws::S3::Model::DeleteObjectResult result;
         Aws::S3::Model::DeleteObjectOutcome(std::move(result));
         return result;
     }
 
-    mutable Aws::Map<Aws::String, std::shared_ptr<Aws::IOStream>> aws_map_;
+    Aws::S3::Model::HeadObjectOutcome
+    HeadObject(const Aws::S3::Model::HeadObjectRequest& request) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = aws_map_.find(request.GetKey());
+        if (iter == aws_map_.end()) {
+            return Aws::S3::Model::HeadObjectOutcome();
+        }
+        Aws::S3::Model::HeadObjectResult result;
+        result.SetContentLength(iter->second.length());
+        return Aws::S3::Model::HeadObjectOutcome(std::move(result));
+    }
+
+    Aws::S3::Model::CreateMultipartUploadOutcome
+    CreateMultipartUpload(const Aws::S3::Model::CreateMultipartUploadRequest& request) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Aws::String upload_id = std::to_string(++upload_count_);
+        uploads_[upload_id].clear();
+
+        Aws::S3::Model::CreateMultipartUploadResult result;
+        result.SetUploadId(upload_id);
+        return Aws::S3::Model::CreateMultipartUploadOutcome(std::move(result));
+    }
+
+    Aws::S3::Model::UploadPartOutcome
+    UploadPart(const Aws::S3::Model::UploadPartRequest& request) const override {
+        std::shared_ptr<Aws::IOStream> body = request.GetBody();
+        Aws::String body_str((Aws::IStreamBufIterator(*body)), Aws::IStreamBufIterator());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = uploads_.find(request.GetUploadId());
+        if (iter == uploads_.end()) {
+            return Aws::S3::Model::UploadPartOutcome();
+        }
+        iter->second[request.GetPartNumber()] = body_str;
+
+        Aws::S3::Model::UploadPartResult result;
+        result.SetETag(std::to_string(request.GetPartNumber()));
+        return Aws::S3::Model::UploadPartOutcome(std::move(result));
+    }
+
+    Aws::S3::Model::CompleteMultipartUploadOutcome
+    CompleteMultipartUpload(const Aws::S3::Model::CompleteMultipartUploadRequest& request) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = uploads_.find(request.GetUploadId());
+        if (iter == uploads_.end()) {
+            return Aws::S3::Model::CompleteMultipartUploadOutcome();
+        }
+
+        // parts are concatenated in part number order
+        Aws::String body_str;
+        for (auto& part : iter->second) {
+            body_str += part.second;
+        }
+        aws_map_[request.GetKey()] = body_str;
+        uploads_.erase(iter);
+
+        Aws::S3::Model::CompleteMultipartUploadResult result;
+        return Aws::S3::Model::CompleteMultipartUploadOutcome(std::move(result));
+    }
+
+    Aws::S3::Model::AbortMultipartUploadOutcome
+    AbortMultipartUpload(const Aws::S3::Model::AbortMultipartUploadRequest& request) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uploads_.erase(request.GetUploadId());
+
+        Aws::S3::Model::AbortMultipartUploadResult result;
+        return Aws::S3::Model::AbortMultipartUploadOutcome(std::move(result));
+    }
+
+    mutable std::mutex mutex_;
+    mutable Aws::Map<Aws::String, Aws::String> aws_map_;
+    mutable Aws::Map<Aws::String, std::map<int, Aws::String>> uploads_;  // upload id -> part number -> content
+    mutable int64_t upload_count_ = 0;
 };
 
 }  // namespace storage
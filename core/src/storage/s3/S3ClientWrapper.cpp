@@ -10,27 +10,74 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/CompletedMultipartUpload.h>
+#include <aws/s3/model/CompletedPart.h>
 #include <aws/s3/model/CreateBucketRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/ListObjectsRequest.h>
 #include <aws/s3/model/PutObjectRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
 #include <fiu-local.h>
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "server/Config.h"
 #include "storage/s3/S3ClientMock.h"
 #include "storage/s3/S3ClientWrapper.h"
+#include "storage/s3/S3DiskCache.h"
 #include "utils/Error.h"
 #include "utils/Log.h"
 
 namespace milvus {
 namespace storage {
 
+namespace {
+
+// run task(0) .. task(count - 1) on at most S3_MAX_PARALLEL_PARTS threads, stop at the first failure
+Status
+RunParallel(size_t count, const std::function<Status(size_t)>& task) {
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::mutex result_mutex;
+    Status result = Status::OK();
+
+    auto worker = [&]() {
+        for (size_t i = next++; i < count && !failed; i = next++) {
+            auto status = task(i);
+            if (!status.ok()) {
+                std::lock_guard<std::mutex> lock(result_mutex);
+                if (!failed.exchange(true)) {
+                    result = status;
+                }
+            }
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    for (size_t i = 1; i < std::min(count, S3_MAX_PARALLEL_PARTS); ++i) {
+        futures.emplace_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.wait();
+    }
+    return result;
+}
+
+}  // namespace
+
 Status
 S3ClientWrapper::StartService() {
     server::Config& config = server::Config::GetInstance();
@@ -48,6 +95,15 @@ S3ClientWrapper::StartService() {
     CONFIG_CHECK(config.GetStorageConfigS3SecretKey(s3_secret_key_));
     CONFIG_CHECK(config.GetStorageConfigS3Bucket(s3_bucket_));
 
+    std::string cache_path;
+    int64_t cache_capacity = 0;
+    CONFIG_CHECK(config.GetStorageConfigS3CachePath(cache_path));
+    CONFIG_CHECK(config.GetStorageConfigS3CacheCapacity(cache_capacity));
+    auto status = S3DiskCache::GetInstance().Init(cache_path, cache_capacity * 1024 * 1024 * 1024);
+    if (!status.ok()) {
+        return status;
+    }
+
     Aws::InitAPI(options_);
 
     Aws::Client::ClientConfiguration cfg;
@@ -125,6 +181,20 @@ S3ClientWrapper::PutObjectFile(const std::string& object_name, const std::string
         return Status(SERVER_UNEXPECTED_ERROR, str);
     }
 
+    if (static_cast<size_t>(buffer.st_size) > S3_PART_SIZE) {
+        auto part_reader = [&](size_t offset, size_t length, std::string& part) {
+            std::ifstream input(file_path, std::ios::binary);
+            input.seekg(offset);
+            part.resize(length);
+            input.read(&part[0], length);
+            if (!input) {
+                return Status(SERVER_UNEXPECTED_ERROR, "Failed to read '" + file_path + "'");
+            }
+            return Status::OK();
+        };
+        return PutObjectMultipart(object_name, buffer.st_size, part_reader);
+    }
+
     Aws::S3::Model::PutObjectRequest request;
     request.WithBucket(s3_bucket_).WithKey(object_name);
 
@@ -147,6 +217,14 @@ S3ClientWrapper::PutObjectFile(const std::string& object_name, const std::string
 
 Status
 S3ClientWrapper::PutObjectStr(const std::string& object_name, const std::string& content) {
+    if (content.length() > S3_PART_SIZE) {
+        auto part_reader = [&](size_t offset, size_t length, std::string& part) {
+            part = content.substr(offset, length);
+            return Status::OK();
+        };
+        return PutObjectMultipart(object_name, content.length(), part_reader);
+    }
+
     Aws::S3::Model::PutObjectRequest request;
     request.WithBucket(s3_bucket_).WithKey(object_name);
 
@@ -259,6 +337,8 @@ S3ClientWrapper::DeleteObject(const std::string& object_name) {
         return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
     }
 
+    S3DiskCache::GetInstance().Erase(object_name);
+
     STORAGE_LOG_DEBUG << "DeleteObject '" << object_name << "' successfully!";
     return Status::OK();
 }
@@ -282,5 +362,129 @@ S3ClientWrapper::DeleteObjects(const std::string& marker) {
     return Status::OK();
 }
 
+Status
+S3ClientWrapper::GetObjectSize(const std::string& object_name, size_t& size) {
+    Aws::S3::Model::HeadObjectRequest request;
+    request.WithBucket(s3_bucket_).WithKey(object_name);
+
+    auto outcome = client_ptr_->HeadObject(request);
+
+    fiu_do_on("S3ClientWrapper.GetObjectSize.outcome.fail", outcome = Aws::S3::Model::HeadObjectOutcome());
+    if (!outcome.IsSuccess()) {
+        auto err = outcome.GetError();
+        STORAGE_LOG_ERROR << "ERROR: HeadObject: " << err.GetExceptionName() << ": " << err.GetMessage();
+        return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
+    }
+
+    size = outcome.GetResult().GetContentLength();
+    return Status::OK();
+}
+
+Status
+S3ClientWrapper::GetObjectRange(const std::string& object_name, size_t offset, size_t length, char* data) {
+    Aws::S3::Model::GetObjectRequest request;
+    request.WithBucket(s3_bucket_).WithKey(object_name);
+    request.WithRange("bytes=" + std::to_string(offset) + "-" + std::to_string(offset + length - 1));
+
+    auto outcome = client_ptr_->GetObject(request);
+
+    fiu_do_on("S3ClientWrapper.GetObjectRange.outcome.fail", outcome = Aws::S3::Model::GetObjectOutcome());
+    if (!outcome.IsSuccess()) {
+        auto err = outcome.GetError();
+        STORAGE_LOG_ERROR << "ERROR: GetObject: " << err.GetExceptionName() << ": " << err.GetMessage();
+        return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
+    }
+
+    auto& retrieved_file = outcome.GetResultWithOwnership().GetBody();
+    retrieved_file.read(data, length);
+    if (retrieved_file.gcount() != static_cast<std::streamsize>(length)) {
+        std::string str = "Object '" + object_name + "' is shorter than requested range";
+        STORAGE_LOG_ERROR << "ERROR: " << str;
+        return Status(SERVER_UNEXPECTED_ERROR, str);
+    }
+
+    return Status::OK();
+}
+
+Status
+S3ClientWrapper::GetObjectRanges(const std::string& object_name,
+                                 const std::vector<std::pair<size_t, size_t>>& ranges, char* data) {
+    return RunParallel(ranges.size(), [&](size_t i) {
+        return GetObjectRange(object_name, ranges[i].first, ranges[i].second, data + ranges[i].first);
+    });
+}
+
+Status
+S3ClientWrapper::PutObjectMultipart(const std::string& object_name, size_t size, const PartReader& part_reader) {
+    Aws::S3::Model::CreateMultipartUploadRequest create_request;
+    create_request.WithBucket(s3_bucket_).WithKey(object_name);
+
+    auto create_outcome = client_ptr_->CreateMultipartUpload(create_request);
+
+    fiu_do_on("S3ClientWrapper.PutObjectMultipart.outcome.fail",
+              create_outcome = Aws::S3::Model::CreateMultipartUploadOutcome());
+    if (!create_outcome.IsSuccess()) {
+        auto err = create_outcome.GetError();
+        STORAGE_LOG_ERROR << "ERROR: CreateMultipartUpload: " << err.GetExceptionName() << ": " << err.GetMessage();
+        return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
+    }
+    auto upload_id = create_outcome.GetResult().GetUploadId();
+
+    size_t part_count = (size + S3_PART_SIZE - 1) / S3_PART_SIZE;
+    Aws::Vector<Aws::S3::Model::CompletedPart> parts(part_count);
+    auto upload_part = [&](size_t i) {
+        size_t offset = i * S3_PART_SIZE;
+        size_t length = std::min(S3_PART_SIZE, size - offset);
+        std::string content;
+        auto status = part_reader(offset, length, content);
+        if (!status.ok()) {
+            return status;
+        }
+
+        Aws::S3::Model::UploadPartRequest request;
+        request.WithBucket(s3_bucket_).WithKey(object_name).WithUploadId(upload_id);
+        request.WithPartNumber(i + 1).WithContentLength(length);
+
+        auto input_data = Aws::MakeShared<Aws::StringStream>("UploadPart");
+        input_data->write(content.data(), length);
+        request.SetBody(input_data);
+
+        auto outcome = client_ptr_->UploadPart(request);
+        if (!outcome.IsSuccess()) {
+            auto err = outcome.GetError();
+            STORAGE_LOG_ERROR << "ERROR: UploadPart: " << err.GetExceptionName() << ": " << err.GetMessage();
+            return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
+        }
+
+        parts[i].WithETag(outcome.GetResult().GetETag()).WithPartNumber(i + 1);
+        return Status::OK();
+    };
+
+    auto status = RunParallel(part_count, upload_part);
+    if (!status.ok()) {
+        // drop uploaded parts, they are billed until the upload is aborted
+        Aws::S3::Model::AbortMultipartUploadRequest abort_request;
+        abort_request.WithBucket(s3_bucket_).WithKey(object_name).WithUploadId(upload_id);
+        client_ptr_->AbortMultipartUpload(abort_request);
+        return status;
+    }
+
+    Aws::S3::Model::CompletedMultipartUpload completed_upload;
+    completed_upload.SetParts(parts);
+    Aws::S3::Model::CompleteMultipartUploadRequest complete_request;
+    complete_request.WithBucket(s3_bucket_).WithKey(object_name).WithUploadId(upload_id);
+    complete_request.WithMultipartUpload(completed_upload);
+
+    auto complete_outcome = client_ptr_->CompleteMultipartUpload(complete_request);
+    if (!complete_outcome.IsSuccess()) {
+        auto err = complete_outcome.GetError();
+        STORAGE_LOG_ERROR << "ERROR: CompleteMultipartUpload: " << err.GetExceptionName() << ": " << err.GetMessage();
+        return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
+    }
+
+    STORAGE_LOG_DEBUG << "PutObjectMultipart '" << object_name << "' in " << part_count << " parts successfully!";
+    return Status::OK();
+}
+
 }  // namespace storage
 }  // namespace milvus
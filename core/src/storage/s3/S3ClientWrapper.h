@@ -14,13 +14,20 @@
 #include <aws/core/Aws.h>
 #include <aws/s3/S3Client.h>
 #include <memory>
+#include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 #include "storage/IStorage.h"
 
 namespace milvus {
 namespace storage {
 
+// objects are read by ranged GETs and written by multipart uploads of this part size, parts are transferred
+// concurrently by at most S3_MAX_PARALLEL_PARTS connections
+static constexpr size_t S3_PART_SIZE = 8 * 1024 * 1024;
+static constexpr size_t S3_MAX_PARALLEL_PARTS = 8;
+
 class S3ClientWrapper : public IStorage {
  public:
     static S3ClientWrapper&
@@ -53,6 +60,21 @@ class S3ClientWrapper : public IStorage {
     Status
     DeleteObjects(const std::string& marker) override;
 
+    Status
+    GetObjectSize(const std::string& object_name, size_t& size);
+    Status
+    GetObjectRange(const std::string& object_name, size_t offset, size_t length, char* data);
+    // fetch ranges of <offset, length> concurrently, each into data + offset
+    Status
+    GetObjectRanges(const std::string& object_name, const std::vector<std::pair<size_t, size_t>>& ranges, char* data);
+
+ private:
+    using PartReader = std::function<Status(size_t offset, size_t length, std::string& part)>;
+
+    // upload an object of size bytes part by part, part_reader fills the content of a part
+    Status
+    PutObjectMultipart(const std::string& object_name, size_t size, const PartReader& part_reader);
+
  private:
     std::shared_ptr<Aws::S3::S3Client> client_ptr_;
     Aws::SDKOptions options_;
@@ -0,0 +1,222 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "storage/s3/S3DiskCache.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "utils/CommonUtil.h"
+#include "utils/Error.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace storage {
+
+namespace {
+
+const char* TEMP_SUFFIX = ".tmp";
+
+// object names are paths, escape them into flat file names
+std::string
+EscapeName(const std::string& name) {
+    static const char* hex = "0123456789ABCDEF";
+    std::string escaped;
+    for (unsigned char c : name) {
+        if (isalnum(c) || c == '.' || c == '_' || c == '-') {
+            escaped += c;
+        } else {
+            escaped += '%';
+            escaped += hex[c >> 4];
+            escaped += hex[c & 0xF];
+        }
+    }
+    return escaped;
+}
+
+bool
+UnescapeName(const std::string& escaped, std::string& name) {
+    name.clear();
+    for (size_t i = 0; i < escaped.size(); ++i) {
+        if (escaped[i] != '%') {
+            name += escaped[i];
+            continue;
+        }
+        if (i + 2 >= escaped.size() || !isxdigit(escaped[i + 1]) || !isxdigit(escaped[i + 2])) {
+            return false;
+        }
+        name += static_cast<char>(std::stoi(escaped.substr(i + 1, 2), nullptr, 16));
+        i += 2;
+    }
+    return true;
+}
+
+}  // namespace
+
+Status
+S3DiskCache::Init(const std::string& path, int64_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_ = path;
+    capacity_ = capacity;
+    usage_ = 0;
+    lru_.clear();
+    entries_.clear();
+    if (path_.empty()) {
+        return Status::OK();
+    }
+
+    auto status = server::CommonUtil::CreateDirectory(path_);
+    if (!status.ok()) {
+        return status;
+    }
+
+    DIR* dir = opendir(path_.c_str());
+    if (dir == nullptr) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Failed to open s3 cache path " + path_);
+    }
+
+    // <mtime, object name, size>, oldest first
+    std::vector<std::tuple<time_t, std::string, int64_t>> files;
+    while (auto entry = readdir(dir)) {
+        std::string file_name = entry->d_name;
+        std::string file_path = path_ + "/" + file_name;
+        struct stat st;
+        if (stat(file_path.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+
+        std::string object_name;
+        bool temp = file_name.size() > strlen(TEMP_SUFFIX) &&
+                    file_name.compare(file_name.size() - strlen(TEMP_SUFFIX), strlen(TEMP_SUFFIX), TEMP_SUFFIX) == 0;
+        if (temp || !UnescapeName(file_name, object_name)) {
+            // left by an interrupted put
+            std::remove(file_path.c_str());
+            continue;
+        }
+        files.emplace_back(st.st_mtime, object_name, st.st_size);
+    }
+    closedir(dir);
+
+    std::sort(files.begin(), files.end());
+    for (auto& file : files) {
+        Insert(std::get<1>(file), std::get<2>(file));
+    }
+
+    STORAGE_LOG_INFO << "S3 disk cache " << path_ << " loaded " << entries_.size() << " objects, " << usage_
+                     << " bytes";
+    return Status::OK();
+}
+
+bool
+S3DiskCache::Get(const std::string& object_name, std::string& file_path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(object_name);
+    if (iter == entries_.end()) {
+        return false;
+    }
+    lru_.splice(lru_.begin(), lru_, iter->second.first);
+    file_path = FilePath(object_name);
+    return true;
+}
+
+void
+S3DiskCache::Put(const std::string& object_name, const char* data, size_t size) {
+    if (!Enabled() || static_cast<int64_t>(size) > capacity_) {
+        return;
+    }
+
+    // write aside then rename, a reader never sees a partial file
+    std::stringstream ss;
+    ss << FilePath(object_name) << "." << std::this_thread::get_id() << TEMP_SUFFIX;
+    std::string temp_path = ss.str();
+    {
+        std::ofstream output(temp_path, std::ios::binary | std::ios::trunc);
+        output.write(data, size);
+        if (!output) {
+            STORAGE_LOG_WARNING << "Failed to write s3 cache file " << temp_path;
+            output.close();
+            std::remove(temp_path.c_str());
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (rename(temp_path.c_str(), FilePath(object_name).c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return;
+    }
+    Insert(object_name, size);
+}
+
+void
+S3DiskCache::Erase(const std::string& object_name) {
+    if (!Enabled()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.find(object_name) != entries_.end()) {
+        Remove(object_name);
+    }
+}
+
+int64_t
+S3DiskCache::Usage() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return usage_;
+}
+
+std::string
+S3DiskCache::FilePath(const std::string& object_name) const {
+    return path_ + "/" + EscapeName(object_name);
+}
+
+void
+S3DiskCache::Insert(const std::string& object_name, int64_t size) {
+    auto iter = entries_.find(object_name);
+    if (iter != entries_.end()) {
+        usage_ -= iter->second.second;
+        lru_.erase(iter->second.first);
+        entries_.erase(iter);
+    }
+
+    lru_.push_front(object_name);
+    entries_[object_name] = std::make_pair(lru_.begin(), size);
+    usage_ += size;
+
+    while (usage_ > capacity_ && lru_.size() > 1) {
+        std::string victim = lru_.back();
+        Remove(victim);
+    }
+}
+
+void
+S3DiskCache::Remove(const std::string& object_name) {
+    auto iter = entries_.find(object_name);
+    std::remove(FilePath(object_name).c_str());
+    usage_ -= iter->second.second;
+    lru_.erase(iter->second.first);
+    entries_.erase(iter);
+}
+
+}  // namespace storage
+}  // namespace milvus
@@ -0,0 +1,81 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "utils/Status.h"
+
+namespace milvus {
+namespace storage {
+
+/*
+ * Bounded local disk tier in front of S3, keyed by object name. Each object is kept as one file under the cache
+ * path, least recently used files are removed once the total size exceeds capacity. Files left by a previous run
+ * are picked up on Init, ordered by modification time.
+ */
+class S3DiskCache {
+ public:
+    static S3DiskCache&
+    GetInstance() {
+        static S3DiskCache cache;
+        return cache;
+    }
+
+    // empty path disables the cache
+    Status
+    Init(const std::string& path, int64_t capacity);
+
+    bool
+    Enabled() const {
+        return !path_.empty();
+    }
+
+    // path of the local copy, false if the object isn't cached
+    bool
+    Get(const std::string& object_name, std::string& file_path);
+
+    void
+    Put(const std::string& object_name, const char* data, size_t size);
+
+    void
+    Erase(const std::string& object_name);
+
+    int64_t
+    Usage();
+
+ private:
+    std::string
+    FilePath(const std::string& object_name) const;
+
+    // caller must hold mutex_
+    void
+    Insert(const std::string& object_name, int64_t size);
+    void
+    Remove(const std::string& object_name);
+
+ private:
+    std::mutex mutex_;
+    std::string path_;
+    int64_t capacity_ = 0;
+    int64_t usage_ = 0;
+
+    std::list<std::string> lru_;  // most recently used first
+    std::unordered_map<std::string, std::pair<std::list<std::string>::iterator, int64_t>> entries_;
+};
+
+}  // namespace storage
+}  // namespace milvus
@@ -10,13 +10,35 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "storage/s3/S3IOReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
 #include "storage/s3/S3ClientWrapper.h"
+#include "storage/s3/S3DiskCache.h"
+#include "utils/Log.h"
 
 namespace milvus {
 namespace storage {
 
 S3IOReader::S3IOReader(const std::string& name) : IOReader(name), pos_(0) {
-    S3ClientWrapper::GetInstance().GetObjectStr(name_, buffer_);
+    std::string file_path;
+    if (S3DiskCache::GetInstance().Get(name_, file_path)) {
+        local_reader_ = std::make_shared<FileIOReader>(file_path);
+        if (local_reader_->fs_.is_open()) {
+            return;
+        }
+        // evicted in between
+        local_reader_ = nullptr;
+    }
+
+    size_t size = 0;
+    if (!S3ClientWrapper::GetInstance().GetObjectSize(name_, size).ok()) {
+        return;
+    }
+    buffer_.resize(size);
+    fetched_.resize((size + S3_PART_SIZE - 1) / S3_PART_SIZE, false);
 }
 
 S3IOReader::~S3IOReader() {
@@ -24,6 +46,14 @@ S3IOReader::~S3IOReader() {
 
 void
 S3IOReader::read(void* ptr, size_t size) {
+    if (local_reader_ != nullptr) {
+        local_reader_->seekg(pos_);
+        local_reader_->read(ptr, size);
+        return;
+    }
+
+    size = std::min(size, buffer_.size() - std::min(pos_, buffer_.size()));
+    FetchParts(pos_, pos_ + size);
     memcpy(ptr, buffer_.data() + pos_, size);
 }
 
@@ -34,8 +64,43 @@ S3IOReader::seekg(size_t pos) {
 
 size_t
 S3IOReader::length() {
+    if (local_reader_ != nullptr) {
+        return local_reader_->length();
+    }
     return buffer_.length();
 }
 
+void
+S3IOReader::FetchParts(size_t begin, size_t end) {
+    if (begin >= end) {
+        return;
+    }
+
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (size_t part = begin / S3_PART_SIZE; part * S3_PART_SIZE < end; ++part) {
+        if (!fetched_[part]) {
+            size_t offset = part * S3_PART_SIZE;
+            ranges.emplace_back(offset, std::min(S3_PART_SIZE, buffer_.size() - offset));
+        }
+    }
+    if (ranges.empty()) {
+        return;
+    }
+
+    auto status = S3ClientWrapper::GetInstance().GetObjectRanges(name_, ranges, &buffer_[0]);
+    if (!status.ok()) {
+        STORAGE_LOG_ERROR << "Failed to read '" << name_ << "': " << status.message();
+        return;
+    }
+
+    for (auto& range : ranges) {
+        fetched_[range.first / S3_PART_SIZE] = true;
+    }
+    fetched_count_ += ranges.size();
+    if (fetched_count_ == fetched_.size()) {
+        S3DiskCache::GetInstance().Put(name_, buffer_.data(), buffer_.size());
+    }
+}
+
 }  // namespace storage
 }  // namespace milvus
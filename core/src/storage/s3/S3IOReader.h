@@ -11,12 +11,20 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 #include "storage/IOReader.h"
+#include "storage/file/FileIOReader.h"
 
 namespace milvus {
 namespace storage {
 
+/*
+ * Reads an object from the local disk cache if it is there. Otherwise only the parts covering each read are
+ * fetched by ranged GETs, missing parts of a read are fetched concurrently. Once every part is fetched the object
+ * is put into the local disk cache.
+ */
 class S3IOReader : public IOReader {
  public:
     explicit S3IOReader(const std::string& name);
@@ -31,9 +39,19 @@ class S3IOReader : public IOReader {
     size_t
     length() override;
 
+ private:
+    // make sure parts covering [begin, end) are in buffer_
+    void
+    FetchParts(size_t begin, size_t end);
+
  public:
     std::string buffer_;
     size_t pos_;
+
+ private:
+    std::shared_ptr<FileIOReader> local_reader_;
+    std::vector<bool> fetched_;
+    size_t fetched_count_ = 0;
 };
 
 }  // namespace storage
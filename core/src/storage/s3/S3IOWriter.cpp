@@ -11,6 +11,7 @@
 
 #include "storage/s3/S3IOWriter.h"
 #include "storage/s3/S3ClientWrapper.h"
+#include "storage/s3/S3DiskCache.h"
 
 namespace milvus {
 namespace storage {
@@ -20,7 +21,11 @@ S3IOWriter::S3IOWriter(const std::string& name) : IOWriter(name) {
 }
 
 S3IOWriter::~S3IOWriter() {
-    S3ClientWrapper::GetInstance().PutObjectStr(name_, buffer_);
+    auto status = S3ClientWrapper::GetInstance().PutObjectStr(name_, buffer_);
+    if (status.ok()) {
+        // a just written index is usually loaded soon after
+        S3DiskCache::GetInstance().Put(name_, buffer_.data(), buffer_.size());
+    }
 }
 
 void
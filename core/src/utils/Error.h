@@ -82,6 +82,9 @@ constexpr ErrorCode SERVER_INVALID_INDEX_METRIC_TYPE = ToServerErrorCode(115);
 constexpr ErrorCode SERVER_INVALID_INDEX_FILE_SIZE = ToServerErrorCode(116);
 constexpr ErrorCode SERVER_OUT_OF_MEMORY = ToServerErrorCode(117);
 constexpr ErrorCode SERVER_INVALID_PARTITION_TAG = ToServerErrorCode(118);
+constexpr ErrorCode SERVER_DEADLINE_EXCEEDED = ToServerErrorCode(119);
+constexpr ErrorCode SERVER_REQUEST_CANCELLED = ToServerErrorCode(120);
+constexpr ErrorCode SERVER_REQUEST_REJECTED = ToServerErrorCode(121);
 
 // db error code
 constexpr ErrorCode DB_META_TRANSACTION_FAILED = ToDbErrorCode(1);
@@ -11,7 +11,9 @@
 
 #include "utils/ValidationUtil.h"
 #include "Log.h"
+#include "db/engine/AttrFilter.h"
 #include "db/engine/ExecutionEngine.h"
+#include "db/engine/SegmentPruner.h"
 #include "index/knowhere/knowhere/index/vector_index/helpers/IndexParameter.h"
 #include "utils/StringHelpFunctions.h"
 
@@ -261,6 +263,45 @@ ValidationUtil::ValidateSearchParams(const milvus::json& search_params, const en
             break;
         }
     }
+
+    if (search_params.contains(engine::RANGE_RADIUS_KEY) && !search_params[engine::RANGE_RADIUS_KEY].is_number()) {
+        std::string msg = "Invalid search params: radius must be a number.";
+        SERVER_LOG_ERROR << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    if (search_params.contains(engine::RERANK_KEY)) {
+        auto& factor = search_params[engine::RERANK_KEY];
+        if (!factor.is_number_integer() || factor.get<int64_t>() < 1 || factor.get<int64_t>() > 64) {
+            std::string msg = "Invalid search params: rerank must be an integer within the range of 1 ~ 64.";
+            SERVER_LOG_ERROR << msg;
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+
+    if (search_params.contains(engine::SEGMENT_FRACTION_KEY)) {
+        auto& fraction = search_params[engine::SEGMENT_FRACTION_KEY];
+        if (!fraction.is_number() || fraction.get<double>() <= 0 || fraction.get<double>() > 1) {
+            std::string msg = "Invalid search params: segment_fraction must be a number within the range of (0, 1].";
+            SERVER_LOG_ERROR << msg;
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+
+    if (search_params.contains(engine::ATTR_FILTER_KEY)) {
+        if (!search_params[engine::ATTR_FILTER_KEY].is_string()) {
+            std::string msg = "Invalid search params: filter expression must be a string.";
+            SERVER_LOG_ERROR << msg;
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+
+        engine::AttrFilterPtr filter;
+        auto status = engine::AttrFilter::Parse(search_params[engine::ATTR_FILTER_KEY].get<std::string>(), filter);
+        if (!status.ok()) {
+            SERVER_LOG_ERROR << status.message();
+            return Status(SERVER_INVALID_ARGUMENT, status.message());
+        }
+    }
     return Status::OK();
 }
 
@@ -289,10 +330,11 @@ ValidationUtil::ValidateTableIndexMetricType(int32_t metric_type) {
 }
 
 Status
-ValidationUtil::ValidateSearchTopk(int64_t top_k, const engine::meta::TableSchema& table_schema) {
-    if (top_k <= 0 || top_k > 2048) {
-        std::string msg =
-            "Invalid topk: " + std::to_string(top_k) + ". " + "The topk must be within the range of 1 ~ 2048.";
+ValidationUtil::ValidateSearchTopk(int64_t top_k, const engine::meta::TableSchema& table_schema, bool range_search) {
+    int64_t max_k = range_search ? engine::RANGE_SEARCH_MAX_K : 2048;
+    if (top_k <= 0 || top_k > max_k) {
+        std::string msg = "Invalid topk: " + std::to_string(top_k) + ". " +
+                          "The topk must be within the range of 1 ~ " + std::to_string(max_k) + ".";
         SERVER_LOG_ERROR << msg;
         return Status(SERVER_INVALID_TOPK, msg);
     }
@@ -361,6 +403,33 @@ ValidationUtil::ValidatePartitionTags(const std::vector<std::string>& partition_
     return Status::OK();
 }
 
+Status
+ValidationUtil::ValidateAttrs(const segment::Attrs& attrs, int64_t vector_count) {
+    for (auto& pair : attrs.attrs) {
+        auto& name = pair.first;
+        bool valid_name = !name.empty() && name.size() <= TABLE_NAME_SIZE_LIMIT &&
+                          (name[0] == '_' || std::isalpha(name[0]) != 0);
+        for (size_t i = 1; valid_name && i < name.size(); ++i) {
+            valid_name = (name[i] == '_' || std::isalnum(name[i]) != 0);
+        }
+        if (!valid_name) {
+            std::string msg = "Invalid attribute name: " + name + ". " +
+                              "Attribute name can only contain numbers, letters, and underscores, " +
+                              "and must start with an underscore or letter.";
+            SERVER_LOG_ERROR << msg;
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+
+        if (static_cast<int64_t>(pair.second->GetCount()) != vector_count) {
+            std::string msg = "The size of attribute " + name + " must be equal to the size of the vector.";
+            SERVER_LOG_ERROR << msg;
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+
+    return Status::OK();
+}
+
 Status
 ValidationUtil::ValidateGpuIndex(int32_t gpu_index) {
 #ifdef MILVUS_GPU_VERSION
@@ -488,7 +557,8 @@ ValidationUtil::ValidateDbURI(const std::string& uri) {
     if (std::regex_match(uri, pieces_match, uriRegex)) {
         std::string dialect = pieces_match[1].str();
         std::transform(dialect.begin(), dialect.end(), dialect.begin(), ::tolower);
-        if (dialect.find("mysql") == std::string::npos && dialect.find("sqlite") == std::string::npos) {
+        if (dialect.find("mysql") == std::string::npos && dialect.find("sqlite") == std::string::npos &&
+            dialect != "kv") {
             SERVER_LOG_ERROR << "Invalid dialect in URI: dialect = " << dialect;
             okay = false;
         }
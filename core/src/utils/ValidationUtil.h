@@ -12,6 +12,7 @@
 #pragma once
 
 #include "db/meta/MetaTypes.h"
+#include "segment/Attrs.h"
 #include "utils/Json.h"
 #include "utils/Status.h"
 
@@ -49,8 +50,9 @@ class ValidationUtil {
     static Status
     ValidateTableIndexMetricType(int32_t metric_type);
 
+    // a range search only limits the results per query, so it allows a larger topk
     static Status
-    ValidateSearchTopk(int64_t top_k, const engine::meta::TableSchema& table_schema);
+    ValidateSearchTopk(int64_t top_k, const engine::meta::TableSchema& table_schema, bool range_search = false);
 
     static Status
     ValidatePartitionName(const std::string& partition_name);
@@ -58,6 +60,9 @@ class ValidationUtil {
     static Status
     ValidatePartitionTags(const std::vector<std::string>& partition_tags);
 
+    static Status
+    ValidateAttrs(const segment::Attrs& attrs, int64_t vector_count);
+
     static Status
     ValidateGpuIndex(int32_t gpu_index);
 
@@ -46,12 +46,21 @@ BinVecImpl::BuildAll(const int64_t& nb, const uint8_t* xb, const int64_t* ids, c
 
 Status
 BinVecImpl::Search(const int64_t& nq, const uint8_t* xq, float* dist, int64_t* ids, const Config& cfg) {
+    return Search(nq, xq, nullptr, dist, ids, cfg);
+}
+
+Status
+BinVecImpl::Search(const int64_t& nq, const uint8_t* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist,
+                   int64_t* ids, const Config& cfg) {
     try {
         int64_t k = cfg[knowhere::meta::TOPK];
         auto ret_ds = std::make_shared<knowhere::Dataset>();
         ret_ds->Set(knowhere::meta::ROWS, nq);
         ret_ds->Set(knowhere::meta::DIM, dim);
         ret_ds->Set(knowhere::meta::TENSOR, xq);
+        if (bitset != nullptr) {
+            ret_ds->Set(knowhere::meta::BITSET, bitset);
+        }
 
         auto res = index_->Search(ret_ds, cfg);
         //{
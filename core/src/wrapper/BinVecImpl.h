@@ -31,6 +31,10 @@ class BinVecImpl : public VecIndexImpl {
     Status
     Search(const int64_t& nq, const uint8_t* xq, float* dist, int64_t* ids, const Config& cfg) override;
 
+    Status
+    Search(const int64_t& nq, const uint8_t* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist, int64_t* ids,
+           const Config& cfg) override;
+
     Status
     Add(const int64_t& nb, const uint8_t* xb, const int64_t* ids, const Config& cfg) override;
 
@@ -119,6 +119,15 @@ IVFConfAdapter::CheckTrain(milvus::json& oricfg) {
     // static int64_t MAX_POINTS_PER_CENTROID = 256;
     // CheckIntByRange(knowhere::meta::ROWS, MIN_POINTS_PER_CENTROID * nlist, MAX_POINTS_PER_CENTROID * nlist);
 
+    // train on a sample instead of the whole segment, see knowhere TrainSampler
+    if (!oricfg.contains(knowhere::IndexParams::train_points_per_centroid)) {
+        int64_t points_per_centroid = 0;
+        server::Config& config = server::Config::GetInstance();
+        if (config.GetEngineConfigTrainPointsPerCentroid(points_per_centroid).ok()) {
+            oricfg[knowhere::IndexParams::train_points_per_centroid] = points_per_centroid;
+        }
+    }
+
     return ConfAdapter::CheckTrain(oricfg);
 }
 
@@ -215,10 +224,14 @@ NSGConfAdapter::CheckTrain(milvus::json& oricfg) {
     static int64_t MIN_CANDIDATE_POOL_SIZE = 50;
     static int64_t MAX_CANDIDATE_POOL_SIZE = 1000;
     static std::vector<std::string> METRICS{knowhere::Metric::L2};
+    static std::vector<std::string> KNNG_BUILDERS{knowhere::KnngBuilder::IVF, knowhere::KnngBuilder::NN_DESCENT};
 
     CheckStrByValues(knowhere::Metric::TYPE, METRICS);
     CheckIntByRange(knowhere::meta::ROWS, DEFAULT_MIN_ROWS, DEFAULT_MAX_ROWS);
     CheckIntByRange(knowhere::IndexParams::knng, MIN_KNNG, MAX_KNNG);
+    if (oricfg.contains(knowhere::IndexParams::knng_builder)) {
+        CheckStrByValues(knowhere::IndexParams::knng_builder, KNNG_BUILDERS);
+    }
     CheckIntByRange(knowhere::IndexParams::search_length, MIN_SEARCH_LENGTH, MAX_SEARCH_LENGTH);
     CheckIntByRange(knowhere::IndexParams::out_degree, MIN_OUT_DEGREE, MAX_OUT_DEGREE);
     CheckIntByRange(knowhere::IndexParams::candidate, MIN_CANDIDATE_POOL_SIZE, MAX_CANDIDATE_POOL_SIZE);
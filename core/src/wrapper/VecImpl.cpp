@@ -15,6 +15,7 @@
 #include "knowhere/adapter/VectorAdapter.h"
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
+#include "knowhere/index/vector_index/IndexIVF.h"
 #include "utils/Log.h"
 #include "wrapper/WrapperException.h"
 #include "wrapper/gpu/GPUVecImpl.h"
@@ -28,6 +29,9 @@
 #endif
 
 #include <fiu-local.h>
+
+#include <algorithm>
+
 /*
  * no parameter check in this layer.
  * only responsible for index combination
@@ -36,6 +40,23 @@
 namespace milvus {
 namespace engine {
 
+namespace {
+
+// cpu index types trained into an IVFIndexModel
+bool
+SupportModelCheckpoint(IndexType type) {
+    return type == IndexType::FAISS_IVFFLAT_CPU || type == IndexType::FAISS_IVFSQ8_CPU ||
+           type == IndexType::FAISS_IVFPQ_CPU;
+}
+
+// cpu index types resuming a build and taking rows in several Add calls
+bool
+SupportResumableBuild(IndexType type) {
+    return SupportModelCheckpoint(type) || type == IndexType::HNSW;
+}
+
+}  // namespace
+
 Status
 VecIndexImpl::BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg, const int64_t& nt,
                        const float* xt) {
@@ -60,6 +81,60 @@ VecIndexImpl::BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, c
     return Status::OK();
 }
 
+Status
+VecIndexImpl::BuildAllResumable(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                                const BuildHooks& hooks) {
+    // subclasses and the other types build in one go
+    if (!SupportResumableBuild(type)) {
+        return VecIndex::BuildAllResumable(nb, xb, ids, cfg, hooks);
+    }
+
+    try {
+        dim = cfg[knowhere::meta::DIM];
+        fiu_do_on("VecIndexImpl.BuildAll.throw_knowhere_exception", throw knowhere::KnowhereException(""));
+        fiu_do_on("VecIndexImpl.BuildAll.throw_std_exception", throw std::exception());
+
+        int64_t added = 0;
+        if (hooks.resume_partial_) {
+            added = index_->Count();
+        } else {
+            auto dataset = GenDatasetWithIds(nb, dim, xb, ids);
+            auto preprocessor = index_->BuildPreprocessor(dataset, cfg);
+            index_->set_preprocessor(preprocessor);
+
+            knowhere::IndexModelPtr model;
+            if (SupportModelCheckpoint(type) && !hooks.model_.binary_map_.empty()) {
+                auto ivf_model = std::make_shared<knowhere::IVFIndexModel>();
+                ivf_model->Load(hooks.model_);
+                model = ivf_model;
+            } else {
+                model = index_->Train(dataset, cfg);
+                if (SupportModelCheckpoint(type) && hooks.trained_) {
+                    hooks.trained_(model->Serialize());
+                }
+            }
+            index_->set_index_model(model);
+        }
+
+        while (added < nb) {
+            int64_t rows = std::min(std::max(hooks.batch_rows_, (int64_t)1), nb - added);
+            auto dataset = GenDatasetWithIds(rows, dim, xb + added * dim, ids + added);
+            index_->Add(dataset, cfg);
+            added += rows;
+            if (hooks.progress_) {
+                hooks.progress_(added);
+            }
+        }
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
 Status
 VecIndexImpl::Add(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg) {
     try {
@@ -79,9 +154,18 @@ VecIndexImpl::Add(const int64_t& nb, const float* xb, const int64_t* ids, const
 
 Status
 VecIndexImpl::Search(const int64_t& nq, const float* xq, float* dist, int64_t* ids, const Config& cfg) {
+    return Search(nq, xq, nullptr, dist, ids, cfg);
+}
+
+Status
+VecIndexImpl::Search(const int64_t& nq, const float* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist,
+                     int64_t* ids, const Config& cfg) {
     try {
         int64_t k = cfg[knowhere::meta::TOPK];
         auto dataset = GenDataset(nq, dim, xq);
+        if (bitset != nullptr) {
+            dataset->Set(knowhere::meta::BITSET, bitset);
+        }
 
         fiu_do_on("VecIndexImpl.Search.throw_knowhere_exception", throw knowhere::KnowhereException(""));
         fiu_do_on("VecIndexImpl.Search.throw_std_exception", throw std::exception());
@@ -124,6 +208,38 @@ VecIndexImpl::Search(const int64_t& nq, const float* xq, float* dist, int64_t* i
     return Status::OK();
 }
 
+bool
+VecIndexImpl::SupportRangeSearch() {
+    return index_->SupportRangeSearch();
+}
+
+Status
+VecIndexImpl::RangeSearch(const int64_t& nq, const float* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist,
+                          int64_t* ids, const Config& cfg) {
+    try {
+        int64_t k = cfg[knowhere::meta::TOPK];
+        auto dataset = GenDataset(nq, dim, xq);
+        if (bitset != nullptr) {
+            dataset->Set(knowhere::meta::BITSET, bitset);
+        }
+
+        auto res = index_->RangeSearch(dataset, cfg);
+        auto res_ids = res->Get<int64_t*>(knowhere::meta::IDS);
+        auto res_dist = res->Get<float*>(knowhere::meta::DISTANCE);
+        memcpy(ids, res_ids, sizeof(int64_t) * nq * k);
+        memcpy(dist, res_dist, sizeof(float) * nq * k);
+        free(res_ids);
+        free(res_dist);
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
 knowhere::BinarySet
 VecIndexImpl::Serialize() {
     type = ConvertToCpuIndexType(type);
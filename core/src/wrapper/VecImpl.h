@@ -31,6 +31,10 @@ class VecIndexImpl : public VecIndex {
     BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg, const int64_t& nt,
              const float* xt) override;
 
+    Status
+    BuildAllResumable(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                      const BuildHooks& hooks) override;
+
     VecIndexPtr
     CopyToGpu(const int64_t& device_id, const Config& cfg) override;
 
@@ -64,6 +68,17 @@ class VecIndexImpl : public VecIndex {
     Status
     Search(const int64_t& nq, const float* xq, float* dist, int64_t* ids, const Config& cfg) override;
 
+    Status
+    Search(const int64_t& nq, const float* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist, int64_t* ids,
+           const Config& cfg) override;
+
+    bool
+    SupportRangeSearch() override;
+
+    Status
+    RangeSearch(const int64_t& nq, const float* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist,
+                int64_t* ids, const Config& cfg) override;
+
     Status
     GetVectorById(const int64_t n, const int64_t* xid, float* x, const Config& cfg) override;
 
@@ -23,8 +23,12 @@
 #include "knowhere/index/vector_index/IndexNSG.h"
 #include "knowhere/index/vector_index/IndexSPTAG.h"
 #include "server/Config.h"
+#include "storage/file/DirectIOReader.h"
+#include "storage/file/DirectIOUtil.h"
+#include "storage/file/DirectIOWriter.h"
 #include "storage/file/FileIOReader.h"
 #include "storage/file/FileIOWriter.h"
+#include "storage/file/MappedFile.h"
 #include "storage/s3/S3IOReader.h"
 #include "storage/s3/S3IOWriter.h"
 #include "utils/Exception.h"
@@ -45,6 +49,10 @@
 
 #include <fiu-local.h>
 
+#include <cstring>
+#include <memory>
+#include <string>
+
 namespace milvus {
 namespace engine {
 
@@ -166,6 +174,52 @@ LoadVecIndex(const IndexType& index_type, const knowhere::BinarySet& index_binar
     return index;
 }
 
+namespace {
+
+// binaries reference the mapping instead of being copied out of the file, they keep the mapping alive
+VecIndexPtr
+read_mapped_index(const storage::MappedFilePtr& mapped) {
+    const uint8_t* data = mapped->data();
+    size_t length = mapped->size();
+    knowhere::BinarySet load_data_list;
+
+    auto current_type = IndexType::INVALID;
+    if (length < sizeof(current_type)) {
+        return nullptr;
+    }
+    memcpy(&current_type, data, sizeof(current_type));
+    size_t rp = sizeof(current_type);
+
+    while (rp < length) {
+        size_t meta_length;
+        if (rp + sizeof(meta_length) > length) {
+            return nullptr;
+        }
+        memcpy(&meta_length, data + rp, sizeof(meta_length));
+        rp += sizeof(meta_length);
+
+        size_t bin_length;
+        if (rp + meta_length + sizeof(bin_length) > length) {
+            return nullptr;
+        }
+        std::string meta(reinterpret_cast<const char*>(data + rp), meta_length);
+        rp += meta_length;
+        memcpy(&bin_length, data + rp, sizeof(bin_length));
+        rp += sizeof(bin_length);
+
+        if (rp + bin_length > length) {
+            return nullptr;
+        }
+        std::shared_ptr<uint8_t> binptr(mapped, mapped->data() + rp);
+        load_data_list.Append(meta, binptr, bin_length);
+        rp += bin_length;
+    }
+
+    return LoadVecIndex(current_type, load_data_list, length);
+}
+
+}  // namespace
+
 VecIndexPtr
 read_index(const std::string& location) {
     fiu_return_on("read_null_index", nullptr);
@@ -177,9 +231,22 @@ read_index(const std::string& location) {
     server::Config& config = server::Config::GetInstance();
     config.GetStorageConfigS3Enable(s3_enable);
 
+    // direct io keeps large index files out of page cache, so they are not mapped either
+    bool direct_io = storage::DirectIOEnabled();
+    if (!s3_enable && !direct_io) {
+        auto mapped = storage::MappedFile::Map(location);
+        if (mapped != nullptr) {
+            auto index = read_mapped_index(mapped);
+            recorder.RecordSection("read_index(" + location + ") mapped");
+            return index;
+        }
+    }
+
     std::shared_ptr<storage::IOReader> reader_ptr;
     if (s3_enable) {
         reader_ptr = std::make_shared<storage::S3IOReader>(location);
+    } else if (direct_io) {
+        reader_ptr = std::make_shared<storage::DirectIOReader>(location);
     } else {
         reader_ptr = std::make_shared<storage::FileIOReader>(location);
     }
@@ -253,6 +320,8 @@ write_index(VecIndexPtr index, const std::string& location) {
         std::shared_ptr<storage::IOWriter> writer_ptr;
         if (s3_enable) {
             writer_ptr = std::make_shared<storage::S3IOWriter>(location);
+        } else if (storage::DirectIOEnabled()) {
+            writer_ptr = std::make_shared<storage::DirectIOWriter>(location);
         } else {
             writer_ptr = std::make_shared<storage::FileIOWriter>(location);
         }
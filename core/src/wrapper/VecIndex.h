@@ -13,6 +13,7 @@
 
 #include <faiss/utils/ConcurrentBitset.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <thirdparty/nlohmann/json.hpp>
@@ -59,6 +60,23 @@ class VecIndex;
 
 using VecIndexPtr = std::shared_ptr<VecIndex>;
 
+// default rows added per step by a resumable build, progress is reported after each step
+constexpr int64_t BUILD_BATCH_ROWS = 65536;
+
+/*
+ * State and callbacks of a resumable build.
+ * A build on an index loaded from a partial checkpoint skips training and adds the rows after its Count(),
+ * a build given a trained model skips training. Otherwise trained_ gets the model once training is done,
+ * for the index types whose model can be serialized.
+ */
+struct BuildHooks {
+    bool resume_partial_ = false;
+    knowhere::BinarySet model_;
+    std::function<void(const knowhere::BinarySet& model)> trained_;
+    std::function<void(int64_t rows_added)> progress_;
+    int64_t batch_rows_ = BUILD_BATCH_ROWS;
+};
+
 class VecIndex : public cache::DataObj {
  public:
     virtual Status
@@ -72,6 +90,17 @@ class VecIndex : public cache::DataObj {
         return Status::OK();
     }
 
+    // same as BuildAll, indexes without resume support build from scratch and report progress once
+    virtual Status
+    BuildAllResumable(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg,
+                      const BuildHooks& hooks) {
+        auto status = BuildAll(nb, xb, ids, cfg);
+        if (status.ok() && hooks.progress_) {
+            hooks.progress_(nb);
+        }
+        return status;
+    }
+
     virtual Status
     Add(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg = Config()) = 0;
 
@@ -90,6 +119,33 @@ class VecIndex : public cache::DataObj {
         return Status::OK();
     }
 
+    // rows set in bitset are excluded from this search only instead of the blacklist, nullptr means the blacklist,
+    // indexes without bitset support search as usual and leave filtering to the caller
+    virtual Status
+    Search(const int64_t& nq, const float* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist, int64_t* ids,
+           const Config& cfg) {
+        return Search(nq, xq, dist, ids, cfg);
+    }
+
+    virtual Status
+    Search(const int64_t& nq, const uint8_t* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist, int64_t* ids,
+           const Config& cfg) {
+        return Search(nq, xq, dist, ids, cfg);
+    }
+
+    virtual bool
+    SupportRangeSearch() {
+        return false;
+    }
+
+    // results within knowhere::meta::RADIUS of cfg, at most knowhere::meta::TOPK per query, laid out like Search
+    virtual Status
+    RangeSearch(const int64_t& nq, const float* xq, const faiss::ConcurrentBitsetPtr& bitset, float* dist,
+                int64_t* ids, const Config& cfg) {
+        ENGINE_LOG_ERROR << "RangeSearch not support";
+        return Status(KNOWHERE_ERROR, "range search not supported");
+    }
+
     virtual VecIndexPtr
     CopyToGpu(const int64_t& device_id, const Config& cfg = Config()) = 0;
 
@@ -13,7 +13,9 @@
 #include <fiu-local.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
+#include <limits>
 #include <random>
 #include <thread>
 
@@ -23,8 +25,12 @@
 #include "db/DBFactory.h"
 #include "db/DBImpl.h"
 #include "db/IDGenerator.h"
+#include "db/engine/QueryGroups.h"
+#include "db/engine/SegmentPruner.h"
 #include "db/meta/MetaConsts.h"
 #include "db/utils.h"
+#include "segment/SegmentReader.h"
+#include "segment/SegmentWriter.h"
 #include "server/Config.h"
 #include "utils/CommonUtil.h"
 
@@ -59,6 +65,18 @@ BuildVectors(uint64_t n, uint64_t batch_index, milvus::engine::VectorsData& vect
     }
 }
 
+void
+BuildTagAttr(milvus::engine::VectorsData& vectors) {
+    // the "tag" attribute of a vector is its id modulo 10, so results can be checked against their ids
+    auto attr = std::make_shared<milvus::segment::Attr>("tag", milvus::segment::AttrType::INT64);
+    attr->Resize(vectors.id_array_.size());
+    for (size_t i = 0; i < vectors.id_array_.size(); ++i) {
+        int64_t tag = vectors.id_array_[i] % 10;
+        attr->SetData(i, reinterpret_cast<const uint8_t*>(&tag), 1);
+    }
+    vectors.attrs_.attrs["tag"] = attr;
+}
+
 std::string
 CurrentTmDate(int64_t offset_day = 0) {
     time_t tt;
@@ -1086,6 +1104,463 @@ TEST_F(DBTestWAL, DB_INSERT_TEST) {
     ASSERT_TRUE(stat.ok());
 }
 
+TEST_F(DBTestWAL, ATTR_FILTER_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t qb = 1000;
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+    BuildTagAttr(qxb);
+
+    stat = db_->InsertVectors(table_info.table_id_, "", qxb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+
+    const int64_t topk = 10;
+    milvus::json json_params = {{"nprobe", 10}, {"filter", "tag == 3 || tag in [7]"}};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    milvus::engine::VectorsData query;
+    BuildVectors(10, 0, query);
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), 10 * topk);
+    for (auto id : result_ids) {
+        ASSERT_NE(id, -1);
+        ASSERT_TRUE(id % 10 == 3 || id % 10 == 7);
+    }
+
+    stat = db_->DropTable(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+}
+
+TEST_F(DBTestWAL, ATTR_DELETE_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t qb = 1000;
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+    BuildTagAttr(qxb);
+
+    stat = db_->InsertVectors(table_info.table_id_, "", qxb);
+    ASSERT_TRUE(stat.ok());
+
+    // delete from the memory buffer, every erased row must take its attribute values along
+    milvus::engine::IDNumbers ids_to_delete;
+    for (int64_t id = 0; id < 500; id += 7) {
+        ids_to_delete.push_back(id);
+    }
+    stat = db_->DeleteVectors(table_info.table_id_, ids_to_delete);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t row_count = 0;
+    stat = db_->GetTableRowCount(table_info.table_id_, row_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(row_count, qb - ids_to_delete.size());
+
+    const int64_t topk = 10;
+    milvus::engine::VectorsData query;
+    BuildVectors(10, 0, query);
+    for (int64_t tag = 0; tag < 10; ++tag) {
+        milvus::json json_params = {{"nprobe", 10}, {"filter", "tag == " + std::to_string(tag)}};
+        milvus::engine::ResultIds result_ids;
+        milvus::engine::ResultDistances result_distances;
+        stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                          result_distances);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(result_ids.size(), 10 * topk);
+        for (auto id : result_ids) {
+            ASSERT_NE(id, -1);
+            ASSERT_EQ(id % 10, tag);
+            ASSERT_FALSE(id < 500 && id % 7 == 0);
+        }
+    }
+
+    stat = db_->DropTable(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+}
+
+TEST_F(DBTest, ATTR_MERGE_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    // one segment per batch, the first one without attributes so its rows are padded with 0 after merge
+    const int64_t qb = 1000;
+    const int64_t batch_count = 5;
+    for (int64_t i = 0; i < batch_count; ++i) {
+        milvus::engine::VectorsData qxb;
+        BuildVectors(qb, i, qxb);
+        if (i > 0) {
+            BuildTagAttr(qxb);
+        }
+        stat = db_->InsertVectors(table_info.table_id_, "", qxb);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->Flush(table_info.table_id_);
+        ASSERT_TRUE(stat.ok());
+    }
+
+    // the background timer merges the small raw segments into one
+    size_t segment_count = 0;
+    for (int64_t wait = 0; wait < 100; ++wait) {
+        milvus::engine::TableInfo info;
+        stat = db_->GetTableInfo(table_info.table_id_, info);
+        ASSERT_TRUE(stat.ok());
+        segment_count = 0;
+        for (auto& partition : info.partitions_stat_) {
+            segment_count += partition.segments_stat_.size();
+        }
+        if (segment_count == 1) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    ASSERT_EQ(segment_count, 1UL);
+
+    uint64_t row_count = 0;
+    stat = db_->GetTableRowCount(table_info.table_id_, row_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(row_count, static_cast<uint64_t>(qb * batch_count));
+
+    const int64_t topk = 10;
+    milvus::json json_params = {{"nprobe", 10}, {"filter", "tag == 3 || tag == 0"}};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    milvus::engine::VectorsData query;
+    BuildVectors(10, 0, query);
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), 10 * topk);
+    for (auto id : result_ids) {
+        ASSERT_NE(id, -1);
+        ASSERT_TRUE(id < qb || id % 10 == 3 || id % 10 == 0);
+    }
+
+    json_params["filter"] = "tag == 3";
+    result_ids.clear();
+    result_distances.clear();
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), 10 * topk);
+    for (auto id : result_ids) {
+        ASSERT_NE(id, -1);
+        ASSERT_GE(id, qb);
+        ASSERT_EQ(id % 10, 3);
+    }
+
+    stat = db_->DropTable(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+}
+
+TEST_F(DBTestWAL, RANGE_SEARCH_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t qb = 1000;
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+    stat = db_->InsertVectors(table_info.table_id_, "", qxb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+
+    const int64_t nq = 10, topk = 100;
+    milvus::engine::VectorsData query;
+    BuildVectors(nq, 0, query);
+    milvus::engine::ResultIds knn_ids;
+    milvus::engine::ResultDistances knn_distances;
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, milvus::json(), query, knn_ids, knn_distances);
+    ASSERT_TRUE(stat.ok());
+
+    // results of range search are the knn results within radius
+    float radius = knn_distances[20];
+    milvus::json json_params = {{"radius", radius}};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), nq * topk);
+    for (int64_t i = 0; i < nq; ++i) {
+        auto begin = result_ids.begin() + i * topk, end = begin + topk;
+        for (int64_t j = 0; j < topk; ++j) {
+            auto pos = i * topk + j;
+            if (result_ids[pos] != -1) {
+                ASSERT_LT(result_distances[pos], radius);
+            }
+            if (knn_distances[pos] < radius * 0.99) {
+                ASSERT_NE(std::find(begin, end, knn_ids[pos]), end);
+            }
+        }
+    }
+
+    // a range search may return more results per query than the knn limit of 2048
+    const int64_t range_k = 3000;
+    json_params = {{"radius", std::numeric_limits<float>::max()}};
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, range_k, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), nq * range_k);
+    for (int64_t i = 0; i < nq; ++i) {
+        auto begin = result_ids.begin() + i * range_k, end = begin + range_k;
+        ASSERT_EQ(std::count(begin, end, -1), range_k - static_cast<int64_t>(qb));
+    }
+
+    stat = db_->DropTable(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+}
+
+TEST_F(DBTestWAL, RERANK_SEARCH_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t qb = 5000;
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+    stat = db_->InsertVectors(table_info.table_id_, "", qxb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFSQ8;
+    index.extra_params_ = {{"nlist", 16}};
+    stat = db_->CreateIndex(table_info.table_id_, index);
+    ASSERT_TRUE(stat.ok());
+
+    // query vectors are in the table, re-ranked results give exact distances so each finds itself first
+    const int64_t nq = 10, topk = 10;
+    milvus::engine::VectorsData query;
+    query.vector_count_ = nq;
+    query.float_data_.assign(qxb.float_data_.begin(), qxb.float_data_.begin() + nq * TABLE_DIM);
+    milvus::json json_params = {{"nprobe", 16}, {"rerank", 4}};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), nq * topk);
+    for (int64_t i = 0; i < nq; ++i) {
+        ASSERT_EQ(result_ids[i * topk], i);
+        ASSERT_FLOAT_EQ(result_distances[i * topk], 0.0f);
+        for (int64_t j = 1; j < topk; ++j) {
+            ASSERT_LE(result_distances[i * topk + j - 1], result_distances[i * topk + j]);
+        }
+    }
+
+    stat = db_->DropTable(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+}
+
+TEST_F(DBTestWAL, RERANK_HNSW_SEARCH_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t qb = 2000;
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+    stat = db_->InsertVectors(table_info.table_id_, "", qxb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::HNSW;
+    index.extra_params_ = {{"M", 16}, {"efConstruction", 100}};
+    stat = db_->CreateIndex(table_info.table_id_, index);
+    ASSERT_TRUE(stat.ok());
+
+    // re-rank searches 4 * topk candidates, an ef equal to topk is still valid
+    const int64_t nq = 10, topk = 10;
+    milvus::engine::VectorsData query;
+    query.vector_count_ = nq;
+    query.float_data_.assign(qxb.float_data_.begin(), qxb.float_data_.begin() + nq * TABLE_DIM);
+    milvus::json json_params = {{"ef", topk}, {"rerank", 4}};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), nq * topk);
+    for (int64_t i = 0; i < nq; ++i) {
+        ASSERT_EQ(result_ids[i * topk], i);
+        ASSERT_FLOAT_EQ(result_distances[i * topk], 0.0f);
+        for (int64_t j = 1; j < topk; ++j) {
+            ASSERT_LE(result_distances[i * topk + j - 1], result_distances[i * topk + j]);
+        }
+    }
+
+    stat = db_->DropTable(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+}
+
+TEST_F(DBTestWAL, QUERY_GROUPS_HNSW_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t qb = 2000;
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+    stat = db_->InsertVectors(table_info.table_id_, "", qxb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::HNSW;
+    index.extra_params_ = {{"M", 16}, {"efConstruction", 100}};
+    stat = db_->CreateIndex(table_info.table_id_, index);
+    ASSERT_TRUE(stat.ok());
+
+    // the groups search 4 * topk candidates per query, an ef equal to topk is still valid
+    const int64_t nq = 4, topk = 10;
+    milvus::engine::VectorsData query;
+    query.vector_count_ = nq;
+    query.float_data_.assign(qxb.float_data_.begin(), qxb.float_data_.begin() + nq * TABLE_DIM);
+    milvus::json json_params = {{"ef", topk}, {milvus::engine::QUERY_GROUPS_KEY, {{"groups", {2, 2}}}}};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), 2 * topk);
+    for (int64_t i = 0; i < 2; ++i) {
+        ASSERT_NE(result_ids[i * topk], -1);
+        for (int64_t j = 1; j < topk; ++j) {
+            ASSERT_LE(result_distances[i * topk + j - 1], result_distances[i * topk + j]);
+        }
+    }
+
+    stat = db_->DropTable(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+}
+
+TEST_F(DBTestWAL, SEGMENT_PRUNE_TEST) {
+    // four segments far away from each other, segment i holds vectors around i * 10
+    const int64_t segments = 4, nb = 500;
+    milvus::engine::meta::TableFilesSchema files;
+    std::vector<milvus::engine::VectorsData> data(segments);
+    for (int64_t i = 0; i < segments; ++i) {
+        BuildVectors(nb, i, data[i]);
+        for (auto& value : data[i].float_data_) {
+            value += i * 10;
+        }
+
+        std::string segment_dir = "/tmp/milvus_test/segment_prune/" + std::to_string(i);
+        boost::filesystem::create_directories(segment_dir);
+        milvus::segment::SegmentWriter segment_writer(segment_dir);
+        segment_writer.EnableSummary(TABLE_DIM);
+        std::vector<uint8_t> raw(nb * TABLE_DIM * sizeof(float));
+        memcpy(raw.data(), data[i].float_data_.data(), raw.size());
+        segment_writer.AddVectors("segment", raw, data[i].id_array_);
+        ASSERT_TRUE(segment_writer.Serialize().ok());
+
+        milvus::segment::SummaryPtr summary;
+        milvus::segment::SegmentReader segment_reader(segment_dir);
+        ASSERT_TRUE(segment_reader.LoadSummary(summary).ok());
+        ASSERT_NE(summary, nullptr);
+        ASSERT_EQ(summary->GetCount(), milvus::segment::SUMMARY_CENTROIDS);
+        ASSERT_NEAR(summary->MinL2Distance(data[i].float_data_.data()), 0.0f, 1e-3);
+
+        milvus::engine::meta::TableFileSchema file;
+        file.location_ = segment_dir + "/segment";
+        file.metric_type_ = (int32_t)milvus::engine::MetricType::L2;
+        files.push_back(file);
+    }
+
+    milvus::engine::VectorsData query;
+    query.vector_count_ = 1;
+    query.float_data_.assign(data[2].float_data_.begin(), data[2].float_data_.begin() + TABLE_DIM);
+
+    auto kept = files;
+    ASSERT_TRUE(milvus::engine::SegmentPruner::Prune(milvus::json(), query, kept).ok());
+    ASSERT_EQ(kept.size(), files.size());
+
+    milvus::json json_params = {{milvus::engine::SEGMENT_FRACTION_KEY, 0.25}};
+    ASSERT_TRUE(milvus::engine::SegmentPruner::Prune(json_params, query, kept).ok());
+    ASSERT_EQ(kept.size(), 1);
+    ASSERT_EQ(kept[0].location_, files[2].location_);
+
+    // a query per segment keeps all of them
+    query.vector_count_ = segments;
+    query.float_data_.clear();
+    for (auto& vectors : data) {
+        query.float_data_.insert(query.float_data_.end(), vectors.float_data_.begin(),
+                                 vectors.float_data_.begin() + TABLE_DIM);
+    }
+    kept = files;
+    ASSERT_TRUE(milvus::engine::SegmentPruner::Prune(json_params, query, kept).ok());
+    ASSERT_EQ(kept.size(), files.size());
+
+    // the summaries stay cached until their segments are deleted
+    for (int64_t i = 0; i < segments; ++i) {
+        std::string segment_dir = "/tmp/milvus_test/segment_prune/" + std::to_string(i);
+        ASSERT_TRUE(milvus::cache::CpuCacheMgr::GetInstance()->ItemExists(segment_dir + ".summary"));
+        milvus::engine::SegmentPruner::EraseFromCache(segment_dir);
+        ASSERT_FALSE(milvus::cache::CpuCacheMgr::GetInstance()->ItemExists(segment_dir + ".summary"));
+    }
+
+    boost::filesystem::remove_all("/tmp/milvus_test/segment_prune");
+}
+
+TEST_F(DBTestWAL, QUERY_TABLES_TEST) {
+    std::vector<std::string> table_ids = {"query_tables_a", "query_tables_b", "query_tables_empty"};
+    for (size_t i = 0; i < table_ids.size(); ++i) {
+        milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+        table_info.table_id_ = table_ids[i];
+        auto stat = db_->CreateTable(table_info);
+        ASSERT_TRUE(stat.ok());
+        if (i == 2) {
+            continue;
+        }
+
+        // ids of table i are in [i * 1000, (i + 1) * 1000)
+        milvus::engine::VectorsData qxb;
+        BuildVectors(1000, i, qxb);
+        stat = db_->InsertVectors(table_ids[i], "", qxb);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->Flush(table_ids[i]);
+        ASSERT_TRUE(stat.ok());
+    }
+
+    const int64_t nq = 5, topk = 10;
+    milvus::engine::VectorsData query;
+    BuildVectors(nq, 0, query);
+    std::vector<milvus::engine::ResultIds> result_ids;
+    std::vector<milvus::engine::ResultDistances> result_distances;
+    auto stat = db_->QueryTables(dummy_context_, table_ids, {}, topk, milvus::json(), query, result_ids,
+                                 result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), table_ids.size());
+    for (int64_t i = 0; i < 2; ++i) {
+        ASSERT_EQ(result_ids[i].size(), nq * topk);
+        ASSERT_EQ(result_distances[i].size(), nq * topk);
+        for (auto id : result_ids[i]) {
+            ASSERT_EQ(id / 1000, i);
+        }
+    }
+    ASSERT_TRUE(result_ids[2].empty());
+
+    for (auto& table_id : table_ids) {
+        stat = db_->DropTable(table_id);
+        ASSERT_TRUE(stat.ok());
+    }
+}
+
 TEST_F(DBTestWAL, DB_STOP_TEST) {
     milvus::engine::meta::TableSchema table_info = BuildTableSchema();
     auto stat = db_->CreateTable(table_info);
@@ -1163,6 +1638,43 @@ TEST_F(DBTestWALRecovery, RECOVERY_WITH_NO_ERROR) {
     ASSERT_EQ(result_ids.size() / topk, qb);
 }
 
+TEST_F(DBTestWALRecovery, RECOVERY_WITH_ATTRS) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t qb = 1000;
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+    BuildTagAttr(qxb);
+    stat = db_->InsertVectors(table_info.table_id_, "", qxb);
+    ASSERT_TRUE(stat.ok());
+
+    // restart without applying the wal, the attributes must be restored from the wal records
+    fiu_init(0);
+    fiu_enable("DBImpl.ExexWalRecord.return", 1, nullptr, 0);
+    db_ = nullptr;
+    fiu_disable("DBImpl.ExexWalRecord.return");
+    auto options = GetOptions();
+    db_ = milvus::engine::DBFactory::Build(options);
+    db_->Flush();
+
+    const int64_t topk = 10;
+    milvus::json json_params = {{"nprobe", 10}, {"filter", "tag == 3"}};
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    milvus::engine::VectorsData query;
+    BuildVectors(10, 0, query);
+    stat = db_->Query(dummy_context_, table_info.table_id_, {}, topk, json_params, query, result_ids,
+                      result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), 10 * topk);
+    for (auto id : result_ids) {
+        ASSERT_NE(id, -1);
+        ASSERT_EQ(id % 10, 3);
+    }
+}
+
 TEST_F(DBTestWALRecovery_Error, RECOVERY_WITH_INVALID_LOG_FILE) {
     milvus::engine::meta::TableSchema table_info = BuildTableSchema();
     auto stat = db_->CreateTable(table_info);
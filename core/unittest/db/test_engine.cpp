@@ -13,8 +13,10 @@
 #include <boost/filesystem.hpp>
 #include <vector>
 
+#include "cache/CpuCacheMgr.h"
 #include "db/engine/EngineFactory.h"
 #include "db/engine/ExecutionEngineImpl.h"
+#include "db/engine/RawBlockReader.h"
 #include "db/utils.h"
 #include <fiu-local.h>
 #include <fiu-control.h>
@@ -278,3 +280,31 @@ TEST_F(EngineTest, ENGINE_IMPL_THROW_EXCEPTION_TEST) {
 
     fiu_disable("vecIndex.throw_read_exception");
 }
+
+TEST_F(EngineTest, RAW_BLOCK_ERASE_TEST) {
+    std::string location = "/tmp/raw_block_erase_test";
+    auto cache = milvus::cache::CpuCacheMgr::GetInstance();
+
+    // 16MB rows, so 4 rows fill a block and 10 rows take 3 blocks
+    size_t row_bytes = milvus::engine::RAW_BLOCK_SIZE / 4;
+    std::vector<milvus::segment::doc_id_t> uids(10, 0);
+    cache->InsertItem(location + ".uids", std::make_shared<milvus::engine::RawUids>(std::move(uids), row_bytes));
+    for (size_t block_no = 0; block_no < 3; ++block_no) {
+        std::vector<uint8_t> data(8, 0);
+        cache->InsertItem(location + ".block_" + std::to_string(block_no),
+                          std::make_shared<milvus::engine::RawBlock>(std::move(data)));
+    }
+    cache->InsertItem(location, std::make_shared<milvus::engine::RawBlock>(std::vector<uint8_t>(8, 0)));
+
+    milvus::engine::RawBlockReader::EraseFromCache(location);
+    ASSERT_FALSE(cache->ItemExists(location + ".uids"));
+    for (size_t block_no = 0; block_no < 3; ++block_no) {
+        ASSERT_FALSE(cache->ItemExists(location + ".block_" + std::to_string(block_no)));
+    }
+    // the entry of the file itself is erased by CommonUtil::EraseFromCache
+    ASSERT_TRUE(cache->ItemExists(location));
+    cache->EraseItem(location);
+
+    // nothing to do for a file never read by blocks
+    milvus::engine::RawBlockReader::EraseFromCache(location);
+}
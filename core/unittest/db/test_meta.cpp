@@ -12,6 +12,7 @@
 #include "db/Constants.h"
 #include "db/Utils.h"
 #include "db/meta/MetaConsts.h"
+#include "db/meta/SnapshotMetaImpl.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "db/utils.h"
 
@@ -699,3 +700,71 @@ TEST_F(MetaTest, LSN_TEST) {
     status = impl_->GetGlobalLastLSN(temp_lsb);
     ASSERT_EQ(temp_lsb, lsn);
 }
+
+TEST_F(MetaTest, SNAPSHOT_TEST) {
+    auto table_id = "snapshot_test";
+    auto options = GetOptions();
+    auto snapshot = std::make_shared<milvus::engine::meta::SnapshotMetaImpl>(impl_, options.meta_);
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = snapshot->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::TableFilesSchema files;
+    status = snapshot->SnapshotFilesToSearch(table_id, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(files.empty());
+
+    // write through snapshot must be visible to next search
+    uint64_t version = snapshot->SnapshotVersion();
+    milvus::engine::meta::TableFileSchema table_file;
+    table_file.table_id_ = table_id;
+    status = snapshot->CreateTableFile(table_file);
+    ASSERT_TRUE(status.ok());
+    table_file.file_type_ = milvus::engine::meta::TableFileSchema::RAW;
+    table_file.row_count_ = 1;
+    status = snapshot->UpdateTableFile(table_file);
+    ASSERT_TRUE(status.ok());
+    ASSERT_GT(snapshot->SnapshotVersion(), version);
+
+    status = snapshot->SnapshotFilesToSearch(table_id, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files.size(), 1);
+
+    // write bypassing snapshot is not visible until next invalidation
+    milvus::engine::meta::TableFileSchema bypass_file;
+    bypass_file.table_id_ = table_id;
+    status = impl_->CreateTableFile(bypass_file);
+    bypass_file.file_type_ = milvus::engine::meta::TableFileSchema::RAW;
+    status = impl_->UpdateTableFile(bypass_file);
+    status = snapshot->SnapshotFilesToSearch(table_id, files);
+    ASSERT_EQ(files.size(), 1);
+
+    table_file.file_type_ = milvus::engine::meta::TableFileSchema::TO_DELETE;
+    status = snapshot->UpdateTableFile(table_file);
+    status = snapshot->SnapshotFilesToSearch(table_id, files);
+    ASSERT_EQ(files.size(), 1);
+    ASSERT_EQ(files[0].id_, bypass_file.id_);
+
+    // partitions
+    std::vector<milvus::engine::meta::TableSchema> partitions;
+    status = snapshot->SnapshotPartitions(table_id, partitions);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(partitions.empty());
+
+    status = snapshot->CreatePartition(table_id, "", "tag0", 0);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->SnapshotPartitions(table_id, partitions);
+    ASSERT_EQ(partitions.size(), 1);
+
+    status = snapshot->DropPartition(partitions[0].table_id_);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->SnapshotPartitions(table_id, partitions);
+    ASSERT_TRUE(partitions.empty());
+
+    status = snapshot->DropTable(table_id);
+    ASSERT_TRUE(status.ok());
+    status = snapshot->SnapshotFilesToSearch(table_id, files);
+    ASSERT_FALSE(status.ok());
+}
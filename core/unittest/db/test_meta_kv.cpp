@@ -0,0 +1,206 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/meta/KVMetaImpl.h"
+#include "db/meta/MetaConsts.h"
+#include "db/meta/MetaFactory.h"
+#include "db/utils.h"
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <boost/filesystem/operations.hpp>
+
+namespace {
+
+void
+CreateFiles(const std::shared_ptr<milvus::engine::meta::KVMetaImpl>& impl, const std::string& table_id,
+            int count, int file_type, milvus::engine::meta::TableFilesSchema& files) {
+    for (int i = 0; i < count; ++i) {
+        milvus::engine::meta::TableFileSchema file;
+        file.table_id_ = table_id;
+        auto status = impl->CreateTableFile(file);
+        ASSERT_TRUE(status.ok());
+        file.file_type_ = file_type;
+        file.row_count_ = milvus::engine::meta::BUILD_INDEX_THRESHOLD;
+        file.file_size_ = (i + 1) * 1024;
+        files.push_back(file);
+    }
+}
+
+}  // namespace
+
+TEST_F(KVMetaTest, TABLE_TEST) {
+    auto table_id = "kv_meta_test_table";
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = impl_->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    auto gid = table.id_;
+    table.id_ = -1;
+    status = impl_->DescribeTable(table);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(table.id_, gid);
+    ASSERT_EQ(table.table_id_, table_id);
+
+    table.table_id_ = "not_found";
+    status = impl_->DescribeTable(table);
+    ASSERT_FALSE(status.ok());
+
+    table.table_id_ = table_id;
+    status = impl_->CreateTable(table);
+    ASSERT_EQ(status.code(), milvus::DB_ALREADY_EXIST);
+
+    status = impl_->CreatePartition(table_id, "", "tag0", 0);
+    ASSERT_TRUE(status.ok());
+    std::vector<milvus::engine::meta::TableSchema> partitions;
+    status = impl_->ShowPartitions(table_id, partitions);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(partitions.size(), 1UL);
+
+    std::vector<milvus::engine::meta::TableSchema> tables;
+    status = impl_->AllTables(tables);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(tables.size(), 1UL);
+
+    status = impl_->DropTable(table_id);
+    ASSERT_TRUE(status.ok());
+
+    status = impl_->CreateTable(table);
+    ASSERT_EQ(status.code(), milvus::DB_ERROR);
+
+    bool has = true;
+    status = impl_->HasTable(table_id, has);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(has);
+}
+
+TEST_F(KVMetaTest, TABLE_FILES_TEST) {
+    auto table_id = "kv_meta_test_files";
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    table.dimension_ = 64;
+    table.index_file_size_ = 1024 * 1024;
+    auto status = impl_->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::TableFilesSchema files;
+    CreateFiles(impl_, table_id, 3, milvus::engine::meta::TableFileSchema::RAW, files);
+    CreateFiles(impl_, table_id, 2, milvus::engine::meta::TableFileSchema::TO_INDEX, files);
+    CreateFiles(impl_, table_id, 1, milvus::engine::meta::TableFileSchema::NEW, files);
+    status = impl_->UpdateTableFiles(files);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::TableFilesSchema result;
+    status = impl_->FilesToMerge(table_id, result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.size(), 3UL);
+    ASSERT_GE(result[0].file_size_, result[1].file_size_);
+    ASSERT_EQ(result[0].dimension_, table.dimension_);
+
+    status = impl_->FilesToIndex(result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.size(), 2UL);
+
+    status = impl_->FilesToSearch(table_id, {}, result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.size(), 5UL);
+
+    status = impl_->FilesToSearch(table_id, {files[0].id_, files[5].id_}, result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.size(), 1UL);
+
+    status = impl_->GetTableFilesBySegmentId(files[0].segment_id_, result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.size(), 1UL);
+    ASSERT_EQ(result[0].file_id_, files[0].file_id_);
+
+    uint64_t count = 0;
+    status = impl_->Count(table_id, count);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(count, 5 * milvus::engine::meta::BUILD_INDEX_THRESHOLD);
+
+    status = impl_->UpdateTableFilesToIndex(table_id);
+    ASSERT_TRUE(status.ok());
+    status = impl_->FilesToIndex(result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.size(), 5UL);
+
+    // shadow file is removed, to_delete files are removed after ttl
+    status = impl_->CleanUpShadowFiles();
+    ASSERT_TRUE(status.ok());
+    status = impl_->DeleteTableFiles(table_id);
+    ASSERT_TRUE(status.ok());
+    status = impl_->CleanUpFilesWithTTL(0);
+    ASSERT_TRUE(status.ok());
+    status = impl_->FilesByType(table_id, {milvus::engine::meta::TableFileSchema::TO_DELETE}, result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(result.empty());
+}
+
+TEST_F(KVMetaTest, RELOAD_TEST) {
+    auto table_id = "kv_meta_test_reload";
+    auto options = GetOptions();
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = impl_->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::TableFilesSchema files;
+    CreateFiles(impl_, table_id, 2, milvus::engine::meta::TableFileSchema::INDEX, files);
+    status = impl_->UpdateTableFiles(files);
+    ASSERT_TRUE(status.ok());
+    status = impl_->SetGlobalLastLSN(100);
+    ASSERT_TRUE(status.ok());
+    impl_ = nullptr;
+
+    // a batch torn by crash must be ignored
+    std::string manifest = options.meta_.path_ + "/" + milvus::engine::meta::KV_META_MANIFEST;
+    {
+        std::ofstream out(manifest, std::ios::app);
+        out << "[{\"op\":\"drop_table\",\"table_";
+    }
+
+    impl_ = std::make_shared<milvus::engine::meta::KVMetaImpl>(options.meta_);
+    status = impl_->DescribeTable(table);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::TableFilesSchema result;
+    status = impl_->FilesToSearch(table_id, {}, result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.size(), 2UL);
+
+    uint64_t lsn = 0;
+    status = impl_->GetGlobalLastLSN(lsn);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(lsn, 100UL);
+
+    // the torn tail is truncated, new batches are still readable after reload
+    status = impl_->DropTable(table_id);
+    ASSERT_TRUE(status.ok());
+    impl_ = std::make_shared<milvus::engine::meta::KVMetaImpl>(options.meta_);
+    bool has = true;
+    status = impl_->HasTable(table_id, has);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(has);
+}
+
+TEST_F(KVMetaTest, FACTORY_TEST) {
+    auto options = GetOptions();
+    options.meta_.backend_uri_ = "kv://:@:/";
+    impl_ = nullptr;
+    auto meta = milvus::engine::MetaFactory::Build(options.meta_, options.mode_);
+    ASSERT_NE(std::dynamic_pointer_cast<milvus::engine::meta::KVMetaImpl>(meta), nullptr);
+    impl_ = std::dynamic_pointer_cast<milvus::engine::meta::KVMetaImpl>(meta);
+}
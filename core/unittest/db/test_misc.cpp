@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 
 #include <boost/filesystem.hpp>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -20,6 +21,7 @@
 #include "db/OngoingFileChecker.h"
 #include "db/Options.h"
 #include "db/Utils.h"
+#include "db/engine/AttrFilter.h"
 #include "db/engine/EngineFactory.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "utils/Exception.h"
@@ -249,3 +251,131 @@ TEST(DBMiscTest, IDGENERATOR_TEST) {
 
     ASSERT_EQ(ids.size(), unique_ids.size());
 }
+
+namespace {
+
+milvus::segment::AttrPtr
+BuildAttr(const std::string& name, const std::vector<int64_t>& values) {
+    auto attr = std::make_shared<milvus::segment::Attr>(name, milvus::segment::AttrType::INT64);
+    attr->Resize(values.size());
+    attr->SetData(0, reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    return attr;
+}
+
+milvus::segment::AttrPtr
+BuildAttr(const std::string& name, const std::vector<double>& values) {
+    auto attr = std::make_shared<milvus::segment::Attr>(name, milvus::segment::AttrType::DOUBLE);
+    attr->Resize(values.size());
+    attr->SetData(0, reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    return attr;
+}
+
+// rows of the attrs matched by the expression
+std::vector<size_t>
+MatchedRows(const std::string& expr, const milvus::segment::Attrs& attrs, size_t row_count) {
+    milvus::engine::AttrFilterPtr filter;
+    auto status = milvus::engine::AttrFilter::Parse(expr, filter);
+    EXPECT_TRUE(status.ok()) << expr << ": " << status.message();
+    std::vector<size_t> rows;
+    if (filter == nullptr) {
+        return rows;
+    }
+
+    auto bitset = filter->Evaluate(attrs, row_count);
+    for (size_t row = 0; row < row_count; ++row) {
+        EXPECT_EQ(filter->Match(attrs, row), !bitset->test(row)) << expr << " row " << row;
+        if (filter->Match(attrs, row)) {
+            rows.push_back(row);
+        }
+    }
+    return rows;
+}
+
+}  // namespace
+
+TEST(DBMiscTest, ATTR_FILTER_PARSE_TEST) {
+    milvus::engine::AttrFilterPtr filter;
+    auto status = milvus::engine::AttrFilter::Parse("a == 1 || (b in [2, 3] && a != 4) || a == 1", filter);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(filter->Names(), std::vector<std::string>({"a", "b"}));
+
+    std::vector<std::string> malformed = {"",          "a ==",      "(a == 1",   "a == 1)",    "a in [1,",
+                                          "a in 1",    "a in []",   "== 1",      "a == 1 &&",  "a == 1 b == 2",
+                                          "a = 1",     "a == b",    "1 == a",    "a == 1 || ", "not",
+                                          "a == 1 # 2"};
+    for (auto& expr : malformed) {
+        filter = nullptr;
+        status = milvus::engine::AttrFilter::Parse(expr, filter);
+        ASSERT_FALSE(status.ok()) << expr;
+        ASSERT_EQ(filter, nullptr) << expr;
+    }
+}
+
+TEST(DBMiscTest, ATTR_FILTER_MATCH_TEST) {
+    milvus::segment::Attrs attrs;
+    attrs.attrs["a"] = BuildAttr("a", std::vector<int64_t>{0, 1, 1, 0, 1});
+    attrs.attrs["b"] = BuildAttr("b", std::vector<int64_t>{0, 0, 1, 1, 1});
+    attrs.attrs["c"] = BuildAttr("c", std::vector<int64_t>{1, 1, 0, 1, 1});
+    size_t row_count = 5;
+
+    // "&&" binds tighter than "||", with both spellings
+    ASSERT_EQ(MatchedRows("a == 1 || b == 1 && c == 1", attrs, row_count), std::vector<size_t>({1, 2, 3, 4}));
+    ASSERT_EQ(MatchedRows("a == 1 or b == 1 and c == 1", attrs, row_count), std::vector<size_t>({1, 2, 3, 4}));
+    ASSERT_EQ(MatchedRows("(a == 1 || b == 1) && c == 1", attrs, row_count), std::vector<size_t>({1, 3, 4}));
+    ASSERT_EQ(MatchedRows("b == 1 && c == 1 || a == 1", attrs, row_count), std::vector<size_t>({1, 2, 3, 4}));
+
+    // "!" binds tighter than "&&", "not" is the same operator
+    ASSERT_EQ(MatchedRows("!a == 1 && b == 1", attrs, row_count), std::vector<size_t>({3}));
+    ASSERT_EQ(MatchedRows("not (a == 1 && b == 1)", attrs, row_count), std::vector<size_t>({0, 1, 3}));
+    ASSERT_EQ(MatchedRows("not not a == 1", attrs, row_count), std::vector<size_t>({1, 2, 4}));
+
+    // comparison operators and "in"
+    attrs.attrs["v"] = BuildAttr("v", std::vector<int64_t>{-2, 0, 3, 7, 9});
+    ASSERT_EQ(MatchedRows("v in [3, 9, 100]", attrs, row_count), std::vector<size_t>({2, 4}));
+    ASSERT_EQ(MatchedRows("v in [-2]", attrs, row_count), std::vector<size_t>({0}));
+    ASSERT_EQ(MatchedRows("!(v in [3, 9])", attrs, row_count), std::vector<size_t>({0, 1, 3}));
+    ASSERT_EQ(MatchedRows("v != 0", attrs, row_count), std::vector<size_t>({0, 2, 3, 4}));
+    ASSERT_EQ(MatchedRows("v < 3", attrs, row_count), std::vector<size_t>({0, 1}));
+    ASSERT_EQ(MatchedRows("v <= 3", attrs, row_count), std::vector<size_t>({0, 1, 2}));
+    ASSERT_EQ(MatchedRows("v > 3", attrs, row_count), std::vector<size_t>({3, 4}));
+    ASSERT_EQ(MatchedRows("v >= 3", attrs, row_count), std::vector<size_t>({2, 3, 4}));
+}
+
+TEST(DBMiscTest, ATTR_FILTER_TYPE_TEST) {
+    milvus::segment::Attrs attrs;
+    int64_t big = (1LL << 53) + 1;
+    attrs.attrs["i"] = BuildAttr("i", std::vector<int64_t>{2, 3, big});
+    attrs.attrs["d"] = BuildAttr("d", std::vector<double>{2.0, 2.5, -1.5});
+    size_t row_count = 3;
+
+    // int64 column against double literal compares as double
+    ASSERT_EQ(MatchedRows("i < 2.5", attrs, row_count), std::vector<size_t>({0}));
+    ASSERT_EQ(MatchedRows("i == 2.0", attrs, row_count), std::vector<size_t>({0}));
+    ASSERT_EQ(MatchedRows("i == 2", attrs, row_count), std::vector<size_t>({0}));
+
+    // int64 column against integer literal compares exactly, beyond the precision of double
+    std::string big_text = std::to_string(big);
+    std::string below_text = std::to_string(big - 1);
+    ASSERT_EQ(MatchedRows("i == " + big_text, attrs, row_count), std::vector<size_t>({2}));
+    ASSERT_EQ(MatchedRows("i == " + below_text, attrs, row_count), std::vector<size_t>());
+    ASSERT_EQ(MatchedRows("i > " + below_text, attrs, row_count), std::vector<size_t>({2}));
+
+    // double column compares as double with both kinds of literal
+    ASSERT_EQ(MatchedRows("d == 2", attrs, row_count), std::vector<size_t>({0}));
+    ASSERT_EQ(MatchedRows("d == 2.5", attrs, row_count), std::vector<size_t>({1}));
+    ASSERT_EQ(MatchedRows("d in [2, -1.5]", attrs, row_count), std::vector<size_t>({0, 2}));
+    ASSERT_EQ(MatchedRows("d > 2 && i >= 3", attrs, row_count), std::vector<size_t>({1}));
+}
+
+TEST(DBMiscTest, ATTR_FILTER_MISSING_TEST) {
+    milvus::segment::Attrs attrs;
+    attrs.attrs["a"] = BuildAttr("a", std::vector<int64_t>{5, 0});
+    size_t row_count = 4;
+
+    // an absent attribute and rows past the end of a column are evaluated with value 0
+    ASSERT_EQ(MatchedRows("x == 0", attrs, row_count), std::vector<size_t>({0, 1, 2, 3}));
+    ASSERT_EQ(MatchedRows("x != 0", attrs, row_count), std::vector<size_t>());
+    ASSERT_EQ(MatchedRows("x < 0.5 && x > -0.5", attrs, row_count), std::vector<size_t>({0, 1, 2, 3}));
+    ASSERT_EQ(MatchedRows("a == 0", attrs, row_count), std::vector<size_t>({1, 2, 3}));
+    ASSERT_EQ(MatchedRows("a == 5 || x == 1", attrs, row_count), std::vector<size_t>({0}));
+}
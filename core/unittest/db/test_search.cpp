@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <limits>
 #include <vector>
 
 #include "scheduler/job/SearchJob.h"
@@ -162,6 +163,64 @@ TEST(DBSearchTest, MERGE_RESULT_SET_TEST) {
     MergeTopkToResultSetTest(TOP_K / 2, TOP_K / 3, NQ, TOP_K, false);
 }
 
+TEST(DBSearchTest, AGGREGATE_GROUPS_TEST) {
+    const size_t nq = 3, src_k = 3, topk = 2;
+    float max = std::numeric_limits<float>::max();
+    ms::ResultIds src_ids = {1, 2, 3, 2, 4, -1, 5, 6, 7};
+    ms::ResultDistances src_distances = {0.1, 0.2, 0.5, 0.1, 0.3, max, 1, 2, 3};
+
+    auto aggregate = [&](const milvus::json& spec, ms::ResultIds& ids, ms::ResultDistances& distances) {
+        milvus::engine::QueryGroupsPtr groups;
+        auto status = milvus::engine::QueryGroups::Parse({{milvus::engine::QUERY_GROUPS_KEY, spec}}, nq, groups);
+        ASSERT_TRUE(status.ok());
+        ASSERT_NE(groups, nullptr);
+        ms::XSearchTask::AggregateGroupsToResultSet(*groups, src_ids, src_distances, src_k, topk, true, ids,
+                                                    distances);
+        ASSERT_EQ(ids.size(), groups->GroupCount() * topk);
+    };
+
+    ms::ResultIds ids;
+    ms::ResultDistances distances;
+    aggregate({{"groups", {2, 1}}}, ids, distances);
+    ASSERT_EQ(ids, ms::ResultIds({2, 1, 5, 6}));
+    ASSERT_NEAR(distances[0], 0.3, 1e-5);
+    ASSERT_NEAR(distances[1], 0.4, 1e-5);
+
+    aggregate({{"groups", {2, 1}}, {"aggregation", "weighted"}, {"weights", {2, 0, 1}}}, ids, distances);
+    ASSERT_EQ(ids, ms::ResultIds({1, 2, 5, 6}));
+    ASSERT_NEAR(distances[0], 0.2, 1e-5);
+    ASSERT_NEAR(distances[1], 0.4, 1e-5);
+
+    aggregate({{"groups", {2, 1}}, {"aggregation", "max"}}, ids, distances);
+    ASSERT_EQ(std::min(ids[0], ids[1]), 1);
+    ASSERT_EQ(std::max(ids[0], ids[1]), 2);
+    ASSERT_NEAR(distances[1], 0.1, 1e-5);
+
+    // one group of three queries, topk larger than the number of hits is padded
+    ms::ResultIds padded_ids;
+    ms::ResultDistances padded_distances;
+    milvus::engine::QueryGroupsPtr groups;
+    ASSERT_TRUE(milvus::engine::QueryGroups::Parse({{"multi_vector", {{"groups", {3}}}}}, nq, groups).ok());
+    ms::XSearchTask::AggregateGroupsToResultSet(*groups, src_ids, src_distances, src_k, 8, true, padded_ids,
+                                                padded_distances);
+    ASSERT_EQ(padded_ids.size(), 8);
+    ASSERT_EQ(padded_ids[0], 5);
+    ASSERT_NE(padded_ids[6], -1);
+    ASSERT_EQ(padded_ids[7], -1);
+
+    // invalid specs
+    ASSERT_FALSE(milvus::engine::QueryGroups::Parse({{"multi_vector", {{"groups", {1, 1}}}}}, nq, groups).ok());
+    ASSERT_FALSE(milvus::engine::QueryGroups::Parse({{"multi_vector", {{"groups", {3}}, {"aggregation", "avg"}}}},
+                                                    nq, groups)
+                     .ok());
+    ASSERT_FALSE(
+        milvus::engine::QueryGroups::Parse({{"multi_vector", {{"groups", {3}}, {"aggregation", "weighted"}}}}, nq,
+                                           groups)
+            .ok());
+    ASSERT_TRUE(milvus::engine::QueryGroups::Parse({{"nprobe", 16}}, nq, groups).ok());
+    ASSERT_EQ(groups, nullptr);
+}
+
 //void MergeTopkArrayTest(size_t topk_1, size_t topk_2, size_t nq, size_t topk, bool ascending) {
 //    std::vector<int64_t> ids1, ids2;
 //    std::vector<float> dist1, dist2;
@@ -503,3 +503,58 @@ TEST_F(SearchByIdTest, BINARY) {
         ASSERT_LT(result_distances[0], 1e-4);
     }
 }
+
+TEST_F(SearchByIdTest, cached) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    table_info.index_file_size_ = milvus::engine::ONE_KB;
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    // several segments, the neighbours of an id are not only in its own segment
+    int64_t nb = 1000, insert_loop = 5;
+    for (int64_t k = 0; k < insert_loop; ++k) {
+        milvus::engine::VectorsData xb;
+        BuildVectors(nb, xb);
+        for (int64_t i = 0; i < nb; i++) {
+            xb.id_array_.push_back(k * nb + i);
+        }
+        stat = db_->InsertVectors(table_info.table_id_, "", xb);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->Flush();
+        ASSERT_TRUE(stat.ok());
+    }
+
+    stat = db_->PreloadTable(table_info.table_id_);
+    ASSERT_TRUE(stat.ok());
+
+    const int topk = 10, nprobe = 10;
+    milvus::json json_params = {{"nprobe", nprobe}};
+    std::vector<std::string> tags;
+
+    for (int64_t id = 0; id < nb * insert_loop; id += 777) {
+        milvus::engine::VectorsData vector;
+        stat = db_->GetVectorByID(table_info.table_id_, id, vector);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(vector.vector_count_, 1);
+
+        milvus::engine::ResultIds expect_ids, result_ids;
+        milvus::engine::ResultDistances expect_distances, result_distances;
+        stat = db_->Query(dummy_context_, table_info.table_id_, tags, topk, json_params, vector, expect_ids,
+                          expect_distances);
+        ASSERT_TRUE(stat.ok());
+
+        stat = db_->QueryByID(dummy_context_, table_info.table_id_, tags, topk, json_params, id, result_ids,
+                              result_distances);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(result_ids, expect_ids);
+        ASSERT_EQ(result_ids[0], id);
+    }
+
+    // absent id hits nothing
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->QueryByID(dummy_context_, table_info.table_id_, tags, topk, json_params, nb * insert_loop, result_ids,
+                          result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids[0], -1);
+}
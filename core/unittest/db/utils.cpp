@@ -287,6 +287,27 @@ MetaTest::TearDown() {
     boost::filesystem::remove_all(options.meta_.path_);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+KVMetaTest::SetUp() {
+    BaseTest::SetUp();
+
+    auto options = GetOptions();
+    boost::filesystem::remove_all(options.meta_.path_);
+    impl_ = std::make_shared<milvus::engine::meta::KVMetaImpl>(options.meta_);
+}
+
+void
+KVMetaTest::TearDown() {
+    impl_->DropAll();
+    impl_ = nullptr;
+
+    BaseTest::TearDown();
+
+    auto options = GetOptions();
+    boost::filesystem::remove_all(options.meta_.path_);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 milvus::engine::DBOptions
 MySqlDBTest:: GetOptions() {
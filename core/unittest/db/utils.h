@@ -19,6 +19,7 @@
 #include <fiu-local.h>
 
 #include "db/DB.h"
+#include "db/meta/KVMetaImpl.h"
 #include "db/meta/MySQLMetaImpl.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "scheduler/ResourceFactory.h"
@@ -119,6 +120,17 @@ class MetaTest : public BaseTest {
     TearDown() override;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class KVMetaTest : public BaseTest {
+ protected:
+    std::shared_ptr<milvus::engine::meta::KVMetaImpl> impl_;
+
+    void
+    SetUp() override;
+    void
+    TearDown() override;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class MySqlDBTest : public DBTest {
  protected:
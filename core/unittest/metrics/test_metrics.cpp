@@ -14,6 +14,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 #include <fiu-local.h>
 #include <fiu-control.h>
@@ -26,6 +27,7 @@
 #include "db/DB.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "metrics/Metrics.h"
+#include "metrics/SystemInfo.h"
 
 namespace {
 static constexpr int64_t TABLE_DIM = 256;
@@ -168,4 +170,14 @@ TEST_F(MetricTest, COLLECTOR_METRICS_TEST) {
     milvus::server::MetricCollector metric_collector();
 }
 
+TEST(SystemInfoTest, PARSE_CPU_LIST_TEST) {
+    using CpuList = std::vector<int64_t>;
+    ASSERT_EQ(milvus::server::SystemInfo::ParseCpuList("0-3,8-11"), CpuList({0, 1, 2, 3, 8, 9, 10, 11}));
+    ASSERT_EQ(milvus::server::SystemInfo::ParseCpuList("5"), CpuList({5}));
+    ASSERT_EQ(milvus::server::SystemInfo::ParseCpuList("0,2,4-5"), CpuList({0, 2, 4, 5}));
+    ASSERT_TRUE(milvus::server::SystemInfo::ParseCpuList("").empty());
 
+    // malformed ranges are skipped, the rest is kept
+    ASSERT_EQ(milvus::server::SystemInfo::ParseCpuList("x,1,,3-,-2,6-a,7"), CpuList({1, 7}));
+    ASSERT_TRUE(milvus::server::SystemInfo::ParseCpuList("4-2").empty());
+}
@@ -11,6 +11,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "scheduler/job/Job.h"
 #include "scheduler/job/BuildIndexJob.h"
 #include "scheduler/job/DeleteJob.h"
@@ -38,7 +40,30 @@ TEST(JobTest, TestJob) {
     engine::VectorsData vectors;
     auto search_ptr = std::make_shared<SearchJob>(nullptr, 1, 1, vectors);
     search_ptr->Dump();
-    search_ptr->AddIndexFile(nullptr);
+    search_ptr->AddIndexFile(nullptr, "");
+}
+
+TEST(JobTest, CANCEL) {
+    bool client_gone = false;
+    auto context = std::make_shared<server::Context>("dummy_request_id");
+    context->GetCancelToken()->SetSource([&]() { return client_gone; });
+
+    engine::VectorsData vectors;
+    auto search_ptr = std::make_shared<SearchJob>(context, 1, milvus::json(), vectors);
+    ASSERT_EQ(search_ptr->priority(), JobPriority::HIGH);
+    ASSERT_FALSE(search_ptr->Cancelled());
+
+    client_gone = true;
+    ASSERT_TRUE(search_ptr->Cancelled());
+
+    // the token is sticky and stops polling once the source is reset
+    context->GetCancelToken()->SetSource(nullptr);
+    ASSERT_TRUE(search_ptr->Cancelled());
+
+    TestJob test_job;
+    ASSERT_FALSE(test_job.Cancelled());
+    test_job.set_deadline(std::chrono::system_clock::now() - std::chrono::seconds(1));
+    ASSERT_TRUE(test_job.Cancelled());
 }
 
 }  // namespace scheduler
@@ -23,6 +23,7 @@
 #include "scheduler/optimizer/FaissIVFSQ8HPass.h"
 #include "scheduler/optimizer/FaissIVFSQ8Pass.h"
 #include "scheduler/optimizer/FallbackPass.h"
+#include "scheduler/task/TestTask.h"
 
 namespace milvus {
 namespace scheduler {
@@ -93,5 +94,40 @@ TEST(OptimizerTest, TEST_OPTIMIZER) {
 
 #endif
 
+TEST(OptimizerTest, FALLBACK_PICK_CPU_TEST) {
+    auto cpu0 = std::make_shared<CpuResource>("cpu", 0, false);
+    auto cpu1 = std::make_shared<CpuResource>("cpu1", 1, false);
+    std::vector<ResourceWPtr> cpus = {cpu0, cpu1};
+
+    auto put_loaded = [](const ResourcePtr& res, size_t count) {
+        TableFileSchemaPtr dummy = nullptr;
+        for (size_t i = 0; i < count; ++i) {
+            auto task = std::make_shared<TestTask>(std::make_shared<server::Context>("dummy_request_id"), dummy,
+                                                   nullptr);
+            res->task_table().Put(task);
+        }
+        for (size_t i = 0; i < res->task_table().size(); ++i) {
+            res->task_table()[i]->state = TaskTableItemState::LOADED;
+        }
+    };
+
+    // idle resources keep the tasks of their own node
+    ASSERT_EQ(FallbackPass::PickCpuResource(cpus, 0), cpu0);
+    ASSERT_EQ(FallbackPass::PickCpuResource(cpus, 1), cpu1);
+
+    // a small backlog on the local node is not worth leaving the node
+    put_loaded(cpu0, 6);
+    ASSERT_EQ(FallbackPass::PickCpuResource(cpus, 0), cpu0);
+
+    // a local backlog far larger than the idlest one's is stolen by the idlest resource
+    put_loaded(cpu0, 14);
+    ASSERT_EQ(FallbackPass::PickCpuResource(cpus, 0), cpu1);
+    ASSERT_EQ(FallbackPass::PickCpuResource(cpus, 1), cpu1);
+
+    // until the other node is busy too
+    put_loaded(cpu1, 8);
+    ASSERT_EQ(FallbackPass::PickCpuResource(cpus, 0), cpu0);
+}
+
 }  // namespace scheduler
 }  // namespace milvus
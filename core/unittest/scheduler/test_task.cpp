@@ -16,6 +16,10 @@
 #include <src/scheduler/SchedInst.h>
 #include <src/scheduler/resource/CpuResource.h>
 
+#include <random>
+#include <thread>
+#include <vector>
+
 #include "db/meta/SqliteMetaImpl.h"
 #include "db/DBFactory.h"
 #include "scheduler/tasklabel/BroadcastLabel.h"
@@ -196,5 +200,162 @@ TEST(TaskTest, TEST_PATH) {
     ASSERT_TRUE(empty_path.empty());
 }
 
+TEST(TaskTest, SEARCH_SLICES) {
+    auto dummy_context = std::make_shared<milvus::server::Context>("dummy_request_id");
+    TableFileSchemaPtr file = std::make_shared<engine::meta::TableFileSchema>();
+    file->id_ = 1;
+    file->dimension_ = 4;
+    file->location_ = "/tmp/milvus_test/search_slices/1";
+    file->file_type_ = TableFileSchema::FILE_TYPE::RAW;
+
+    engine::VectorsData vectors;
+    vectors.vector_count_ = 100;
+    vectors.float_data_.resize(vectors.vector_count_ * file->dimension_, 0.5);
+    auto search_job = std::make_shared<SearchJob>(dummy_context, 10, milvus::json(), vectors);
+    search_job->AddIndexFile(file, "table");
+
+    auto task = std::make_shared<XSearchTask>(dummy_context, file, nullptr);
+    task->job_ = search_job;
+    ASSERT_EQ(XSearchTask::SplitByQueries(task, 1).size(), 1);
+
+    auto tasks = XSearchTask::SplitByQueries(task, 3);
+    ASSERT_EQ(tasks.size(), 3);
+    uint64_t query_end = 0;
+    for (auto& slice : tasks) {
+        auto search_task = std::static_pointer_cast<XSearchTask>(slice);
+        ASSERT_TRUE(search_task->IsSlice());
+        ASSERT_EQ(search_task->query_begin_, query_end);
+        query_end = search_task->query_end_;
+        search_task->MarkQueued();
+    }
+    ASSERT_EQ(query_end, vectors.vector_count_);
+    ASSERT_EQ(XSearchTask::QueuedSearches(file->location_), 3);
+
+    // the job is done only after every slice is done
+    search_job->set_deadline(std::chrono::system_clock::now() - std::chrono::seconds(1));
+    tasks[0]->Load(LoadType::DISK2CPU, 0);
+    tasks[0]->Load(LoadType::DISK2CPU, 0);
+    tasks[1]->Load(LoadType::DISK2CPU, 0);
+    ASSERT_FALSE(search_job->index_files().empty());
+    tasks[2]->Load(LoadType::DISK2CPU, 0);
+    ASSERT_TRUE(search_job->index_files().empty());
+    ASSERT_EQ(XSearchTask::QueuedSearches(file->location_), 0);
+}
+
+TEST(TaskTest, SEARCH_SLICES_RESULT) {
+    auto dummy_context = std::make_shared<milvus::server::Context>("dummy_request_id");
+    opentracing::mocktracer::MockTracerOptions tracer_options;
+    auto mock_tracer =
+        std::shared_ptr<opentracing::Tracer>{new opentracing::mocktracer::MockTracer{std::move(tracer_options)}};
+    auto mock_span = mock_tracer->StartSpan("mock_span");
+    auto trace_context = std::make_shared<milvus::tracing::TraceContext>(mock_span);
+    dummy_context->SetTraceContext(trace_context);
+
+    const int64_t dim = 16, nb = 2000, nq = 10, topk = 5;
+    TableFileSchemaPtr file = std::make_shared<engine::meta::TableFileSchema>();
+    file->id_ = 2;
+    file->dimension_ = dim;
+    file->row_count_ = nb;
+    file->location_ = "/tmp/milvus_test/search_slices/2";
+    file->file_type_ = TableFileSchema::FILE_TYPE::RAW;
+    file->engine_type_ = static_cast<int>(EngineType::FAISS_IDMAP);
+    file->metric_type_ = static_cast<int>(MetricType::L2);
+
+    std::default_random_engine random;
+    std::uniform_real_distribution<float> distribution(0.0, 1.0);
+    std::vector<float> xb(nb * dim);
+    std::vector<int64_t> ids(nb);
+    for (int64_t i = 0; i < nb; ++i) {
+        ids[i] = i;
+        for (int64_t d = 0; d < dim; ++d) {
+            xb[i * dim + d] = distribution(random);
+        }
+    }
+    auto engine = EngineFactory::Build(dim, file->location_, EngineType::FAISS_IDMAP, MetricType::L2, milvus::json());
+    ASSERT_TRUE(engine->AddWithIds(nb, xb.data(), ids.data()).ok());
+
+    // the queries are the first rows, and are mixed with a little noise to make the order of the results matter
+    engine::VectorsData vectors;
+    vectors.vector_count_ = nq;
+    vectors.float_data_.assign(xb.begin(), xb.begin() + nq * dim);
+    for (auto& value : vectors.float_data_) {
+        value += distribution(random) * 0.01f;
+    }
+
+    // the slices run at the same time, the last one gathered reduces the result into the job
+    auto search = [&](uint64_t slice_count, ResultIds& result_ids, ResultDistances& result_distances) {
+        auto search_job = std::make_shared<SearchJob>(dummy_context, topk, milvus::json(), vectors);
+        search_job->AddIndexFile(file, "table");
+        auto task = std::make_shared<XSearchTask>(dummy_context, file, nullptr);
+        task->job_ = search_job;
+        auto tasks = XSearchTask::SplitByQueries(task, slice_count);
+        ASSERT_EQ(tasks.size(), slice_count);
+
+        std::vector<std::thread> threads;
+        for (auto& slice : tasks) {
+            auto search_task = std::static_pointer_cast<XSearchTask>(slice);
+            search_task->index_engine_ = engine;
+            threads.emplace_back([search_task]() { search_task->Execute(); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        ASSERT_TRUE(search_job->GetStatus().ok());
+        ASSERT_TRUE(search_job->index_files().empty());
+        result_ids = search_job->GetResultIds("table");
+        result_distances = search_job->GetResultDistances("table");
+    };
+
+    ResultIds whole_ids, split_ids;
+    ResultDistances whole_distances, split_distances;
+    search(1, whole_ids, whole_distances);
+    ASSERT_EQ(whole_ids.size(), nq * topk);
+    for (int64_t i = 0; i < nq; ++i) {
+        ASSERT_EQ(whole_ids[i * topk], i);
+    }
+
+    // 3 slices of 3, 3 and 4 queries
+    search(3, split_ids, split_distances);
+    ASSERT_EQ(split_ids, whole_ids);
+    ASSERT_EQ(split_distances, whole_distances);
+}
+
+TEST(TaskTest, BUILD_MGR) {
+    BuildMgr build_mgr(2, 100, 8);
+    ASSERT_TRUE(build_mgr.Fits(2, 100));
+    ASSERT_FALSE(build_mgr.Fits(3, 10));
+    // a single build larger than the budget still runs when nothing else is running
+    ASSERT_TRUE(build_mgr.Fits(1, 200));
+    ASSERT_FALSE(build_mgr.Fits(2, 200));
+
+    build_mgr.Take(80);
+    ASSERT_EQ(build_mgr.ThreadsPerBuild(), 8);
+    ASSERT_FALSE(build_mgr.Fits(1, 30));
+    ASSERT_TRUE(build_mgr.Fits(1, 20));
+
+    build_mgr.Take(20);
+    ASSERT_EQ(build_mgr.NumOfAvailable(), 0);
+    ASSERT_EQ(build_mgr.ThreadsPerBuild(), 4);
+
+    build_mgr.Put(80);
+    build_mgr.Put(20);
+    ASSERT_EQ(build_mgr.NumOfAvailable(), 2);
+
+    auto file = std::make_shared<TableFileSchema>();
+    file->file_type_ = TableFileSchema::FILE_TYPE::TO_INDEX;
+    file->engine_type_ = (int)engine::EngineType::FAISS_IVFSQ8;
+    file->metric_type_ = (int)engine::MetricType::L2;
+    file->index_params_ = "{ \"nlist\": 16384 }";
+    file->dimension_ = 64;
+    file->row_count_ = 1000;
+    XBuildIndexTask sq8_task(file, nullptr);
+    ASSERT_EQ(sq8_task.EstimatedMemory(), 1000 * 64 * 4 + 1000 * 64 + 1000 * 8);
+
+    file->engine_type_ = (int)engine::EngineType::FAISS_IVFFLAT;
+    XBuildIndexTask flat_task(file, nullptr);
+    ASSERT_GT(flat_task.EstimatedMemory(), sq8_task.EstimatedMemory());
+}
+
 }  // namespace scheduler
 }  // namespace milvus
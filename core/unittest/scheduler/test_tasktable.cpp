@@ -11,6 +11,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "scheduler/TaskTable.h"
 #include "scheduler/task/TestTask.h"
 
@@ -255,6 +257,71 @@ TEST_F(TaskTableBaseTest, PICK_TO_LOAD_CACHE) {
     ASSERT_EQ(indexes[0] % empty_table_.capacity(), 2);
 }
 
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_LOADED_BEHIND) {
+    const size_t NUM_TASKS = 4;
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        empty_table_.Put(task1_);
+    }
+    empty_table_[1]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    empty_table_[2]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    empty_table_[3]->state = milvus::scheduler::TaskTableItemState::LOADED;
+
+    // loaded tasks behind the picked one don't stop loading
+    auto indexes = empty_table_.PickToLoad(1);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 0);
+
+    // three loaded tasks in front of it do
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    empty_table_[3]->state = milvus::scheduler::TaskTableItemState::START;
+    indexes = empty_table_.PickToLoad(1);
+    ASSERT_TRUE(indexes.empty());
+}
+
+namespace {
+
+class PriorityJob : public milvus::scheduler::Job {
+ public:
+    explicit PriorityJob(milvus::scheduler::JobPriority priority) : Job(milvus::scheduler::JobType::SEARCH) {
+        set_priority(priority);
+    }
+};
+
+}  // namespace
+
+TEST_F(TaskTableBaseTest, PICK_BY_PRIORITY) {
+    milvus::scheduler::TableFileSchemaPtr dummy = nullptr;
+    auto low_job = std::make_shared<PriorityJob>(milvus::scheduler::JobPriority::LOW);
+    auto high_job = std::make_shared<PriorityJob>(milvus::scheduler::JobPriority::HIGH);
+    auto late_job = std::make_shared<PriorityJob>(milvus::scheduler::JobPriority::HIGH);
+    auto expired_job = std::make_shared<PriorityJob>(milvus::scheduler::JobPriority::LOW);
+    high_job->set_deadline(std::chrono::system_clock::now() + std::chrono::hours(1));
+    expired_job->set_deadline(std::chrono::system_clock::now() - std::chrono::seconds(1));
+
+    std::vector<std::shared_ptr<PriorityJob>> jobs{low_job, late_job, high_job, expired_job};
+    for (auto& job : jobs) {
+        auto task = std::make_shared<milvus::scheduler::TestTask>(
+            std::make_shared<milvus::server::Context>("dummy_request_id"), dummy, nullptr);
+        task->job_ = job;
+        empty_table_.Put(task);
+    }
+
+    // expired first, then high priority with the earliest deadline, FIFO for the rest
+    auto indexes = empty_table_.PickToLoad(4);
+    ASSERT_EQ(indexes.size(), 4);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 3);
+    ASSERT_EQ(indexes[1] % empty_table_.capacity(), 2);
+    ASSERT_EQ(indexes[2] % empty_table_.capacity(), 1);
+    ASSERT_EQ(indexes[3] % empty_table_.capacity(), 0);
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        empty_table_[i]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    }
+    indexes = empty_table_.PickToExecute(1);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 3);
+}
+
 TEST_F(TaskTableBaseTest, PICK_TO_EXECUTE) {
     const size_t NUM_TASKS = 10;
     for (size_t i = 0; i < NUM_TASKS; ++i) {
@@ -12,6 +12,8 @@
 #include <gtest/gtest.h>
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <set>
+#include <string>
 #include "utils/Error.h"
 #include "wrapper/VecIndex.h"
 
@@ -33,6 +35,12 @@ class LessItemCacheMgr : public milvus::cache::CacheMgr<milvus::cache::DataObjPt
     }
 };
 
+class NumaCacheMgr : public milvus::cache::CpuCacheMgr {
+ public:
+    explicit NumaCacheMgr(uint64_t node_count) : CpuCacheMgr(node_count) {
+    }
+};
+
 class MockVecIndex : public milvus::engine::VecIndex {
  public:
     MockVecIndex(int64_t dim, int64_t total) : dimension_(dim), ntotal_(total) {
@@ -187,6 +195,58 @@ TEST(CacheTest, CPU_CACHE_TEST) {
 //    delete cpu_cache_mgr;
 }
 
+TEST(CacheTest, NUMA_PARTITION_TEST) {
+    const int64_t gbyte = 1024 * 1024 * 1024;
+    const uint64_t node_count = 4;
+    NumaCacheMgr numa_mgr(node_count);
+    ASSERT_EQ(numa_mgr.NodeCount(), node_count);
+
+    // the capacity is split evenly between the nodes
+    numa_mgr.SetCapacity(8 * gbyte);
+    ASSERT_EQ(numa_mgr.CacheCapacity(), 8 * gbyte);
+    for (uint64_t node = 0; node < node_count; ++node) {
+        ASSERT_EQ(numa_mgr.CacheCapacity(node), 2 * gbyte);
+    }
+    ASSERT_EQ(numa_mgr.CacheCapacity(node_count), 0);
+
+    // all items of a segment map to the node of its directory
+    std::string segment_dir = "/tmp/milvus/tables/table_1/segment_1";
+    auto node = numa_mgr.NodeOf(segment_dir + "/file_1");
+    ASSERT_LT(node, node_count);
+    ASSERT_EQ(numa_mgr.NodeOf(segment_dir + "/file_1.uids"), node);
+    ASSERT_EQ(numa_mgr.NodeOf(segment_dir + "/file_1.block_3"), node);
+    ASSERT_EQ(numa_mgr.NodeOf(segment_dir + "/file_2"), node);
+
+    // segments spread over the nodes
+    std::set<uint64_t> nodes;
+    for (int64_t i = 0; i < 100; ++i) {
+        nodes.insert(numa_mgr.NodeOf("/tmp/milvus/tables/table_1/segment_" + std::to_string(i) + "/file"));
+    }
+    ASSERT_GT(nodes.size(), 1);
+
+    // an item is charged to its own node only
+    milvus::engine::VecIndexPtr mock_index = std::make_shared<MockVecIndex>(256, 1000);
+    numa_mgr.InsertItem(segment_dir + "/file_1", mock_index);
+    ASSERT_TRUE(numa_mgr.ItemExists(segment_dir + "/file_1"));
+    ASSERT_EQ(numa_mgr.ItemCount(), 1);
+    for (uint64_t i = 0; i < node_count; ++i) {
+        if (i == node) {
+            ASSERT_GT(numa_mgr.CacheUsage(i), 0);
+        } else {
+            ASSERT_EQ(numa_mgr.CacheUsage(i), 0);
+        }
+    }
+    ASSERT_EQ(numa_mgr.CacheUsage(), numa_mgr.CacheUsage(node));
+
+    numa_mgr.EraseItem(segment_dir + "/file_1");
+    ASSERT_EQ(numa_mgr.ItemCount(), 0);
+
+    // a single partition holds everything
+    NumaCacheMgr single_mgr(1);
+    ASSERT_EQ(single_mgr.NodeCount(), 1);
+    ASSERT_EQ(single_mgr.NodeOf(segment_dir + "/file_1"), 0);
+}
+
 #ifdef MILVUS_GPU_VERSION
 TEST(CacheTest, GPU_CACHE_TEST) {
     auto gpu_mgr = milvus::cache::GpuCacheMgr::GetInstance(0);
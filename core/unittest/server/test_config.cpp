@@ -158,6 +158,31 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetServerConfigWebPort(str_val).ok());
     ASSERT_TRUE(str_val == web_port);
 
+    int64_t dql_queue_limit = 64;
+    ASSERT_TRUE(config.SetServerConfigDqlQueueLimit(std::to_string(dql_queue_limit)).ok());
+    ASSERT_TRUE(config.GetServerConfigDqlQueueLimit(int64_val).ok());
+    ASSERT_TRUE(int64_val == dql_queue_limit);
+
+    int64_t ddl_dml_queue_limit = 16;
+    ASSERT_TRUE(config.SetServerConfigDdlDmlQueueLimit(std::to_string(ddl_dml_queue_limit)).ok());
+    ASSERT_TRUE(config.GetServerConfigDdlDmlQueueLimit(int64_val).ok());
+    ASSERT_TRUE(int64_val == ddl_dml_queue_limit);
+
+    int64_t info_queue_limit = 8;
+    ASSERT_TRUE(config.SetServerConfigInfoQueueLimit(std::to_string(info_queue_limit)).ok());
+    ASSERT_TRUE(config.GetServerConfigInfoQueueLimit(int64_val).ok());
+    ASSERT_TRUE(int64_val == info_queue_limit);
+
+    int64_t dql_concurrency = 1;
+    ASSERT_TRUE(config.SetServerConfigDqlConcurrency(std::to_string(dql_concurrency)).ok());
+    ASSERT_TRUE(config.GetServerConfigDqlConcurrency(int64_val).ok());
+    ASSERT_TRUE(int64_val == dql_concurrency);
+
+    int64_t info_concurrency = 1;
+    ASSERT_TRUE(config.SetServerConfigInfoConcurrency(std::to_string(info_concurrency)).ok());
+    ASSERT_TRUE(config.GetServerConfigInfoConcurrency(int64_val).ok());
+    ASSERT_TRUE(int64_val == info_concurrency);
+
     std::string server_mode = "cluster_readonly";
     ASSERT_TRUE(config.SetServerConfigDeployMode(server_mode).ok());
     ASSERT_TRUE(config.GetServerConfigDeployMode(str_val).ok());
@@ -230,6 +255,21 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetStorageConfigS3Bucket(str_val).ok());
     ASSERT_TRUE(str_val == storage_s3_bucket);
 
+    std::string storage_s3_cache_path = "/tmp/milvus_s3_cache";
+    ASSERT_TRUE(config.SetStorageConfigS3CachePath(storage_s3_cache_path).ok());
+    ASSERT_TRUE(config.GetStorageConfigS3CachePath(str_val).ok());
+    ASSERT_TRUE(str_val == storage_s3_cache_path);
+
+    int64_t storage_s3_cache_capacity = 8;
+    ASSERT_TRUE(config.SetStorageConfigS3CacheCapacity(std::to_string(storage_s3_cache_capacity)).ok());
+    ASSERT_TRUE(config.GetStorageConfigS3CacheCapacity(int64_val).ok());
+    ASSERT_TRUE(int64_val == storage_s3_cache_capacity);
+
+    std::string storage_file_io_mode = "direct";
+    ASSERT_TRUE(config.SetStorageConfigFileIOMode(storage_file_io_mode).ok());
+    ASSERT_TRUE(config.GetStorageConfigFileIOMode(str_val).ok());
+    ASSERT_TRUE(str_val == storage_file_io_mode);
+
     /* metric config */
     bool metric_enable_monitor = false;
     ASSERT_TRUE(config.SetMetricConfigEnableMonitor(std::to_string(metric_enable_monitor)).ok());
@@ -267,6 +307,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetCacheConfigCacheInsertData(bool_val).ok());
     ASSERT_TRUE(bool_val == cache_insert_data);
 
+    bool cache_cpu_cache_numa_aware = true;
+    ASSERT_TRUE(config.SetCacheConfigCpuCacheNumaAware(std::to_string(cache_cpu_cache_numa_aware)).ok());
+    ASSERT_TRUE(config.GetCacheConfigCpuCacheNumaAware(bool_val).ok());
+    ASSERT_TRUE(bool_val == cache_cpu_cache_numa_aware);
+
     /* engine config */
     int64_t engine_use_blas_threshold = 50;
     ASSERT_TRUE(config.SetEngineConfigUseBlasThreshold(std::to_string(engine_use_blas_threshold)).ok());
@@ -283,6 +328,21 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetEngineConfigUseAVX512(bool_val).ok());
     ASSERT_TRUE(bool_val == engine_use_avx512);
 
+    int64_t engine_build_concurrency = 2;
+    ASSERT_TRUE(config.SetEngineConfigBuildConcurrency(std::to_string(engine_build_concurrency)).ok());
+    ASSERT_TRUE(config.GetEngineConfigBuildConcurrency(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_build_concurrency);
+
+    int64_t engine_build_memory_budget = 8;
+    ASSERT_TRUE(config.SetEngineConfigBuildMemoryBudget(std::to_string(engine_build_memory_budget)).ok());
+    ASSERT_TRUE(config.GetEngineConfigBuildMemoryBudget(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_build_memory_budget);
+
+    int64_t engine_train_points_per_centroid = 0;
+    ASSERT_TRUE(config.SetEngineConfigTrainPointsPerCentroid(std::to_string(engine_train_points_per_centroid)).ok());
+    ASSERT_TRUE(config.GetEngineConfigTrainPointsPerCentroid(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_train_points_per_centroid);
+
 #ifdef MILVUS_GPU_VERSION
     int64_t engine_gpu_search_threshold = 800;
     ASSERT_TRUE(config.SetEngineConfigGpuSearchThreshold(std::to_string(engine_gpu_search_threshold)).ok());
@@ -563,6 +623,23 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetServerConfigWebPort("99999").ok());
     ASSERT_FALSE(config.SetServerConfigWebPort("-1").ok());
 
+    ASSERT_FALSE(config.SetServerConfigDqlQueueLimit("a").ok());
+    ASSERT_FALSE(config.SetServerConfigDqlQueueLimit("0").ok());
+
+    ASSERT_FALSE(config.SetServerConfigDdlDmlQueueLimit("a").ok());
+    ASSERT_FALSE(config.SetServerConfigDdlDmlQueueLimit("0").ok());
+
+    ASSERT_FALSE(config.SetServerConfigInfoQueueLimit("a").ok());
+    ASSERT_FALSE(config.SetServerConfigInfoQueueLimit("0").ok());
+
+    ASSERT_FALSE(config.SetServerConfigDqlConcurrency("a").ok());
+    ASSERT_FALSE(config.SetServerConfigDqlConcurrency("0").ok());
+    ASSERT_FALSE(config.SetServerConfigDqlConcurrency("100000").ok());
+
+    ASSERT_FALSE(config.SetServerConfigInfoConcurrency("a").ok());
+    ASSERT_FALSE(config.SetServerConfigInfoConcurrency("0").ok());
+    ASSERT_FALSE(config.SetServerConfigInfoConcurrency("100000").ok());
+
     ASSERT_FALSE(config.SetServerConfigDeployMode("cluster").ok());
 
     ASSERT_FALSE(config.SetServerConfigTimeZone("GM").ok());
@@ -598,6 +675,10 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetStorageConfigS3Bucket("").ok());
 
+    ASSERT_FALSE(config.SetStorageConfigS3CacheCapacity("-1").ok());
+
+    ASSERT_FALSE(config.SetStorageConfigFileIOMode("mmap").ok());
+
     /* metric config */
     ASSERT_FALSE(config.SetMetricConfigEnableMonitor("Y").ok());
 
@@ -621,6 +702,7 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetCacheConfigInsertBufferSize("-1").ok());
 
     ASSERT_FALSE(config.SetCacheConfigCacheInsertData("N").ok());
+    ASSERT_FALSE(config.SetCacheConfigCpuCacheNumaAware("N").ok());
 
     /* engine config */
     ASSERT_FALSE(config.SetEngineConfigUseBlasThreshold("0xff").ok());
@@ -631,6 +713,15 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetEngineConfigUseAVX512("N").ok());
 
+    ASSERT_FALSE(config.SetEngineConfigBuildConcurrency("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigBuildConcurrency("0").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigBuildMemoryBudget("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigBuildMemoryBudget("-1").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigTrainPointsPerCentroid("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigTrainPointsPerCentroid("-1").ok());
+
 #ifdef MILVUS_GPU_VERSION
     ASSERT_FALSE(config.SetEngineConfigGpuSearchThreshold("-1").ok());
 #endif
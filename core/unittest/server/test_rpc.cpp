@@ -13,6 +13,8 @@
 #include <opentracing/mocktracer/tracer.h>
 
 #include <boost/filesystem.hpp>
+#include <chrono>
+#include <future>
 #include <thread>
 
 #include "server/Server.h"
@@ -386,6 +388,19 @@ TEST_F(RpcHandlerTest, SEARCH_TEST) {
         CopyRowRecord(row_record, record);
     }
     handler->Search(&context, &request, &response);
+    ASSERT_EQ(response.extra_params_size(), 0);
+
+    // test query profile
+    kv->set_value("{ \"nprobe\": 32, \"profile\": true }");
+    handler->Search(&context, &request, &response);
+    ASSERT_EQ(response.extra_params_size(), 1);
+    ASSERT_EQ(response.extra_params(0).key(), milvus::server::QUERY_PROFILE_KEY);
+    milvus::json profile_json = milvus::json::parse(response.extra_params(0).value());
+    ASSERT_TRUE(profile_json.contains("stages"));
+    ASSERT_TRUE(profile_json["stages"].contains(milvus::server::QUERY_STAGE_QUEUE));
+    ASSERT_TRUE(profile_json.contains("summary"));
+    ASSERT_TRUE(profile_json.contains("files"));
+    response.clear_extra_params();
 
     ::milvus::grpc::SearchInFilesParam search_in_files_param;
     std::string* file_id = search_in_files_param.add_file_id_array();
@@ -751,6 +766,26 @@ class AsyncDummyRequest : public milvus::server::BaseRequest {
         : BaseRequest(std::make_shared<milvus::server::Context>("dummy_request_id2"), dummy, true) {
     }
 };
+
+class BlockingRequest : public milvus::server::BaseRequest {
+ public:
+    milvus::Status
+    OnExecute() override {
+        started_.set_value();
+        gate_.wait();
+        return milvus::Status::OK();
+    }
+
+ public:
+    explicit BlockingRequest(std::shared_future<void> gate)
+        : BaseRequest(std::make_shared<milvus::server::Context>("blocking_request_id"),
+                      milvus::server::INFO_REQUEST_GROUP, true),
+          gate_(std::move(gate)) {
+    }
+
+    std::promise<void> started_;
+    std::shared_future<void> gate_;
+};
 }  // namespace
 
 TEST_F(RpcSchedulerTest, BASE_TASK_TEST) {
@@ -796,6 +831,14 @@ TEST_F(RpcSchedulerTest, BASE_TASK_TEST) {
     milvus::server::RequestScheduler::GetInstance().ExecuteRequest(base_task_ptr5);
     fiu_disable("RequestScheduler.PutToQueue.push_null_thread");
 
+    // a request which can't finish before its deadline is rejected instead of queued
+    std::string dummy6 = "dql6";
+    milvus::server::BaseRequestPtr late_ptr = DummyRequest::Create(dummy6);
+    late_ptr->context()->SetDeadline(std::chrono::system_clock::now() - std::chrono::seconds(1));
+    status = milvus::server::RequestScheduler::GetInstance().ExecuteRequest(late_ptr);
+    ASSERT_EQ(status.code(), milvus::SERVER_REQUEST_REJECTED);
+    ASSERT_EQ(late_ptr->WaitToFinish().code(), milvus::SERVER_REQUEST_REJECTED);
+
     request_ptr = nullptr;
     milvus::server::RequestScheduler::GetInstance().ExecuteRequest(request_ptr);
 
@@ -813,6 +856,48 @@ TEST_F(RpcSchedulerTest, BASE_TASK_TEST) {
     milvus::server::RequestScheduler::GetInstance().Stop();
 }
 
+TEST_F(RpcSchedulerTest, QUEUE_FULL_TEST) {
+    auto& scheduler = milvus::server::RequestScheduler::GetInstance();
+    milvus::server::Config& config = milvus::server::Config::GetInstance();
+
+    // groups read their limits when created, restart the scheduler to create them again
+    scheduler.Stop();
+    scheduler.Start();
+    const int64_t queue_limit = 4;
+    ASSERT_TRUE(config.SetServerConfigInfoQueueLimit(std::to_string(queue_limit)).ok());
+
+    std::promise<void> gate;
+    std::shared_future<void> gate_future = gate.get_future().share();
+
+    // occupy the only thread of the info group
+    auto running = std::make_shared<BlockingRequest>(gate_future);
+    auto started = running->started_.get_future();
+    ASSERT_TRUE(scheduler.ExecuteRequest(running).ok());
+    started.wait();
+
+    std::vector<milvus::server::BaseRequestPtr> queued;
+    for (int64_t i = 0; i < queue_limit; ++i) {
+        milvus::server::BaseRequestPtr request = std::make_shared<BlockingRequest>(gate_future);
+        ASSERT_TRUE(scheduler.ExecuteRequest(request).ok());
+        queued.push_back(request);
+    }
+
+    // the queue is full, the next request is rejected instead of blocking
+    milvus::server::BaseRequestPtr rejected = std::make_shared<BlockingRequest>(gate_future);
+    auto status = scheduler.ExecuteRequest(rejected);
+    ASSERT_EQ(status.code(), milvus::SERVER_REQUEST_REJECTED);
+    ASSERT_EQ(rejected->WaitToFinish().code(), milvus::SERVER_REQUEST_REJECTED);
+
+    gate.set_value();
+    ASSERT_TRUE(running->WaitToFinish().ok());
+    for (auto& request : queued) {
+        ASSERT_TRUE(request->WaitToFinish().ok());
+    }
+
+    ASSERT_TRUE(config.SetServerConfigInfoQueueLimit(milvus::server::CONFIG_SERVER_INFO_QUEUE_LIMIT_DEFAULT).ok());
+    scheduler.Stop();
+}
+
 TEST(RpcTest, RPC_SERVER_TEST) {
     using GrpcServer =  milvus::server::grpc::GrpcServer;
     GrpcServer& server = GrpcServer::GetInstance();
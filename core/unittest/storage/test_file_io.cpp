@@ -0,0 +1,125 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "server/Config.h"
+#include "storage/file/DirectIOReader.h"
+#include "storage/file/DirectIOUtil.h"
+#include "storage/file/DirectIOWriter.h"
+#include "storage/file/FileIOReader.h"
+#include "storage/file/FileIOWriter.h"
+#include "storage/utils.h"
+#include "utils/TimeRecorder.h"
+
+namespace {
+
+std::vector<uint8_t>
+MakeData(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = (uint8_t)(i * 31 + i / 4096);
+    }
+    return data;
+}
+
+template <typename Writer, typename Reader>
+double
+WriteReadRate(const std::string& name, const std::vector<uint8_t>& data, double& read_rate) {
+    milvus::TimeRecorder recorder("file io");
+    {
+        auto writer = std::make_shared<Writer>(name);
+        writer->write((void*)data.data(), data.size());
+    }
+    double write_span = recorder.RecordSection("write");
+
+    std::vector<uint8_t> out(data.size());
+    {
+        auto reader = std::make_shared<Reader>(name);
+        reader->read(out.data(), out.size());
+    }
+    double read_span = recorder.RecordSection("read");
+    EXPECT_TRUE(out == data);
+
+    read_rate = data.size() * 1000000.0 / read_span / 1024 / 1024;
+    return data.size() * 1000000.0 / write_span / 1024 / 1024;
+}
+
+}  // namespace
+
+TEST_F(StorageTest, DIRECT_IO_TEST) {
+    const std::string filename = "/tmp/test_direct_io";
+
+    // sizes around chunk and alignment boundaries
+    std::vector<size_t> sizes = {1, 4095, 4097, milvus::storage::DIRECT_IO_CHUNK_SIZE + 7,
+                                 milvus::storage::DIRECT_IO_CHUNK_SIZE * 3 - 1};
+    for (auto size : sizes) {
+        auto data = MakeData(size);
+        {
+            milvus::storage::DirectIOWriter writer(filename);
+            // small writes first, then the rest at once
+            size_t head = std::min<size_t>(size, 10);
+            for (size_t i = 0; i < head; ++i) {
+                writer.write(data.data() + i, 1);
+            }
+            writer.write(data.data() + head, size - head);
+            ASSERT_EQ(writer.length(), size);
+        }
+
+        milvus::storage::FileIOReader file_reader(filename);
+        ASSERT_EQ(file_reader.length(), size);
+
+        milvus::storage::DirectIOReader reader(filename);
+        ASSERT_EQ(reader.length(), size);
+        std::vector<uint8_t> out(size);
+        reader.read(out.data(), size);
+        ASSERT_TRUE(out == data);
+
+        // unaligned read in the middle
+        size_t offset = size / 3;
+        size_t count = size - offset - size / 5;
+        std::vector<uint8_t> part(count);
+        reader.seekg(offset);
+        reader.read(part.data(), count);
+        ASSERT_TRUE(std::equal(part.begin(), part.end(), data.begin() + offset));
+    }
+
+    milvus::storage::DirectIOReader reader("/tmp/test_direct_io_not_exist");
+    ASSERT_EQ(reader.length(), 0UL);
+    std::remove(filename.c_str());
+
+    auto& config = milvus::server::Config::GetInstance();
+    ASSERT_TRUE(config.SetStorageConfigFileIOMode("direct").ok());
+    ASSERT_TRUE(milvus::storage::DirectIOEnabled());
+    ASSERT_TRUE(config.SetStorageConfigFileIOMode("buffered").ok());
+    ASSERT_FALSE(milvus::storage::DirectIOEnabled());
+}
+
+TEST_F(StorageTest, FILE_IO_BENCHMARK) {
+    const std::string filename = "/tmp/test_file_io_benchmark";
+    auto data = MakeData(256 * 1024 * 1024);
+
+    double buffered_read = 0, direct_read = 0;
+    double buffered_write = WriteReadRate<milvus::storage::FileIOWriter, milvus::storage::FileIOReader>(
+        filename, data, buffered_read);
+    double direct_write = WriteReadRate<milvus::storage::DirectIOWriter, milvus::storage::DirectIOReader>(
+        filename, data, direct_read);
+    std::remove(filename.c_str());
+
+    std::cout << "buffered io: write " << buffered_write << "MB/s, read " << buffered_read << "MB/s" << std::endl;
+    std::cout << "direct io: write " << direct_write << "MB/s, read " << direct_read << "MB/s" << std::endl;
+}
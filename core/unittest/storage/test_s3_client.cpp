@@ -19,10 +19,12 @@
 #include "easyloggingpp/easylogging++.h"
 #include "server/Config.h"
 #include "storage/s3/S3ClientWrapper.h"
+#include "storage/s3/S3DiskCache.h"
 #include "storage/s3/S3IOReader.h"
 #include "storage/s3/S3IOWriter.h"
 #include "storage/IStorage.h"
 #include "storage/utils.h"
+#include "utils/CommonUtil.h"
 
 INITIALIZE_EASYLOGGINGPP
 
@@ -126,6 +128,85 @@ TEST_F(StorageTest, S3_RW_TEST) {
     storage_inst.StopService();
 }
 
+TEST_F(StorageTest, S3_PART_TEST) {
+    fiu_init(0);
+
+    const std::string index_name = "/tmp/test_index_parts";
+    const std::string cache_path = "/tmp/milvus_s3_cache";
+
+    milvus::server::Config& config = milvus::server::Config::GetInstance();
+    ASSERT_TRUE(config.SetStorageConfigS3CachePath(cache_path).ok());
+
+    auto& storage_inst = milvus::storage::S3ClientWrapper::GetInstance();
+    auto& cache_inst = milvus::storage::S3DiskCache::GetInstance();
+    fiu_enable("S3ClientWrapper.StartService.mock_enable", 1, NULL, 0);
+    ASSERT_TRUE(storage_inst.StartService().ok());
+
+    // spans three parts, the last one is partial, uploaded by multipart
+    std::string content;
+    for (int i = 0; content.length() < 2 * milvus::storage::S3_PART_SIZE + 100; ++i) {
+        content += std::to_string(i);
+    }
+    ASSERT_TRUE(storage_inst.PutObjectStr(index_name, content).ok());
+
+    size_t size = 0;
+    ASSERT_TRUE(storage_inst.GetObjectSize(index_name, size).ok());
+    ASSERT_EQ(size, content.length());
+
+    std::string file_path;
+    {
+        milvus::storage::S3IOReader reader(index_name);
+        ASSERT_EQ(reader.length(), content.length());
+
+        // a read across a part boundary only fetches the two parts, the object is not cached yet
+        size_t pos = milvus::storage::S3_PART_SIZE - 50;
+        std::string out(100, '\0');
+        reader.seekg(pos);
+        reader.read(&out[0], out.length());
+        ASSERT_EQ(out, content.substr(pos, out.length()));
+        ASSERT_FALSE(cache_inst.Get(index_name, file_path));
+
+        out.assign(content.length(), '\0');
+        reader.seekg(0);
+        reader.read(&out[0], out.length());
+        ASSERT_EQ(out, content);
+        ASSERT_TRUE(cache_inst.Get(index_name, file_path));
+        ASSERT_EQ(cache_inst.Usage(), static_cast<int64_t>(content.length()));
+    }
+
+    {
+        // served by local disk cache without touching s3
+        fiu_enable("S3ClientWrapper.GetObjectSize.outcome.fail", 1, NULL, 0);
+        milvus::storage::S3IOReader reader(index_name);
+        ASSERT_EQ(reader.length(), content.length());
+        std::string out(content.length(), '\0');
+        reader.seekg(0);
+        reader.read(&out[0], out.length());
+        ASSERT_EQ(out, content);
+        fiu_disable("S3ClientWrapper.GetObjectSize.outcome.fail");
+    }
+
+    // cache survives restart, deleting the object drops the local copy
+    ASSERT_TRUE(cache_inst.Init(cache_path, 1024 * 1024 * 1024).ok());
+    ASSERT_TRUE(cache_inst.Get(index_name, file_path));
+    ASSERT_TRUE(storage_inst.DeleteObject(index_name).ok());
+    ASSERT_FALSE(cache_inst.Get(index_name, file_path));
+    ASSERT_EQ(cache_inst.Usage(), 0);
+
+    fiu_enable("S3ClientWrapper.PutObjectMultipart.outcome.fail", 1, NULL, 0);
+    ASSERT_FALSE(storage_inst.PutObjectStr(index_name, content).ok());
+    fiu_disable("S3ClientWrapper.PutObjectMultipart.outcome.fail");
+
+    fiu_enable("S3ClientWrapper.GetObjectRange.outcome.fail", 1, NULL, 0);
+    std::vector<std::pair<size_t, size_t>> ranges = {{0, 10}};
+    ASSERT_FALSE(storage_inst.GetObjectRanges(index_name, ranges, &content[0]).ok());
+    fiu_disable("S3ClientWrapper.GetObjectRange.outcome.fail");
+
+    storage_inst.StopService();
+    ASSERT_TRUE(config.SetStorageConfigS3CachePath("").ok());
+    milvus::server::CommonUtil::DeleteDirectory(cache_path);
+}
+
 TEST_F(StorageTest, S3_FAIL_TEST) {
     fiu_init(0);
 
@@ -22,6 +22,12 @@
 #include <fiu-local.h>
 #include <gtest/gtest.h>
 
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "db/engine/BuildCheckpoint.h"
 #include "knowhere/index/vector_index/helpers/IndexParameter.h"
 #include "wrapper/VecIndex.h"
 #include "wrapper/utils.h"
@@ -189,6 +195,83 @@ TEST_P(KnowhereWrapperTest, TO_GPU_TEST) {
 
 #endif
 
+TEST_P(KnowhereWrapperTest, RESUMABLE_BUILD_TEST) {
+    auto elems = nq * k;
+    std::vector<int64_t> res_ids(elems);
+    std::vector<float> res_dis(elems);
+
+    knowhere::BinarySet model;
+    int64_t rows_added = 0;
+    milvus::engine::BuildHooks hooks;
+    hooks.trained_ = [&](const knowhere::BinarySet& binary) { model = binary; };
+    hooks.progress_ = [&](int64_t rows) { rows_added = rows; };
+    ASSERT_TRUE(index_->BuildAllResumable(nb, xb.data(), ids.data(), conf, hooks).ok());
+    EXPECT_EQ(rows_added, nb);
+    EXPECT_EQ(index_->Count(), nb);
+    index_->Search(nq, xq.data(), res_dis.data(), res_ids.data(), searchconf);
+    AssertResult(res_ids, res_dis);
+
+    // an index holding all rows already has nothing left to add
+    milvus::engine::BuildHooks partial_hooks;
+    partial_hooks.resume_partial_ = true;
+    ASSERT_TRUE(index_->BuildAllResumable(nb, xb.data(), ids.data(), conf, partial_hooks).ok());
+    EXPECT_EQ(index_->Count(), nb);
+
+    if (!model.binary_map_.empty()) {
+        auto resumed_index = GetVecIndexFactory(index_type);
+        milvus::engine::BuildHooks model_hooks;
+        model_hooks.model_ = model;
+        model_hooks.trained_ = [&](const knowhere::BinarySet& binary) { FAIL() << "trained again"; };
+        ASSERT_TRUE(resumed_index->BuildAllResumable(nb, xb.data(), ids.data(), conf, model_hooks).ok());
+        EXPECT_EQ(resumed_index->Count(), nb);
+        resumed_index->Search(nq, xq.data(), res_dis.data(), res_ids.data(), searchconf);
+        AssertResult(res_ids, res_dis);
+    }
+}
+
+TEST_P(KnowhereWrapperTest, PARTIAL_RESUME_TEST) {
+    // only HNSW keeps partially built indexes in its checkpoint
+    if (index_type != milvus::engine::IndexType::HNSW) {
+        return;
+    }
+
+    std::string location = "/tmp/milvus_partial_resume_test";
+    milvus::engine::BuildCheckpoint checkpoint(location, index_type, conf);
+    checkpoint.Remove();
+
+    // save the index after the first quarter of rows and stop there, as a restart would
+    milvus::engine::BuildHooks hooks;
+    hooks.batch_rows_ = nb / 4;
+    hooks.progress_ = [&](int64_t rows_added) {
+        EXPECT_EQ(rows_added, nb / 4);
+        EXPECT_TRUE(checkpoint.SavePartial(index_).ok());
+        throw std::runtime_error("build interrupted");
+    };
+    ASSERT_FALSE(index_->BuildAllResumable(nb, xb.data(), ids.data(), conf, hooks).ok());
+
+    auto resumed_index = GetVecIndexFactory(index_type);
+    milvus::engine::BuildHooks resume_hooks;
+    milvus::engine::BuildCheckpoint(location, index_type, conf).Restore(resumed_index, resume_hooks);
+    ASSERT_TRUE(resume_hooks.resume_partial_);
+    EXPECT_EQ(resumed_index->Count(), nb / 4);
+
+    int64_t rows_added = 0;
+    resume_hooks.progress_ = [&](int64_t rows) { rows_added = rows; };
+    ASSERT_TRUE(resumed_index->BuildAllResumable(nb, xb.data(), ids.data(), conf, resume_hooks).ok());
+    EXPECT_EQ(rows_added, nb);
+    EXPECT_EQ(resumed_index->Count(), nb);
+
+    auto elems = nq * k;
+    std::vector<int64_t> res_ids(elems);
+    std::vector<float> res_dis(elems);
+    resumed_index->Search(nq, xq.data(), res_dis.data(), res_ids.data(), searchconf);
+    AssertResult(res_ids, res_dis);
+
+    checkpoint.Remove();
+    EXPECT_FALSE(boost::filesystem::exists(location + ".build_checkpoint"));
+    EXPECT_FALSE(boost::filesystem::exists(location + ".build_checkpoint_data"));
+}
+
 TEST_P(KnowhereWrapperTest, SERIALIZE_TEST) {
     std::cout << "type: " << static_cast<int>(index_type) << std::endl;
     EXPECT_EQ(index_->GetType(), index_type);
@@ -218,6 +301,8 @@ TEST_P(KnowhereWrapperTest, SERIALIZE_TEST) {
         std::string file_location = "/tmp/knowhere";
         write_index(index_, file_location);
         auto new_index = milvus::engine::read_index(file_location);
+        // index may reference the mapped file, it must stay searchable after the file is deleted
+        std::remove(file_location.c_str());
         EXPECT_EQ(new_index->GetType(), ConvertToCpuIndexType(index_type));
         EXPECT_EQ(new_index->Dimension(), index_->Dimension());
         EXPECT_EQ(new_index->Count(), index_->Count());
@@ -332,6 +417,73 @@ TEST(BFIndex, test_bf_index_fail) {
     fiu_disable("BFIndex.Build.throw_std_exception");
 }
 
+TEST(BuildCheckpointTest, SAVE_RESTORE_TEST) {
+    std::string location = "/tmp/milvus_build_checkpoint_test";
+    std::string meta_path = location + ".build_checkpoint";
+    std::string data_path = location + ".build_checkpoint_data";
+    auto index_type = milvus::engine::IndexType::FAISS_IVFFLAT_CPU;
+    milvus::json params = {{knowhere::IndexParams::nlist, 16}};
+
+    milvus::engine::BuildCheckpoint checkpoint(location, index_type, params);
+    checkpoint.Remove();
+
+    // only HNSW saves partial indexes
+    ASSERT_TRUE(checkpoint.SavePartial(nullptr).ok());
+    EXPECT_FALSE(boost::filesystem::exists(meta_path));
+
+    const int64_t model_size = 64;
+    std::shared_ptr<uint8_t> data(new uint8_t[model_size], std::default_delete<uint8_t[]>());
+    for (int64_t i = 0; i < model_size; ++i) {
+        data.get()[i] = static_cast<uint8_t>(i);
+    }
+    knowhere::BinarySet model;
+    model.Append("IVF", data, model_size);
+    ASSERT_TRUE(checkpoint.SaveModel(model).ok());
+    EXPECT_TRUE(boost::filesystem::exists(meta_path));
+    EXPECT_TRUE(boost::filesystem::exists(data_path));
+
+    // the saved model is restored into the hooks, the index is left as is
+    {
+        milvus::engine::VecIndexPtr index = nullptr;
+        milvus::engine::BuildHooks hooks;
+        milvus::engine::BuildCheckpoint(location, index_type, params).Restore(index, hooks);
+        EXPECT_EQ(index, nullptr);
+        EXPECT_FALSE(hooks.resume_partial_);
+        auto binary = hooks.model_.GetByName("IVF");
+        ASSERT_NE(binary, nullptr);
+        ASSERT_EQ(binary->size, model_size);
+        EXPECT_EQ(memcmp(binary->data.get(), data.get(), model_size), 0);
+    }
+
+    // a checkpoint of other params is discarded
+    {
+        milvus::engine::VecIndexPtr index = nullptr;
+        milvus::engine::BuildHooks hooks;
+        milvus::json other_params = {{knowhere::IndexParams::nlist, 32}};
+        milvus::engine::BuildCheckpoint(location, index_type, other_params).Restore(index, hooks);
+        EXPECT_TRUE(hooks.model_.binary_map_.empty());
+        EXPECT_FALSE(boost::filesystem::exists(meta_path));
+        EXPECT_FALSE(boost::filesystem::exists(data_path));
+    }
+
+    // so is a checkpoint of another index type
+    ASSERT_TRUE(checkpoint.SaveModel(model).ok());
+    {
+        milvus::engine::VecIndexPtr index = nullptr;
+        milvus::engine::BuildHooks hooks;
+        milvus::engine::BuildCheckpoint(location, milvus::engine::IndexType::FAISS_IVFSQ8_CPU, params)
+            .Restore(index, hooks);
+        EXPECT_TRUE(hooks.model_.binary_map_.empty());
+        EXPECT_FALSE(boost::filesystem::exists(meta_path));
+    }
+
+    // the checkpoint of a file whose build failed is removed by location
+    ASSERT_TRUE(checkpoint.SaveModel(model).ok());
+    milvus::engine::BuildCheckpoint::Remove(location);
+    EXPECT_FALSE(boost::filesystem::exists(meta_path));
+    EXPECT_FALSE(boost::filesystem::exists(data_path));
+}
+
 // #include "knowhere/index/vector_index/IndexIDMAP.h"
 // #include "src/wrapper/VecImpl.h"
 // #include "src/index/unittest/utils.h"
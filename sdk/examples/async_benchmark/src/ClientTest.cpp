@@ -0,0 +1,212 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "examples/async_benchmark/src/ClientTest.h"
+#include "examples/utils/TimeRecorder.h"
+#include "examples/utils/Utils.h"
+#include "include/MilvusApi.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int64_t COLLECTION_DIMENSION = 128;
+constexpr int64_t COLLECTION_INDEX_FILE_SIZE = 1024;
+constexpr milvus::MetricType COLLECTION_METRIC_TYPE = milvus::MetricType::L2;
+constexpr int64_t ENTITY_COUNT = 100000;
+constexpr int64_t INSERT_ENTITY_PER_CALL = 10;  // small inserts, merged by the client side insert buffer
+constexpr int64_t NQ = 1;
+constexpr int64_t TOP_K = 10;
+constexpr int64_t NPROBE = 16;
+constexpr int64_t SEARCH_REQUEST_COUNT = 2000;
+constexpr milvus::IndexType INDEX_TYPE = milvus::IndexType::IVFFLAT;
+constexpr int32_t NLIST = 1024;
+const std::vector<int64_t> CONCURRENCY_LEVELS = {1, 2, 4, 8, 16, 32, 64};
+
+double
+ElapsedSeconds(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+ClientTest::ClientTest(const std::string& address, const std::string& port, int64_t channel_count) {
+    milvus::ConnectParam param = {address, port};
+    param.channel_count = channel_count;
+    conn_ = milvus::Connection::Create();
+    milvus::Status stat = conn_->Connect(param);
+    std::cout << "Connect function call status: " << stat.message() << std::endl;
+    collection_name_ = milvus_sdk::Utils::GenCollectionName();
+}
+
+ClientTest::~ClientTest() {
+    milvus::Status stat = milvus::Connection::Destroy(conn_);
+    std::cout << "Destroy connection function call status: " << stat.message() << std::endl;
+}
+
+void
+ClientTest::CreateCollection() {
+    milvus::CollectionParam collection_param = {collection_name_, COLLECTION_DIMENSION, COLLECTION_INDEX_FILE_SIZE,
+                                                COLLECTION_METRIC_TYPE};
+    milvus::Status stat = conn_->CreateCollection(collection_param);
+    std::cout << "CreateCollection function call status: " << stat.message() << std::endl;
+}
+
+void
+ClientTest::InsertEntities() {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t submitted = 0, inserted = 0, failed = 0;
+    milvus::Status stat;
+
+    {
+        milvus_sdk::TimeRecorder rc("Buffered insert " + std::to_string(ENTITY_COUNT) + " entities");
+        for (int64_t begin = 0; begin < ENTITY_COUNT; begin += INSERT_ENTITY_PER_CALL) {
+            std::vector<milvus::Entity> entity_array;
+            std::vector<int64_t> entity_ids;
+            milvus_sdk::Utils::BuildEntities(begin, begin + INSERT_ENTITY_PER_CALL, entity_array, entity_ids,
+                                             COLLECTION_DIMENSION);
+            if (begin == 0) {
+                query_entities_.assign(entity_array.begin(), entity_array.begin() + NQ);
+            }
+
+            auto count = static_cast<int64_t>(entity_array.size());
+            auto callback = [&, count](const milvus::Status& status, const std::vector<int64_t>& id_array) {
+                std::lock_guard<std::mutex> lock(mutex);
+                inserted += count;
+                failed += status.ok() ? 0 : count;
+                cv.notify_one();
+            };
+            stat = conn_->BufferedInsert(collection_name_, "", entity_array, entity_ids, callback);
+            if (!stat.ok()) {
+                std::cout << "BufferedInsert function call status: " << stat.message() << std::endl;
+                break;
+            }
+            submitted += count;
+        }
+        conn_->FlushInsertBuffer();
+
+        // the callbacks refer to the locals above, wait for all of them even if buffering failed
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return inserted == submitted; });
+    }
+    std::cout << "Inserted " << inserted - failed << " entities, " << failed << " failed" << std::endl;
+    if (!stat.ok()) {
+        return;
+    }
+
+    conn_->FlushCollection(collection_name_);
+
+    JSON json_params = {{"nlist", NLIST}};
+    milvus::IndexParam index_param = {collection_name_, INDEX_TYPE, json_params.dump()};
+    milvus_sdk::TimeRecorder rc("Create index");
+    stat = conn_->CreateIndex(index_param);
+    std::cout << "CreateIndex function call status: " << stat.message() << std::endl;
+    conn_->PreloadCollection(collection_name_);
+}
+
+double
+ClientTest::SyncSearchQps(int64_t concurrency) {
+    JSON json_params = {{"nprobe", NPROBE}};
+    std::string extra_params = json_params.dump();
+    std::atomic<int64_t> next_request(0);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int64_t i = 0; i < concurrency; ++i) {
+        threads.emplace_back([&] {
+            while (next_request++ < SEARCH_REQUEST_COUNT) {
+                milvus::TopKQueryResult topk_query_result;
+                conn_->Search(collection_name_, {}, query_entities_, TOP_K, extra_params, topk_query_result);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return SEARCH_REQUEST_COUNT / ElapsedSeconds(start);
+}
+
+double
+ClientTest::AsyncSearchQps(int64_t concurrency) {
+    JSON json_params = {{"nprobe", NPROBE}};
+    std::string extra_params = json_params.dump();
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t sent = 0, done = 0;
+
+    // every completed search sends the next one, so there are always concurrency requests in flight
+    std::function<void()> send_one;
+    auto on_done = [&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++done;
+        if (sent < SEARCH_REQUEST_COUNT) {
+            ++sent;
+            lock.unlock();
+            send_one();
+        } else if (done == SEARCH_REQUEST_COUNT) {
+            cv.notify_one();
+        }
+    };
+    send_one = [&] {
+        milvus::Status stat = conn_->SearchAsync(
+            collection_name_, {}, query_entities_, TOP_K, extra_params,
+            [&](const milvus::Status& status, const milvus::TopKQueryResult& topk_query_result) { on_done(); });
+        if (!stat.ok()) {
+            on_done();
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    int64_t initial = std::min(concurrency, SEARCH_REQUEST_COUNT);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sent = initial;
+    }
+    for (int64_t i = 0; i < initial; ++i) {
+        send_one();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return done == SEARCH_REQUEST_COUNT; });
+    return SEARCH_REQUEST_COUNT / ElapsedSeconds(start);
+}
+
+void
+ClientTest::DropCollection() {
+    milvus::Status stat = conn_->DropCollection(collection_name_);
+    std::cout << "DropCollection function call status: " << stat.message() << std::endl;
+}
+
+void
+ClientTest::Test() {
+    CreateCollection();
+    InsertEntities();
+
+    std::cout << std::setw(12) << "concurrency" << std::setw(16) << "sync qps" << std::setw(16) << "async qps"
+              << std::endl;
+    for (auto concurrency : CONCURRENCY_LEVELS) {
+        double sync_qps = SyncSearchQps(concurrency);
+        double async_qps = AsyncSearchQps(concurrency);
+        std::cout << std::setw(12) << concurrency << std::setw(16) << std::fixed << std::setprecision(1) << sync_qps
+                  << std::setw(16) << async_qps << std::endl;
+    }
+
+    DropCollection();
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <MilvusApi.h>
+
+/*
+ * Measures search QPS against the number of requests in flight, once with one thread per in-flight
+ * synchronous Search and once with asynchronous SearchAsync calls from a single thread.
+ */
+class ClientTest {
+ public:
+    ClientTest(const std::string& address, const std::string& port, int64_t channel_count);
+    ~ClientTest();
+
+    void
+    Test();
+
+ private:
+    void
+    CreateCollection();
+
+    void
+    InsertEntities();
+
+    double
+    SyncSearchQps(int64_t concurrency);
+
+    double
+    AsyncSearchQps(int64_t concurrency);
+
+    void
+    DropCollection();
+
+ private:
+    std::shared_ptr<milvus::Connection> conn_;
+    std::string collection_name_;
+    std::vector<milvus::Entity> query_entities_;
+};
@@ -11,6 +11,7 @@
 
 #include "grpc/ClientProxy.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,6 +23,7 @@
 namespace milvus {
 
 static const char* EXTRA_PARAM_KEY = "params";
+static const char* CHANNEL_INDEX_ARG = "milvus.channel_index";
 
 bool
 UriCheck(const std::string& uri) {
@@ -60,6 +62,61 @@ CopyRowRecord(::milvus::grpc::RowRecord* target, const Entity& src) {
     }
 }
 
+void
+ConstructInsertParam(const std::string& collection_name, const std::string& partition_tag,
+                     const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                     ::milvus::grpc::InsertParam& insert_param) {
+    insert_param.set_table_name(collection_name);
+    insert_param.set_partition_tag(partition_tag);
+
+    for (auto& entity : entity_array) {
+        ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
+        CopyRowRecord(grpc_record, entity);
+    }
+
+    if (!id_array.empty()) {
+        /* set user's ids */
+        auto row_ids = insert_param.mutable_row_id_array();
+        row_ids->Resize(static_cast<int>(id_array.size()), -1);
+        memcpy(row_ids->mutable_data(), id_array.data(), id_array.size() * sizeof(int64_t));
+    }
+}
+
+void
+ConstructEntity(const ::milvus::grpc::VectorData& grpc_data, Entity& entity_data) {
+    int float_size = grpc_data.vector_data().float_data_size();
+    if (float_size > 0) {
+        entity_data.float_data.resize(float_size);
+        memcpy(entity_data.float_data.data(), grpc_data.vector_data().float_data().data(),
+               float_size * sizeof(float));
+    }
+
+    auto byte_size = grpc_data.vector_data().binary_data().length();
+    if (byte_size > 0) {
+        entity_data.binary_data.resize(byte_size);
+        memcpy(entity_data.binary_data.data(), grpc_data.vector_data().binary_data().data(), byte_size);
+    }
+}
+
+void
+ConstructTopKQueryResult(const ::milvus::grpc::TopKQueryResult& result, TopKQueryResult& topk_query_result) {
+    if (result.row_num() == 0) {
+        return;
+    }
+
+    topk_query_result.reserve(result.row_num());
+    int64_t nq = result.row_num();
+    int64_t topk = result.ids().size() / nq;
+    for (int64_t i = 0; i < result.row_num(); i++) {
+        milvus::QueryResult one_result;
+        one_result.ids.resize(topk);
+        one_result.distances.resize(topk);
+        memcpy(one_result.ids.data(), result.ids().data() + topk * i, topk * sizeof(int64_t));
+        memcpy(one_result.distances.data(), result.distances().data() + topk * i, topk * sizeof(float));
+        topk_query_result.emplace_back(one_result);
+    }
+}
+
 void
 ConstructPartitionStat(const ::milvus::grpc::PartitionStat& grpc_partition_stat, PartitionStat& partition_stat) {
     partition_stat.tag = grpc_partition_stat.tag();
@@ -71,6 +128,8 @@ ConstructPartitionStat(const ::milvus::grpc::PartitionStat& grpc_partition_stat,
         seg_stat.segment_name = grpc_seg_stat.segment_name();
         seg_stat.index_name = grpc_seg_stat.index_name();
         seg_stat.data_size = grpc_seg_stat.data_size();
+        seg_stat.build_stage = grpc_seg_stat.build_stage();
+        seg_stat.built_count = grpc_seg_stat.built_count();
         partition_stat.segments_stat.emplace_back(seg_stat);
     }
 }
@@ -79,16 +138,37 @@ Status
 ClientProxy::Connect(const ConnectParam& param) {
     std::string uri = param.ip_address + ":" + param.port;
 
-    channel_ = ::grpc::CreateChannel(uri, ::grpc::InsecureChannelCredentials());
-    if (channel_ != nullptr) {
-        connected_ = true;
-        client_ptr_ = std::make_shared<GrpcClient>(channel_);
-        return Status::OK();
+    // the old batcher flushes through the old clients, so it must be gone before they are replaced
+    insert_batcher_ = nullptr;
+
+    std::vector<std::shared_ptr<GrpcClient>> clients;
+    for (int64_t i = 0; i < std::max<int64_t>(param.channel_count, 1); ++i) {
+        // channels with different arguments don't share the underlying connection
+        ::grpc::ChannelArguments args;
+        args.SetInt(CHANNEL_INDEX_ARG, static_cast<int>(i));
+        auto channel = ::grpc::CreateCustomChannel(uri, ::grpc::InsecureChannelCredentials(), args);
+        if (channel == nullptr) {
+            connected_ = false;
+            return Status(StatusCode::NotConnected, "Connect failed!");
+        }
+        clients.emplace_back(std::make_shared<GrpcClient>(channel));
     }
+    clients_.swap(clients);
 
-    std::string reason = "Connect failed!";
-    connected_ = false;
-    return Status(StatusCode::NotConnected, reason);
+    insert_batcher_ = std::make_shared<InsertBatcher>(
+        [this](const ::milvus::grpc::InsertParam& insert_param, const InsertBatcher::VectorIdsCallback& callback) {
+            auto client = Client();
+            if (client == nullptr) {
+                ::milvus::grpc::VectorIds vector_ids;
+                callback(Status(StatusCode::NotConnected, "Not connected to server"), vector_ids);
+                return;
+            }
+            client->InsertAsync(insert_param, callback);
+        },
+        param.insert_batch_rows, param.insert_batch_delay_ms);
+
+    connected_ = true;
+    return Status::OK();
 }
 
 Status
@@ -109,7 +189,7 @@ Status
 ClientProxy::Connected() const {
     try {
         std::string info;
-        return client_ptr_->Cmd("", info);
+        return Client()->Cmd("", info);
     } catch (std::exception& ex) {
         return Status(StatusCode::NotConnected, "Connection lost: " + std::string(ex.what()));
     }
@@ -118,9 +198,14 @@ ClientProxy::Connected() const {
 Status
 ClientProxy::Disconnect() {
     try {
-        Status status = client_ptr_->Disconnect();
+        // buffered inserts are sent, and the clients wait for the replies of pending calls when destroyed
+        insert_batcher_ = nullptr;
+        Status status = Status::OK();
+        for (auto& client : clients_) {
+            status = client->Disconnect();
+        }
         connected_ = false;
-        channel_.reset();
+        clients_.clear();
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to disconnect: " + std::string(ex.what()));
@@ -137,7 +222,7 @@ ClientProxy::ServerVersion() const {
     Status status = Status::OK();
     try {
         std::string version;
-        Status status = client_ptr_->Cmd("version", version);
+        Status status = Client()->Cmd("version", version);
         return version;
     } catch (std::exception& ex) {
         return "";
@@ -146,13 +231,13 @@ ClientProxy::ServerVersion() const {
 
 std::string
 ClientProxy::ServerStatus() const {
-    if (channel_ == nullptr) {
+    if (clients_.empty()) {
         return "not connected to server";
     }
 
     try {
         std::string dummy;
-        Status status = client_ptr_->Cmd("", dummy);
+        Status status = Client()->Cmd("", dummy);
         return "server alive";
     } catch (std::exception& ex) {
         return "connection lost";
@@ -162,7 +247,7 @@ ClientProxy::ServerStatus() const {
 Status
 ClientProxy::GetConfig(const std::string& node_name, std::string& value) const {
     try {
-        return client_ptr_->Cmd("get_config " + node_name, value);
+        return Client()->Cmd("get_config " + node_name, value);
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to get config: " + node_name);
     }
@@ -172,7 +257,7 @@ Status
 ClientProxy::SetConfig(const std::string& node_name, const std::string& value) const {
     try {
         std::string dummy;
-        return client_ptr_->Cmd("set_config " + node_name + " " + value, dummy);
+        return Client()->Cmd("set_config " + node_name + " " + value, dummy);
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to set config: " + node_name);
     }
@@ -187,7 +272,7 @@ ClientProxy::CreateCollection(const CollectionParam& param) {
         schema.set_index_file_size(param.index_file_size);
         schema.set_metric_type(static_cast<int32_t>(param.metric_type));
 
-        return client_ptr_->CreateTable(schema);
+        return Client()->CreateTable(schema);
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to create collection: " + std::string(ex.what()));
     }
@@ -198,7 +283,7 @@ ClientProxy::HasCollection(const std::string& collection_name) {
     Status status = Status::OK();
     ::milvus::grpc::TableName grpc_collection_name;
     grpc_collection_name.set_table_name(collection_name);
-    bool result = client_ptr_->HasTable(grpc_collection_name, status);
+    bool result = Client()->HasTable(grpc_collection_name, status);
     return result;
 }
 
@@ -207,7 +292,7 @@ ClientProxy::DropCollection(const std::string& collection_name) {
     try {
         ::milvus::grpc::TableName grpc_collection_name;
         grpc_collection_name.set_table_name(collection_name);
-        return client_ptr_->DropTable(grpc_collection_name);
+        return Client()->DropTable(grpc_collection_name);
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to drop collection: " + std::string(ex.what()));
     }
@@ -222,7 +307,7 @@ ClientProxy::CreateIndex(const IndexParam& index_param) {
         milvus::grpc::KeyValuePair* kv = grpc_index_param.add_extra_params();
         kv->set_key(EXTRA_PARAM_KEY);
         kv->set_value(index_param.extra_params);
-        return client_ptr_->CreateIndex(grpc_index_param);
+        return Client()->CreateIndex(grpc_index_param);
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to build index: " + std::string(ex.what()));
     }
@@ -234,24 +319,14 @@ ClientProxy::Insert(const std::string& collection_name, const std::string& parti
     Status status = Status::OK();
     try {
         ::milvus::grpc::InsertParam insert_param;
-        insert_param.set_table_name(collection_name);
-        insert_param.set_partition_tag(partition_tag);
-
-        for (auto& entity : entity_array) {
-            ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
-            CopyRowRecord(grpc_record, entity);
-        }
+        ConstructInsertParam(collection_name, partition_tag, entity_array, id_array, insert_param);
 
         // Single thread
         ::milvus::grpc::VectorIds vector_ids;
         if (!id_array.empty()) {
-            /* set user's ids */
-            auto row_ids = insert_param.mutable_row_id_array();
-            row_ids->Resize(static_cast<int>(id_array.size()), -1);
-            memcpy(row_ids->mutable_data(), id_array.data(), id_array.size() * sizeof(int64_t));
-            status = client_ptr_->Insert(insert_param, vector_ids);
+            status = Client()->Insert(insert_param, vector_ids);
         } else {
-            status = client_ptr_->Insert(insert_param, vector_ids);
+            status = Client()->Insert(insert_param, vector_ids);
             /* return Milvus generated ids back to user */
             id_array.insert(id_array.end(), vector_ids.vector_id_array().begin(), vector_ids.vector_id_array().end());
         }
@@ -270,24 +345,12 @@ ClientProxy::GetEntityByID(const std::string& collection_name, int64_t entity_id
         vector_identity.set_id(entity_id);
 
         ::milvus::grpc::VectorData grpc_data;
-        Status status = client_ptr_->GetVectorByID(vector_identity, grpc_data);
+        Status status = Client()->GetVectorByID(vector_identity, grpc_data);
         if (!status.ok()) {
             return status;
         }
 
-        int float_size = grpc_data.vector_data().float_data_size();
-        if (float_size > 0) {
-            entity_data.float_data.resize(float_size);
-            memcpy(entity_data.float_data.data(), grpc_data.vector_data().float_data().data(),
-                   float_size * sizeof(float));
-        }
-
-        auto byte_size = grpc_data.vector_data().binary_data().length();
-        if (byte_size > 0) {
-            entity_data.binary_data.resize(byte_size);
-            memcpy(entity_data.binary_data.data(), grpc_data.vector_data().binary_data().data(), byte_size);
-        }
-
+        ConstructEntity(grpc_data, entity_data);
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to get entity by id: " + std::string(ex.what()));
@@ -303,7 +366,7 @@ ClientProxy::GetIDsInSegment(const std::string& collection_name, const std::stri
         param.set_segment_name(segment_name);
 
         ::milvus::grpc::VectorIds vector_ids;
-        Status status = client_ptr_->GetIDsInSegment(param, vector_ids);
+        Status status = Client()->GetIDsInSegment(param, vector_ids);
         if (!status.ok()) {
             return status;
         }
@@ -336,24 +399,10 @@ ClientProxy::Search(const std::string& collection_name, const std::vector<std::s
 
         // step 2: search vectors
         ::milvus::grpc::TopKQueryResult result;
-        Status status = client_ptr_->Search(search_param, result);
-        if (result.row_num() == 0) {
-            return status;
-        }
+        Status status = Client()->Search(search_param, result);
 
         // step 3: convert result array
-        topk_query_result.reserve(result.row_num());
-        int64_t nq = result.row_num();
-        int64_t topk = result.ids().size() / nq;
-        for (int64_t i = 0; i < result.row_num(); i++) {
-            milvus::QueryResult one_result;
-            one_result.ids.resize(topk);
-            one_result.distances.resize(topk);
-            memcpy(one_result.ids.data(), result.ids().data() + topk * i, topk * sizeof(int64_t));
-            memcpy(one_result.distances.data(), result.distances().data() + topk * i, topk * sizeof(float));
-            topk_query_result.emplace_back(one_result);
-        }
-
+        ConstructTopKQueryResult(result, topk_query_result);
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to search entities: " + std::string(ex.what()));
@@ -365,7 +414,7 @@ ClientProxy::DescribeCollection(const std::string& collection_name, CollectionPa
     try {
         ::milvus::grpc::TableSchema grpc_schema;
 
-        Status status = client_ptr_->DescribeTable(collection_name, grpc_schema);
+        Status status = Client()->DescribeTable(collection_name, grpc_schema);
 
         collection_param.collection_name = grpc_schema.table_name();
         collection_param.dimension = grpc_schema.dimension();
@@ -384,7 +433,7 @@ ClientProxy::CountCollection(const std::string& collection_name, int64_t& row_co
         Status status;
         ::milvus::grpc::TableName grpc_collection_name;
         grpc_collection_name.set_table_name(collection_name);
-        row_count = client_ptr_->CountTable(grpc_collection_name, status);
+        row_count = Client()->CountTable(grpc_collection_name, status);
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to count collection: " + std::string(ex.what()));
@@ -396,7 +445,7 @@ ClientProxy::ShowCollections(std::vector<std::string>& collection_array) {
     try {
         Status status;
         milvus::grpc::TableNameList collection_name_list;
-        status = client_ptr_->ShowTables(collection_name_list);
+        status = Client()->ShowTables(collection_name_list);
 
         collection_array.resize(collection_name_list.table_names_size());
         for (uint64_t i = 0; i < collection_name_list.table_names_size(); ++i) {
@@ -415,7 +464,7 @@ ClientProxy::ShowCollectionInfo(const std::string& collection_name, CollectionIn
         ::milvus::grpc::TableName grpc_collection_name;
         grpc_collection_name.set_table_name(collection_name);
         milvus::grpc::TableInfo grpc_collection_info;
-        status = client_ptr_->ShowTableInfo(grpc_collection_name, grpc_collection_info);
+        status = Client()->ShowTableInfo(grpc_collection_name, grpc_collection_info);
 
         // get native info
         collection_info.total_row_count = grpc_collection_info.total_row_count();
@@ -443,7 +492,7 @@ ClientProxy::DeleteByID(const std::string& collection_name,  const std::vector<i
             delete_by_id_param.add_id_array(id);
         }
 
-        return client_ptr_->DeleteByID(delete_by_id_param);
+        return Client()->DeleteByID(delete_by_id_param);
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to delete entity id: " + std::string(ex.what()));
     }
@@ -454,7 +503,7 @@ ClientProxy::PreloadCollection(const std::string& collection_name) const {
     try {
         ::milvus::grpc::TableName grpc_collection_name;
         grpc_collection_name.set_table_name(collection_name);
-        Status status = client_ptr_->PreloadTable(grpc_collection_name);
+        Status status = Client()->PreloadTable(grpc_collection_name);
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to preload collection: " + std::string(ex.what()));
@@ -468,7 +517,7 @@ ClientProxy::DescribeIndex(const std::string& collection_name, IndexParam& index
         grpc_collection_name.set_table_name(collection_name);
 
         ::milvus::grpc::IndexParam grpc_index_param;
-        Status status = client_ptr_->DescribeIndex(grpc_collection_name, grpc_index_param);
+        Status status = Client()->DescribeIndex(grpc_collection_name, grpc_index_param);
         index_param.index_type = static_cast<IndexType>(grpc_index_param.index_type());
 
         for (int i = 0; i < grpc_index_param.extra_params_size(); i++) {
@@ -489,7 +538,7 @@ ClientProxy::DropIndex(const std::string& collection_name) const {
     try {
         ::milvus::grpc::TableName grpc_collection_name;
         grpc_collection_name.set_table_name(collection_name);
-        Status status = client_ptr_->DropIndex(grpc_collection_name);
+        Status status = Client()->DropIndex(grpc_collection_name);
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to drop index: " + std::string(ex.what()));
@@ -502,7 +551,7 @@ ClientProxy::CreatePartition(const PartitionParam& partition_param) {
         ::milvus::grpc::PartitionParam grpc_partition_param;
         grpc_partition_param.set_table_name(partition_param.collection_name);
         grpc_partition_param.set_tag(partition_param.partition_tag);
-        Status status = client_ptr_->CreatePartition(grpc_partition_param);
+        Status status = Client()->CreatePartition(grpc_partition_param);
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to create partition: " + std::string(ex.what()));
@@ -515,7 +564,7 @@ ClientProxy::ShowPartitions(const std::string& collection_name, PartitionTagList
         ::milvus::grpc::TableName grpc_collection_name;
         grpc_collection_name.set_table_name(collection_name);
         ::milvus::grpc::PartitionList grpc_partition_list;
-        Status status = client_ptr_->ShowPartitions(grpc_collection_name, grpc_partition_list);
+        Status status = Client()->ShowPartitions(grpc_collection_name, grpc_partition_list);
         partition_tag_array.resize(grpc_partition_list.partition_tag_array_size());
         for (uint64_t i = 0; i < grpc_partition_list.partition_tag_array_size(); ++i) {
             partition_tag_array[i] = grpc_partition_list.partition_tag_array(i);
@@ -532,7 +581,7 @@ ClientProxy::DropPartition(const PartitionParam& partition_param) {
         ::milvus::grpc::PartitionParam grpc_partition_param;
         grpc_partition_param.set_table_name(partition_param.collection_name);
         grpc_partition_param.set_tag(partition_param.partition_tag);
-        Status status = client_ptr_->DropPartition(grpc_partition_param);
+        Status status = Client()->DropPartition(grpc_partition_param);
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to drop partition: " + std::string(ex.what()));
@@ -543,7 +592,7 @@ Status
 ClientProxy::FlushCollection(const std::string& collection_name) {
     try {
         std::string dummy;
-        return client_ptr_->Flush(collection_name);
+        return Client()->Flush(collection_name);
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to flush collection");
     }
@@ -553,7 +602,7 @@ Status
 ClientProxy::Flush() {
     try {
         std::string dummy;
-        return client_ptr_->Flush("");
+        return Client()->Flush("");
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to flush collections");
     }
@@ -564,11 +613,148 @@ ClientProxy::CompactCollection(const std::string& collection_name) {
     try {
         ::milvus::grpc::TableName grpc_collection_name;
         grpc_collection_name.set_table_name(collection_name);
-        Status status = client_ptr_->Compact(grpc_collection_name);
+        Status status = Client()->Compact(grpc_collection_name);
         return status;
     } catch (std::exception& ex) {
         return Status(StatusCode::UnknownError, "Failed to compact collection: " + std::string(ex.what()));
     }
 }
 
+Status
+ClientProxy::InsertAsync(const std::string& collection_name, const std::string& partition_tag,
+                         const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                         const InsertCallback& callback) {
+    auto client = Client();
+    if (client == nullptr) {
+        return Status(StatusCode::NotConnected, "Not connected to server");
+    }
+
+    try {
+        ::milvus::grpc::InsertParam insert_param;
+        ConstructInsertParam(collection_name, partition_tag, entity_array, id_array, insert_param);
+        client->InsertAsync(insert_param, [callback](const Status& status, ::milvus::grpc::VectorIds& vector_ids) {
+            std::vector<int64_t> ids(vector_ids.vector_id_array().begin(), vector_ids.vector_id_array().end());
+            callback(status, ids);
+        });
+        return Status::OK();
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to add entities: " + std::string(ex.what()));
+    }
+}
+
+Status
+ClientProxy::BufferedInsert(const std::string& collection_name, const std::string& partition_tag,
+                            const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                            const InsertCallback& callback) {
+    if (insert_batcher_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Not connected to server");
+    }
+    if (!id_array.empty() && id_array.size() != entity_array.size()) {
+        return Status(StatusCode::InvalidAgument, "The size of id array doesn't match the size of entity array");
+    }
+
+    try {
+        ::milvus::grpc::InsertParam insert_param;
+        ConstructInsertParam(collection_name, partition_tag, entity_array, id_array, insert_param);
+        insert_batcher_->Add(insert_param, callback);
+        return Status::OK();
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to buffer entities: " + std::string(ex.what()));
+    }
+}
+
+Status
+ClientProxy::FlushInsertBuffer() {
+    if (insert_batcher_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Not connected to server");
+    }
+
+    insert_batcher_->Flush();
+    return Status::OK();
+}
+
+Status
+ClientProxy::GetEntityByIDAsync(const std::string& collection_name, int64_t entity_id,
+                                const EntityCallback& callback) {
+    auto client = Client();
+    if (client == nullptr) {
+        return Status(StatusCode::NotConnected, "Not connected to server");
+    }
+
+    try {
+        ::milvus::grpc::VectorIdentity vector_identity;
+        vector_identity.set_table_name(collection_name);
+        vector_identity.set_id(entity_id);
+        client->GetVectorByIDAsync(vector_identity,
+                                   [callback](const Status& status, ::milvus::grpc::VectorData& grpc_data) {
+                                       Entity entity_data;
+                                       if (status.ok()) {
+                                           ConstructEntity(grpc_data, entity_data);
+                                       }
+                                       callback(status, entity_data);
+                                   });
+        return Status::OK();
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to get entity by id: " + std::string(ex.what()));
+    }
+}
+
+Status
+ClientProxy::SearchAsync(const std::string& collection_name, const PartitionTagList& partition_tag_array,
+                         const std::vector<Entity>& entity_array, int64_t topk, const std::string& extra_params,
+                         const SearchCallback& callback) {
+    auto client = Client();
+    if (client == nullptr) {
+        return Status(StatusCode::NotConnected, "Not connected to server");
+    }
+
+    try {
+        ::milvus::grpc::SearchParam search_param;
+        ConstructSearchParam(collection_name, partition_tag_array, topk, extra_params, search_param);
+        for (auto& entity : entity_array) {
+            ::milvus::grpc::RowRecord* row_record = search_param.add_query_record_array();
+            CopyRowRecord(row_record, entity);
+        }
+
+        client->SearchAsync(search_param, [callback](const Status& status, ::milvus::grpc::TopKQueryResult& result) {
+            TopKQueryResult topk_query_result;
+            ConstructTopKQueryResult(result, topk_query_result);
+            callback(status, topk_query_result);
+        });
+        return Status::OK();
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to search entities: " + std::string(ex.what()));
+    }
+}
+
+Status
+ClientProxy::DeleteByIDAsync(const std::string& collection_name, const std::vector<int64_t>& id_array,
+                             const StatusCallback& callback) {
+    auto client = Client();
+    if (client == nullptr) {
+        return Status(StatusCode::NotConnected, "Not connected to server");
+    }
+
+    try {
+        ::milvus::grpc::DeleteByIDParam delete_by_id_param;
+        delete_by_id_param.set_table_name(collection_name);
+        for (auto id : id_array) {
+            delete_by_id_param.add_id_array(id);
+        }
+
+        client->DeleteByIDAsync(delete_by_id_param, callback);
+        return Status::OK();
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to delete entity id: " + std::string(ex.what()));
+    }
+}
+
+std::shared_ptr<GrpcClient>
+ClientProxy::Client() const {
+    if (clients_.empty()) {
+        return nullptr;
+    }
+    return clients_[next_client_++ % clients_.size()];
+}
+
 }  // namespace milvus
@@ -12,8 +12,10 @@
 #pragma once
 
 #include "GrpcClient.h"
+#include "InsertBatcher.h"
 #include "MilvusApi.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -122,9 +124,40 @@ class ClientProxy : public Connection {
     Status
     CompactCollection(const std::string& collection_name) override;
 
+    Status
+    InsertAsync(const std::string& collection_name, const std::string& partition_tag,
+                const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                const InsertCallback& callback) override;
+
+    Status
+    BufferedInsert(const std::string& collection_name, const std::string& partition_tag,
+                   const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                   const InsertCallback& callback) override;
+
+    Status
+    FlushInsertBuffer() override;
+
+    Status
+    GetEntityByIDAsync(const std::string& collection_name, int64_t entity_id, const EntityCallback& callback) override;
+
+    Status
+    SearchAsync(const std::string& collection_name, const PartitionTagList& partition_tag_array,
+                const std::vector<Entity>& entity_array, int64_t topk, const std::string& extra_params,
+                const SearchCallback& callback) override;
+
+    Status
+    DeleteByIDAsync(const std::string& collection_name, const std::vector<int64_t>& id_array,
+                    const StatusCallback& callback) override;
+
+ private:
+    // one client per channel, picked round robin
+    std::shared_ptr<GrpcClient>
+    Client() const;
+
  private:
-    std::shared_ptr<::grpc::Channel> channel_;
-    std::shared_ptr<GrpcClient> client_ptr_;
+    std::vector<std::shared_ptr<GrpcClient>> clients_;
+    mutable std::atomic<uint64_t> next_client_{0};
+    std::shared_ptr<InsertBatcher> insert_batcher_;  // declared after clients_, destroyed before them
     bool connected_ = false;
 };
 
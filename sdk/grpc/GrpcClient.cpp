@@ -29,11 +29,55 @@ using grpc::ClientWriter;
 using grpc::Status;
 
 namespace milvus {
+
+namespace {
+
+struct AsyncCallBase {
+    virtual ~AsyncCallBase() = default;
+
+    virtual void
+    Done() = 0;
+};
+
+template <typename Reply>
+struct AsyncCallData : public AsyncCallBase {
+    ClientContext context;
+    Reply reply;
+    ::grpc::Status status;
+    std::unique_ptr<::grpc::ClientAsyncResponseReaderInterface<Reply>> reader;
+    std::function<void(const ::grpc::Status&, Reply&)> done;
+
+    void
+    Done() override {
+        done(status, reply);
+    }
+};
+
+Status
+ReplyStatus(const char* name, const ::grpc::Status& grpc_status, const ::milvus::grpc::Status& reply_status) {
+    if (!grpc_status.ok()) {
+        std::cerr << name << " rpc failed!" << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+    if (reply_status.error_code() != grpc::SUCCESS) {
+        std::cerr << reply_status.reason() << std::endl;
+        return Status(StatusCode::ServerFailed, reply_status.reason());
+    }
+    return Status::OK();
+}
+
+}  // namespace
+
 GrpcClient::GrpcClient(std::shared_ptr<::grpc::Channel>& channel)
     : stub_(::milvus::grpc::MilvusService::NewStub(channel)) {
+    cq_thread_ = std::thread(&GrpcClient::CompletionLoop, this);
 }
 
-GrpcClient::~GrpcClient() = default;
+GrpcClient::~GrpcClient() {
+    // pending calls are still delivered before Next() returns false
+    cq_.Shutdown();
+    cq_thread_.join();
+}
 
 Status
 GrpcClient::CreateTable(const ::milvus::grpc::TableSchema& table_schema) {
@@ -449,6 +493,72 @@ GrpcClient::Compact(milvus::grpc::TableName& table_name) {
     return Status::OK();
 }
 
+template <typename Request, typename Reply, typename Prepare>
+void
+GrpcClient::AsyncCall(Prepare prepare, const Request& request,
+                      const std::function<void(const ::grpc::Status&, Reply&)>& done) {
+    auto call = new AsyncCallData<Reply>();
+    call->done = done;
+    call->reader = ((*stub_).*prepare)(&call->context, request, &cq_);
+    call->reader->StartCall();
+    call->reader->Finish(&call->reply, &call->status, call);
+}
+
+void
+GrpcClient::CompletionLoop() {
+    void* tag = nullptr;
+    bool ok = false;
+    while (cq_.Next(&tag, &ok)) {
+        auto call = static_cast<AsyncCallBase*>(tag);
+        try {
+            call->Done();
+        } catch (std::exception& ex) {
+            std::cerr << "Exception in async callback: " << ex.what() << std::endl;
+        }
+        delete call;
+    }
+}
+
+void
+GrpcClient::InsertAsync(const ::milvus::grpc::InsertParam& insert_param,
+                        const std::function<void(const Status&, ::milvus::grpc::VectorIds&)>& callback) {
+    AsyncCall<::milvus::grpc::InsertParam, ::milvus::grpc::VectorIds>(
+        &::milvus::grpc::MilvusService::Stub::PrepareAsyncInsert, insert_param,
+        [callback](const ::grpc::Status& grpc_status, ::milvus::grpc::VectorIds& vector_ids) {
+            callback(ReplyStatus("Insert", grpc_status, vector_ids.status()), vector_ids);
+        });
+}
+
+void
+GrpcClient::GetVectorByIDAsync(const ::milvus::grpc::VectorIdentity& vector_identity,
+                               const std::function<void(const Status&, ::milvus::grpc::VectorData&)>& callback) {
+    AsyncCall<::milvus::grpc::VectorIdentity, ::milvus::grpc::VectorData>(
+        &::milvus::grpc::MilvusService::Stub::PrepareAsyncGetVectorByID, vector_identity,
+        [callback](const ::grpc::Status& grpc_status, ::milvus::grpc::VectorData& vector_data) {
+            callback(ReplyStatus("GetVectorByID", grpc_status, vector_data.status()), vector_data);
+        });
+}
+
+void
+GrpcClient::SearchAsync(const ::milvus::grpc::SearchParam& search_param,
+                        const std::function<void(const Status&, ::milvus::grpc::TopKQueryResult&)>& callback) {
+    AsyncCall<::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>(
+        &::milvus::grpc::MilvusService::Stub::PrepareAsyncSearch, search_param,
+        [callback](const ::grpc::Status& grpc_status, ::milvus::grpc::TopKQueryResult& result) {
+            callback(ReplyStatus("Search", grpc_status, result.status()), result);
+        });
+}
+
+void
+GrpcClient::DeleteByIDAsync(const ::milvus::grpc::DeleteByIDParam& delete_by_id_param,
+                            const std::function<void(const Status&)>& callback) {
+    AsyncCall<::milvus::grpc::DeleteByIDParam, ::milvus::grpc::Status>(
+        &::milvus::grpc::MilvusService::Stub::PrepareAsyncDeleteByID, delete_by_id_param,
+        [callback](const ::grpc::Status& grpc_status, ::milvus::grpc::Status& reply) {
+            callback(ReplyStatus("DeleteByID", grpc_status, reply));
+        });
+}
+
 Status
 GrpcClient::Disconnect() {
     stub_.release();
@@ -16,6 +16,7 @@
 //#include "grpc/gen-status/status.grpc.pb.h"
 
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <random>
@@ -25,6 +26,7 @@
 #include <grpc/grpc.h>
 #include <grpcpp/channel.h>
 #include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
@@ -104,8 +106,36 @@ class GrpcClient {
     Status
     Disconnect();
 
+    // asynchronous calls, callbacks run on the completion queue thread of this client
+    void
+    InsertAsync(const grpc::InsertParam& insert_param,
+                const std::function<void(const Status&, grpc::VectorIds&)>& callback);
+
+    void
+    GetVectorByIDAsync(const grpc::VectorIdentity& vector_identity,
+                       const std::function<void(const Status&, grpc::VectorData&)>& callback);
+
+    void
+    SearchAsync(const grpc::SearchParam& search_param,
+                const std::function<void(const Status&, grpc::TopKQueryResult&)>& callback);
+
+    void
+    DeleteByIDAsync(const grpc::DeleteByIDParam& delete_by_id_param,
+                    const std::function<void(const Status&)>& callback);
+
+ private:
+    template <typename Request, typename Reply, typename Prepare>
+    void
+    AsyncCall(Prepare prepare, const Request& request,
+              const std::function<void(const ::grpc::Status&, Reply&)>& done);
+
+    void
+    CompletionLoop();
+
  private:
     std::unique_ptr<grpc::MilvusService::Stub> stub_;
+    ::grpc::CompletionQueue cq_;
+    std::thread cq_thread_;
 };
 
 }  // namespace milvus
@@ -0,0 +1,127 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "grpc/InsertBatcher.h"
+
+#include <algorithm>
+
+namespace milvus {
+
+InsertBatcher::InsertBatcher(const SendFunc& send, int64_t batch_rows, int64_t delay_ms)
+    : send_(send), batch_rows_(std::max<int64_t>(batch_rows, 1)), delay_(std::max<int64_t>(delay_ms, 0)) {
+    timer_thread_ = std::thread(&InsertBatcher::TimerLoop, this);
+}
+
+InsertBatcher::~InsertBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    timer_thread_.join();
+    Flush();
+}
+
+void
+InsertBatcher::Add(const ::milvus::grpc::InsertParam& insert_param, const InsertCallback& callback) {
+    std::string key = insert_param.table_name() + '\0' + insert_param.partition_tag() + '\0' +
+                      (insert_param.row_id_array_size() > 0 ? "ids" : "");
+
+    BatchPtr full_batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& batch = batches_[key];
+        if (batch == nullptr) {
+            batch = std::make_shared<Batch>();
+            batch->insert_param.set_table_name(insert_param.table_name());
+            batch->insert_param.set_partition_tag(insert_param.partition_tag());
+            batch->create_time = std::chrono::steady_clock::now();
+            cv_.notify_one();
+        }
+        batch->insert_param.mutable_row_record_array()->MergeFrom(insert_param.row_record_array());
+        batch->insert_param.mutable_row_id_array()->MergeFrom(insert_param.row_id_array());
+        batch->callers.emplace_back(insert_param.row_record_array_size(), callback);
+
+        if (batch->insert_param.row_record_array_size() >= batch_rows_) {
+            full_batch = batch;
+            batches_.erase(key);
+        }
+    }
+
+    if (full_batch != nullptr) {
+        Send(full_batch);
+    }
+}
+
+void
+InsertBatcher::Flush() {
+    std::map<std::string, BatchPtr> batches;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batches.swap(batches_);
+    }
+    for (auto& pair : batches) {
+        Send(pair.second);
+    }
+}
+
+void
+InsertBatcher::Send(const BatchPtr& batch) {
+    send_(batch->insert_param, [batch](const Status& status, ::milvus::grpc::VectorIds& vector_ids) {
+        auto& ids = vector_ids.vector_id_array();
+        int64_t offset = 0;
+        for (auto& caller : batch->callers) {
+            std::vector<int64_t> id_array;
+            if (status.ok() && offset + caller.first <= static_cast<int64_t>(ids.size())) {
+                id_array.assign(ids.begin() + offset, ids.begin() + offset + caller.first);
+            }
+            offset += caller.first;
+            caller.second(status, id_array);
+        }
+    });
+}
+
+void
+InsertBatcher::TimerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        auto now = std::chrono::steady_clock::now();
+        auto wake_time = now + delay_;
+        std::vector<BatchPtr> expired;
+        for (auto iter = batches_.begin(); iter != batches_.end();) {
+            auto deadline = iter->second->create_time + delay_;
+            if (deadline <= now) {
+                expired.push_back(iter->second);
+                iter = batches_.erase(iter);
+            } else {
+                wake_time = std::min(wake_time, deadline);
+                ++iter;
+            }
+        }
+
+        if (!expired.empty()) {
+            lock.unlock();
+            for (auto& batch : expired) {
+                Send(batch);
+            }
+            lock.lock();
+            continue;
+        }
+
+        if (batches_.empty()) {
+            cv_.wait(lock);
+        } else {
+            cv_.wait_until(lock, wake_time);
+        }
+    }
+}
+
+}  // namespace milvus
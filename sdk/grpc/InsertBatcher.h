@@ -0,0 +1,78 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include "MilvusApi.h"
+#include "grpc-gen/gen-milvus/milvus.grpc.pb.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace milvus {
+
+/*
+ * Client side batching of small inserts. Requests of the same collection and partition are merged into one
+ * insert request, which is sent once it holds batch_rows entities, once its first entity waited delay_ms,
+ * or on Flush(). Requests with user ids are never merged with requests without, the server rejects mixing.
+ * Each caller gets back the ids of its own entities.
+ */
+class InsertBatcher {
+ public:
+    using VectorIdsCallback = std::function<void(const Status&, ::milvus::grpc::VectorIds&)>;
+    using SendFunc = std::function<void(const ::milvus::grpc::InsertParam&, const VectorIdsCallback&)>;
+
+    InsertBatcher(const SendFunc& send, int64_t batch_rows, int64_t delay_ms);
+
+    // sends what is still buffered
+    ~InsertBatcher();
+
+    void
+    Add(const ::milvus::grpc::InsertParam& insert_param, const InsertCallback& callback);
+
+    void
+    Flush();
+
+ private:
+    struct Batch {
+        ::milvus::grpc::InsertParam insert_param;
+        std::vector<std::pair<int64_t, InsertCallback>> callers;  // entity count and callback of each caller
+        std::chrono::steady_clock::time_point create_time;
+    };
+    using BatchPtr = std::shared_ptr<Batch>;
+
+    void
+    Send(const BatchPtr& batch);
+
+    void
+    TimerLoop();
+
+ private:
+    SendFunc send_;
+    int64_t batch_rows_;
+    std::chrono::milliseconds delay_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<std::string, BatchPtr> batches_;
+    bool stop_ = false;
+    std::thread timer_thread_;
+};
+
+}  // namespace milvus
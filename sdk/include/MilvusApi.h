@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -49,8 +50,11 @@ enum class MetricType {
  * @brief Connect API parameter
  */
 struct ConnectParam {
-    std::string ip_address;  ///< Server IP address
-    std::string port;        ///< Server PORT
+    std::string ip_address;              ///< Server IP address
+    std::string port;                    ///< Server PORT
+    int64_t channel_count = 1;           ///< Number of gRPC channels, requests are distributed round robin
+    int64_t insert_batch_rows = 1024;    ///< BufferedInsert sends a batch once it holds this many entities
+    int64_t insert_batch_delay_ms = 10;  ///< BufferedInsert sends a batch once it is this old
 };
 
 /**
@@ -122,6 +126,8 @@ struct SegmentStat {
     int64_t row_count;           ///< Segment row count
     std::string index_name;      ///< Segment index name
     int64_t data_size;           ///< Segment data size
+    std::string build_stage;     ///< Index build stage, empty unless the segment waits for or is under index building
+    int64_t built_count;         ///< Rows added to the index under building
 };
 
 /**
@@ -141,6 +147,16 @@ struct CollectionInfo {
     std::vector<PartitionStat> partitions_stat;   ///< Collection's partitions statistics
 };
 
+/**
+ * @brief Callbacks of asynchronous methods
+ * Callbacks are invoked on an internal thread of the connection, they should return quickly
+ * and must not wait for other asynchronous calls of the same connection.
+ */
+using StatusCallback = std::function<void(const Status& status)>;
+using InsertCallback = std::function<void(const Status& status, const std::vector<int64_t>& id_array)>;
+using EntityCallback = std::function<void(const Status& status, const Entity& entity_data)>;
+using SearchCallback = std::function<void(const Status& status, const TopKQueryResult& topk_query_result)>;
+
 /**
  * @brief SDK main class
  */
@@ -572,6 +588,96 @@ class Connection {
      */
     virtual Status
     CompactCollection(const std::string& collection_name) = 0;
+
+    /**
+     * @brief Insert entity to collection asynchronously
+     *
+     * Same as Insert, the request is sent without waiting for the reply.
+     *
+     * @param collection_name, target collection's name.
+     * @param partition_tag, target partition's tag, keep empty if no partition specified.
+     * @param entity_array, entity array is inserted, each entity represent a vector.
+     * @param id_array, specify id for each entity, keep empty to let milvus generate ids.
+     * @param callback, called with the insert status and the entity ids.
+     *
+     * @return Indicate if the request is sent successfully.
+     */
+    virtual Status
+    InsertAsync(const std::string& collection_name,
+                const std::string& partition_tag,
+                const std::vector<Entity>& entity_array,
+                const std::vector<int64_t>& id_array,
+                const InsertCallback& callback) = 0;
+
+    /**
+     * @brief Insert entity to collection through the client side insert buffer
+     *
+     * Small inserts to the same collection and partition are merged into one request, which is sent
+     * once it holds ConnectParam::insert_batch_rows entities, once its first entity waited
+     * ConnectParam::insert_batch_delay_ms, or on FlushInsertBuffer.
+     * Inserts with user ids and inserts without are never merged together.
+     *
+     * @param collection_name, target collection's name.
+     * @param partition_tag, target partition's tag, keep empty if no partition specified.
+     * @param entity_array, entity array is inserted, each entity represent a vector.
+     * @param id_array, specify id for each entity, keep empty to let milvus generate ids.
+     * @param callback, called with the status of the merged request and the ids of this call's entities.
+     *
+     * @return Indicate if the entities are buffered successfully.
+     */
+    virtual Status
+    BufferedInsert(const std::string& collection_name,
+                   const std::string& partition_tag,
+                   const std::vector<Entity>& entity_array,
+                   const std::vector<int64_t>& id_array,
+                   const InsertCallback& callback) = 0;
+
+    /**
+     * @brief Send all buffered inserts now
+     *
+     * This method doesn't wait for the replies, the callbacks of BufferedInsert tell when they are done.
+     *
+     * @return Indicate if this operation is successful.
+     */
+    virtual Status
+    FlushInsertBuffer() = 0;
+
+    /**
+     * @brief Get entity data by id asynchronously
+     *
+     * @param collection_name, target collection's name.
+     * @param entity_id, target entity id.
+     * @param callback, called with the status and the entity data.
+     *
+     * @return Indicate if the request is sent successfully.
+     */
+    virtual Status
+    GetEntityByIDAsync(const std::string& collection_name, int64_t entity_id, const EntityCallback& callback) = 0;
+
+    /**
+     * @brief Search entities in a collection asynchronously
+     *
+     * Same parameters as Search, the result is given to the callback.
+     *
+     * @return Indicate if the request is sent successfully.
+     */
+    virtual Status
+    SearchAsync(const std::string& collection_name, const PartitionTagList& partition_tag_array,
+                const std::vector<Entity>& entity_array, int64_t topk,
+                const std::string& extra_params, const SearchCallback& callback) = 0;
+
+    /**
+     * @brief Delete entity by id asynchronously
+     *
+     * @param collection_name, target collection's name.
+     * @param id_array, entity id array to be deleted.
+     * @param callback, called with the status.
+     *
+     * @return Indicate if the request is sent successfully.
+     */
+    virtual Status
+    DeleteByIDAsync(const std::string& collection_name, const std::vector<int64_t>& id_array,
+                    const StatusCallback& callback) = 0;
 };
 
 }  // namespace milvus
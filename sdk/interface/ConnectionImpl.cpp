@@ -190,4 +190,43 @@ ConnectionImpl::CompactCollection(const std::string& collection_name) {
     return client_proxy_->CompactCollection(collection_name);
 }
 
+Status
+ConnectionImpl::InsertAsync(const std::string& collection_name, const std::string& partition_tag,
+                            const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                            const InsertCallback& callback) {
+    return client_proxy_->InsertAsync(collection_name, partition_tag, entity_array, id_array, callback);
+}
+
+Status
+ConnectionImpl::BufferedInsert(const std::string& collection_name, const std::string& partition_tag,
+                               const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                               const InsertCallback& callback) {
+    return client_proxy_->BufferedInsert(collection_name, partition_tag, entity_array, id_array, callback);
+}
+
+Status
+ConnectionImpl::FlushInsertBuffer() {
+    return client_proxy_->FlushInsertBuffer();
+}
+
+Status
+ConnectionImpl::GetEntityByIDAsync(const std::string& collection_name, int64_t entity_id,
+                                   const EntityCallback& callback) {
+    return client_proxy_->GetEntityByIDAsync(collection_name, entity_id, callback);
+}
+
+Status
+ConnectionImpl::SearchAsync(const std::string& collection_name, const PartitionTagList& partition_tag_array,
+                            const std::vector<Entity>& entity_array, int64_t topk, const std::string& extra_params,
+                            const SearchCallback& callback) {
+    return client_proxy_->SearchAsync(collection_name, partition_tag_array, entity_array, topk, extra_params,
+                                      callback);
+}
+
+Status
+ConnectionImpl::DeleteByIDAsync(const std::string& collection_name, const std::vector<int64_t>& id_array,
+                                const StatusCallback& callback) {
+    return client_proxy_->DeleteByIDAsync(collection_name, id_array, callback);
+}
+
 }  // namespace milvus
@@ -124,6 +124,31 @@ class ConnectionImpl : public Connection {
     Status
     CompactCollection(const std::string& collection_name) override;
 
+    Status
+    InsertAsync(const std::string& collection_name, const std::string& partition_tag,
+                const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                const InsertCallback& callback) override;
+
+    Status
+    BufferedInsert(const std::string& collection_name, const std::string& partition_tag,
+                   const std::vector<Entity>& entity_array, const std::vector<int64_t>& id_array,
+                   const InsertCallback& callback) override;
+
+    Status
+    FlushInsertBuffer() override;
+
+    Status
+    GetEntityByIDAsync(const std::string& collection_name, int64_t entity_id, const EntityCallback& callback) override;
+
+    Status
+    SearchAsync(const std::string& collection_name, const PartitionTagList& partition_tag_array,
+                const std::vector<Entity>& entity_array, int64_t topk, const std::string& extra_params,
+                const SearchCallback& callback) override;
+
+    Status
+    DeleteByIDAsync(const std::string& collection_name, const std::vector<int64_t>& id_array,
+                    const StatusCallback& callback) override;
+
  private:
     std::shared_ptr<ClientProxy> client_proxy_;
 };